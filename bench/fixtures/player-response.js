@@ -0,0 +1 @@
+var ytInitialPlayerResponse = {"responseContext":{"serviceTrackingParams":[{"service":"GFEEDBACK","params":[{"key":"browse_id","value":"mbRYVYCqaOQ3"},{"key":"logged_in","value":"Cx-VH_TuIsyw"},{"key":"e","value":"vjXR_eY8xkTP"},{"key":"c","value":"62uINK5U9nPp"},{"key":"cver","value":"HlamdrGZWdCq"},{"key":"yt_li","value":"20n0EIhKi7h3"},{"key":"GetPlayer_rid","value":"7d9yJsyFZCWs"}]},{"service":"CSI","params":[{"key":"browse_id","value":"pX_Ilcu9c9Iw"},{"key":"logged_in","value":"QsUgh7Qk3jsu"},{"key":"e","value":"GihBa01MVIW0"},{"key":"c","value":"KqD4qQrdHvad"},{"key":"cver","value":"1BvaZg8HyiSx"},{"key":"yt_li","value":"3ZlDBjINewYu"},{"key":"GetPlayer_rid","value":"QDCGHWY59sC-"}]},{"service":"GUIDED_HELP","params":[{"key":"browse_id","value":"2gd8ooXx82dL"},{"key":"logged_in","value":"jsakFnW_HcRL"},{"key":"e","value":"84vVq2XqfJCJ"},{"key":"c","value":"mlAAwVINuDQu"},{"key":"cver","value":"ursQvL3f_4r1"},{"key":"yt_li","value":"yf19w9-qtu-U"},{"key":"GetPlayer_rid","value":"1qO3dAlt60nl"}]},{"service":"ECATCHER","params":[{"key":"browse_id","value":"tb2sE44HjLi6"},{"key":"logged_in","value":"VNbTOG5sRZKm"},{"key":"e","value":"3zp-jXTdBqC6"},{"key":"c","value":"Zfhv5V4v_lI4"},{"key":"cver","value":"mx_nYltvdIGi"},{"key":"yt_li","value":"5pzvsNmhY8xR"},{"key":"GetPlayer_rid","value":"bO4_hR6EkC8w"}]}],"maxAgeSeconds":0,"mainAppWebResponseContext":{"loggedOut":true,"trackingParam":"kx_fmPxhoPZRd8MxKMSZzRnU5xaM2wMufK1EmbjJgvsVj3_8w1SHwACIC5l9ohF3OxRCmc7n7DTpeRV3CGFAt2tCw55KXOpW2aXnBAKzTtdriNAhBxEIWPTnlqjx_z_SB6V4Rau7QtJiBzqou4BV9Yjzq7Ff25uw7A0XHbnkR9a2CqD9hHEQ9hxqyLnNa2GvnE0dmxNuGoRrBQqMqaxQNIgueKhCmZP0u2MdA5L6uZvGBi8S3pd9C02Jk-gEWtcy7Iz9Ieq9iEyCC5aEnBtfo01jBbop15DTRBbaxXxUF_M1wbMdCVl0CRE5qP2a-pFZW6f_dVL6ESJW26FieDoSLpeFi4dAay_Ken2t853tcOVodRvXH1YdD1N4nb0oojQ_FKBcBv9kQpyOxlTvq5Yml4DKItew"},"webResponseContextExtensionData":{"hasDecorated":true}},"playabilityStatus":{"status":"OK","playableInEmbed":true,"miniplayer":{"miniplayerRenderer":{"playbackMode":"PLAYBACK_MODE_ALLOW"}},"contextParams":"Q0FFU0FnZ0I\u003d"},"streamingData":{"expiresInSeconds":"21540","formats":[{"itag":18,"mimeType":"video/mp4; codecs\u003d\"avc1.42001E, mp4a.40.2\"","bitrate":503235,"width":640,"height":360,"lastModified":"1706574391283117","quality":"medium","fps":25,"qualityLabel":"360p","projectionType":"RECTANGULAR","audioQuality":"AUDIO_QUALITY_LOW","approxDurationMs":"212091","audioSampleRate":"44100","audioChannels":2,"signatureCipher":"s\u003deQv8IB8hdY88yTdTxBIUFmDi8x2y4RuMER_bh3m1xs0drDjUpNbikPI99LsI0TCl21PFFwqjeEnAJNEZ0lhTFrouRww6xNi3em3hmrB1oCwR\u0026sp\u003dsig\u0026url\u003dhttps%3A%2F%2Frr3---sn-2gb7sn7k.googlevideo.com%2Fvideoplayback%3Fexpire%3D1760900000%26ei%3DHq7ttj-CHCvg6moWuXov%26ip%3D2001%253A718%253A1%253A0%253A0%253A0%253A0%253A1%26id%3Do-hmwNDQnciepX3MNpqc4VKrb5icPEYoXjrKsQ1li7s1l1%26itag%3D18%26source%3Dyoutube%26requiressl%3Dyes%26xpc%3D0E0TZA93cE6krdIkPfFEZ3GB9PVm%26mh%3D7c%26mm%3D31%252C29%26mn%3Dsn-2gb7sn7k%252Csn-2gb7sn7l%26ms%3Dau%252Crdu%26mv%3Dm%26mvi%3D3%26pl%3D48%26initcwndbps%3D2915000%26vprv%3D1%26svpuc%3D1%26mime%3Dvideo%252Fmp4%26rqh%3D1%26gir%3Dyes%26clen%3D13334024%26dur%3D212.091%26lmt%3D1706574405848131%26mt%3D1760878110%26fvip%3D4%26keepalive%3Dyes%26c%3DWEB%26sefc%3D1%26txp%3D5535434%26n%3DeC0GOrQg9HtcZPPV%26sparams%3Dexpire%252Cei%252Cip%252Cid%252Citag%252Csource%252Crequiressl%252Cxpc%252Cvprv%252Csvpuc%252Cmime%252Crqh%252Cgir%252Cclen%252Cdur%252Clmt%26lsparams%3Dmh%252Cmm%252Cmn%252Cms%252Cmv%252Cmvi%252Cpl%252Cinitcwndbps%26lsig%3DejQA-zGifi2G8pAHQFPGI9EL-oUoJsxxmuhYq2PQAwKWFv6wF3Gv_o116CfbiJ2c2QDpvhP7PwNoNA8S"}],"adaptiveFormats":[{"itag":137,"mimeType":"video/mp4; codecs\u003d\"avc1.640028\"","bitrate":3347666,"width":1920,"height":1080,"initRange":{"start":"0","end":"598"},"indexRange":{"start":"741","end":"1260"},"lastModified":"1706574405848131","contentLength":"33671394","quality":"hd1080","fps":25,"qualityLabel":"1080p","projectionType":"RECTANGULAR","averageBitrate":285861,"approxDurationMs":"212040","signatureCipher":"s\u003dLMwWDrPDO9kmLEeNMHpXJeXf6ygvys1Kwe0U19TzTUM_94XRiZSodl0ibnCi9wZWuep9S19a7D9JzF7deIbgeYhRXEgVFoX2LKPLhlEt5rAD\u0026sp\u003dsig\u0026url\u003dhttps%3A%2F%2Frr3---sn-2gb7sn7k.googlevideo.com%2Fvideoplayback%3Fexpire%3D1760900000%26ei%3Dqq3w-Ja-yQoPjJ3O4gMv%26ip%3D2001%253A718%253A1%253A0%253A0%253A0%253A0%253A1%26id%3Do-v5lhNrO_tHlXTWv6PNSq1mX69nWINXytMiixGRF9iftq%26itag%3D137%26source%3Dyoutube%26requiressl%3Dyes%26xpc%3Dz5It_OTiMOOXY1yQSyYVWZgvlD40%26mh%3D7c%26mm%3D31%252C29%26mn%3Dsn-2gb7sn7k%252Csn-2gb7sn7l%26ms%3Dau%252Crdu%26mv%3Dm%26mvi%3D3%26pl%3D48%26initcwndbps%3D2915000%26vprv%3D1%26svpuc%3D1%26mime%3Dvideo%252Fmp4%26rqh%3D1%26gir%3Dyes%26clen%3D33671394%26dur%3D212.091%26lmt%3D1706574405848131%26mt%3D1760878110%26fvip%3D4%26keepalive%3Dyes%26c%3DWEB%26sefc%3D1%26txp%3D5535434%26n%3Dxon_m9DYANd-W6ZY%26sparams%3Dexpire%252Cei%252Cip%252Cid%252Citag%252Csource%252Crequiressl%252Cxpc%252Cvprv%252Csvpuc%252Cmime%252Crqh%252Cgir%252Cclen%252Cdur%252Clmt%26lsparams%3Dmh%252Cmm%252Cmn%252Cms%252Cmv%252Cmvi%252Cpl%252Cinitcwndbps%26lsig%3DbE4OkTR7LGDudJ_CrpqsRKEKraIZ3c-oNF0JZUy_8I2a-mC76z4X6Eguv5uzcAahvS6YUaCVzVDROV4-"},{"itag":248,"mimeType":"video/webm; codecs\u003d\"vp9\"","bitrate":350474,"width":1920,"height":1080,"initRange":{"start":"0","end":"222"},"indexRange":{"start":"741","end":"1260"},"lastModified":"1706574405848131","contentLength":"26803583","quality":"hd1080","fps":25,"qualityLabel":"1080p","projectionType":"RECTANGULAR","averageBitrate":1790756,"approxDurationMs":"212040","signatureCipher":"s\u003d5o0EGezFy_DceMx8YVqOsPGlj7m-fiDrsoLH3LANDLCVE9GYqZ9r9sEwnyLlX0OxqzWxtXu14d49siVx-FTVC7LMoeHG57qvAJYzNrnO5Kae\u0026sp\u003dsig\u0026url\u003dhttps%3A%2F%2Frr3---sn-2gb7sn7k.googlevideo.com%2Fvideoplayback%3Fexpire%3D1760900000%26ei%3DGTSBOdkac1oY7WKFODMZ%26ip%3D2001%253A718%253A1%253A0%253A0%253A0%253A0%253A1%26id%3Do-gKN7zcN-sz5Ol4waOA7mJrsY-Ju2IbfsHqe34KgbpVab%26itag%3D248%26source%3Dyoutube%26requiressl%3Dyes%26xpc%3D71vY0908ElCXMDTlH8FYaj-3Es7Z%26mh%3D7c%26mm%3D31%252C29%26mn%3Dsn-2gb7sn7k%252Csn-2gb7sn7l%26ms%3Dau%252Crdu%26mv%3Dm%26mvi%3D3%26pl%3D48%26initcwndbps%3D2915000%26vprv%3D1%26svpuc%3D1%26mime%3Dvideo%252Fwebm%26rqh%3D1%26gir%3Dyes%26clen%3D26803583%26dur%3D212.091%26lmt%3D1706574405848131%26mt%3D1760878110%26fvip%3D4%26keepalive%3Dyes%26c%3DWEB%26sefc%3D1%26txp%3D5535434%26n%3DkSN4m04JaT-kwvU3%26sparams%3Dexpire%252Cei%252Cip%252Cid%252Citag%252Csource%252Crequiressl%252Cxpc%252Cvprv%252Csvpuc%252Cmime%252Crqh%252Cgir%252Cclen%252Cdur%252Clmt%26lsparams%3Dmh%252Cmm%252Cmn%252Cms%252Cmv%252Cmvi%252Cpl%252Cinitcwndbps%26lsig%3Dn78cukkD7vtmfBBQTCVGAa7tuE-XeBj3rGM5nhf_1hrFD2EVfR0rRjCVFC-H671vVlXJRN0t46jg5kTo"},{"itag":136,"mimeType":"video/mp4; codecs\u003d\"avc1.4d401f\"","bitrate":2289420,"width":1280,"height":720,"initRange":{"start":"0","end":"238"},"indexRange":{"start":"741","end":"1260"},"lastModified":"1706574405848131","contentLength":"20743646","quality":"hd720","fps":25,"qualityLabel":"720p","projectionType":"RECTANGULAR","averageBitrate":1827535,"approxDurationMs":"212040","signatureCipher":"s\u003d-d6iDoO-QjiN3JvE-5YnsXxyoGibEooykEQ1g0K_dZKOPAkI3i97ilGWe-VSTW7yBSyGXWnYQSGTbwN3xXDjNQOSlQxtJYAvS9fIt-No8Cs4\u0026sp\u003dsig\u0026url\u003dhttps%3A%2F%2Frr3---sn-2gb7sn7k.googlevideo.com%2Fvideoplayback%3Fexpire%3D1760900000%26ei%3D07n4T6xZlWmVoiZQGH0W%26ip%3D2001%253A718%253A1%253A0%253A0%253A0%253A0%253A1%26id%3Do-OBUPzvjL74pSbp6votsrkmiXPcrfk3i5Q9qW4GI12lHe%26itag%3D136%26source%3Dyoutube%26requiressl%3Dyes%26xpc%3DwxbJubH_P3xuBmvvz4vN_SpcAvIA%26mh%3D7c%26mm%3D31%252C29%26mn%3Dsn-2gb7sn7k%252Csn-2gb7sn7l%26ms%3Dau%252Crdu%26mv%3Dm%26mvi%3D3%26pl%3D48%26initcwndbps%3D2915000%26vprv%3D1%26svpuc%3D1%26mime%3Dvideo%252Fmp4%26rqh%3D1%26gir%3Dyes%26clen%3D20743646%26dur%3D212.091%26lmt%3D1706574405848131%26mt%3D1760878110%26fvip%3D4%26keepalive%3Dyes%26c%3DWEB%26sefc%3D1%26txp%3D5535434%26n%3DRKap3kZDDo4ub4rP%26sparams%3Dexpire%252Cei%252Cip%252Cid%252Citag%252Csource%252Crequiressl%252Cxpc%252Cvprv%252Csvpuc%252Cmime%252Crqh%252Cgir%252Cclen%252Cdur%252Clmt%26lsparams%3Dmh%252Cmm%252Cmn%252Cms%252Cmv%252Cmvi%252Cpl%252Cinitcwndbps%26lsig%3Dwc8RnkYPWK3DswA-X8jRxa3m3kMKI4pIBp92Mq1cpZyLGDeKXd8yks6dZmrRutoa5H3nY_bXN6PyboXE"},{"itag":247,"mimeType":"video/webm; codecs\u003d\"vp9\"","bitrate":2191938,"width":1280,"height":720,"initRange":{"start":"0","end":"452"},"indexRange":{"start":"741","end":"1260"},"lastModified":"1706574405848131","contentLength":"45886104","quality":"hd720","fps":25,"qualityLabel":"720p","projectionType":"RECTANGULAR","averageBitrate":1711980,"approxDurationMs":"212040","signatureCipher":"s\u003dHezuxcWkgshGrOacm4WVf9abudWy2Wm4vHK6-CWi1_cx-sz9WO1rSpNsSm9T5v_FsZLmkp0lB2s29vXflYxOpUo-Wy7Z0uNH9ZVVPMPxoyjI\u0026sp\u003dsig\u0026url\u003dhttps%3A%2F%2Frr3---sn-2gb7sn7k.googlevideo.com%2Fvideoplayback%3Fexpire%3D1760900000%26ei%3D9jodhPbO9v3ShvXhZcfh%26ip%3D2001%253A718%253A1%253A0%253A0%253A0%253A0%253A1%26id%3Do-srNMRKc6qOpSVF-iRv4223glixTFEV3AbQavgFtZPUbJ%26itag%3D247%26source%3Dyoutube%26requiressl%3Dyes%26xpc%3D-2kTOrUhRLKRMAKy64hWAIk1VAEr%26mh%3D7c%26mm%3D31%252C29%26mn%3Dsn-2gb7sn7k%252Csn-2gb7sn7l%26ms%3Dau%252Crdu%26mv%3Dm%26mvi%3D3%26pl%3D48%26initcwndbps%3D2915000%26vprv%3D1%26svpuc%3D1%26mime%3Dvideo%252Fwebm%26rqh%3D1%26gir%3Dyes%26clen%3D45886104%26dur%3D212.091%26lmt%3D1706574405848131%26mt%3D1760878110%26fvip%3D4%26keepalive%3Dyes%26c%3DWEB%26sefc%3D1%26txp%3D5535434%26n%3DpuNFbxB4pc45eAsb%26sparams%3Dexpire%252Cei%252Cip%252Cid%252Citag%252Csource%252Crequiressl%252Cxpc%252Cvprv%252Csvpuc%252Cmime%252Crqh%252Cgir%252Cclen%252Cdur%252Clmt%26lsparams%3Dmh%252Cmm%252Cmn%252Cms%252Cmv%252Cmvi%252Cpl%252Cinitcwndbps%26lsig%3DdU1yMyoOflMDzDrcZ6hwa2nIW5MkS4QnVculPJ_I9f1CBC8AH9BGsln8-mnQnLzFOYeKUyRVKmA_Iu_K"},{"itag":135,"mimeType":"video/mp4; codecs\u003d\"avc1.4d401e\"","bitrate":2896658,"width":854,"height":480,"initRange":{"start":"0","end":"540"},"indexRange":{"start":"741","end":"1260"},"lastModified":"1706574405848131","contentLength":"58601154","quality":"large","fps":25,"qualityLabel":"480p","projectionType":"RECTANGULAR","averageBitrate":2451054,"approxDurationMs":"212040","signatureCipher":"s\u003dy37rDpn9h8gatMh919ZrHeGzexXoMW5g31rw3FuyuyicRdZD0Nz99w3Z8yHUCYMRyOPNblQ23SUb2_o4DgCroxbPkZKaxfcqdLqmbayAmeSj\u0026sp\u003dsig\u0026url\u003dhttps%3A%2F%2Frr3---sn-2gb7sn7k.googlevideo.com%2Fvideoplayback%3Fexpire%3D1760900000%26ei%3DJgsalTsbZO62gHyhkZ5a%26ip%3D2001%253A718%253A1%253A0%253A0%253A0%253A0%253A1%26id%3Do-nsLN1zsegPPDWosVcpGOoI0qlC-44V9APVv9jwZ6w8uu%26itag%3D135%26source%3Dyoutube%26requiressl%3Dyes%26xpc%3DBq9_5B8JnXdOWWhoKuAcqBGwVN5s%26mh%3D7c%26mm%3D31%252C29%26mn%3Dsn-2gb7sn7k%252Csn-2gb7sn7l%26ms%3Dau%252Crdu%26mv%3Dm%26mvi%3D3%26pl%3D48%26initcwndbps%3D2915000%26vprv%3D1%26svpuc%3D1%26mime%3Dvideo%252Fmp4%26rqh%3D1%26gir%3Dyes%26clen%3D58601154%26dur%3D212.091%26lmt%3D1706574405848131%26mt%3D1760878110%26fvip%3D4%26keepalive%3Dyes%26c%3DWEB%26sefc%3D1%26txp%3D5535434%26n%3D-B63KNLKZNjKqDaG%26sparams%3Dexpire%252Cei%252Cip%252Cid%252Citag%252Csource%252Crequiressl%252Cxpc%252Cvprv%252Csvpuc%252Cmime%252Crqh%252Cgir%252Cclen%252Cdur%252Clmt%26lsparams%3Dmh%252Cmm%252Cmn%252Cms%252Cmv%252Cmvi%252Cpl%252Cinitcwndbps%26lsig%3D4EPbp4mpBYBb3Qs408RmkJdVq4xeolrsVlvJXxm6z3bMsAu4H6g_-YmLJ-4yVZhRhAWZe6PlvYMAp4m-"},{"itag":244,"mimeType":"video/webm; codecs\u003d\"vp9\"","bitrate":3926852,"width":854,"height":480,"initRange":{"start":"0","end":"526"},"indexRange":{"start":"741","end":"1260"},"lastModified":"1706574405848131","contentLength":"7979752","quality":"large","fps":25,"qualityLabel":"480p","projectionType":"RECTANGULAR","averageBitrate":1330454,"approxDurationMs":"212040","signatureCipher":"s\u003dW6_n8reIZEuJsAWE8UpMVue8HBdoSkfsswT62zH7zCKi1nuPBXM0Fy2fJ3FhvX2s0CdtdxvtkUduAfU-hYR84VzgwyLawNauthmw3TsJkpjY\u0026sp\u003dsig\u0026url\u003dhttps%3A%2F%2Frr3---sn-2gb7sn7k.googlevideo.com%2Fvideoplayback%3Fexpire%3D1760900000%26ei%3DYybbdvh5fPOC0EnntQQg%26ip%3D2001%253A718%253A1%253A0%253A0%253A0%253A0%253A1%26id%3Do-W8xheU9KYtB-H13Oyo0mtzJ7YJg4OhIesjfp0GJASZcN%26itag%3D244%26source%3Dyoutube%26requiressl%3Dyes%26xpc%3DZtVLVy6CNpaw1cNFLImZX4XLsJ-T%26mh%3D7c%26mm%3D31%252C29%26mn%3Dsn-2gb7sn7k%252Csn-2gb7sn7l%26ms%3Dau%252Crdu%26mv%3Dm%26mvi%3D3%26pl%3D48%26initcwndbps%3D2915000%26vprv%3D1%26svpuc%3D1%26mime%3Dvideo%252Fwebm%26rqh%3D1%26gir%3Dyes%26clen%3D7979752%26dur%3D212.091%26lmt%3D1706574405848131%26mt%3D1760878110%26fvip%3D4%26keepalive%3Dyes%26c%3DWEB%26sefc%3D1%26txp%3D5535434%26n%3DSec-jzHdmtIWUD5O%26sparams%3Dexpire%252Cei%252Cip%252Cid%252Citag%252Csource%252Crequiressl%252Cxpc%252Cvprv%252Csvpuc%252Cmime%252Crqh%252Cgir%252Cclen%252Cdur%252Clmt%26lsparams%3Dmh%252Cmm%252Cmn%252Cms%252Cmv%252Cmvi%252Cpl%252Cinitcwndbps%26lsig%3DeNWRob2DlL4f6ePzUciMQ70DxOe1VLJ8DWepq86lJNtHCtoEIWhPDk8A1xGgrTtaIpmwTxgKb-LxnJof"},{"itag":134,"mimeType":"video/mp4; codecs\u003d\"avc1.4d401e\"","bitrate":1027307,"width":640,"height":360,"initRange":{"start":"0","end":"730"},"indexRange":{"start":"741","end":"1260"},"lastModified":"1706574405848131","contentLength":"28203721","quality":"large","fps":25,"qualityLabel":"360p","projectionType":"RECTANGULAR","averageBitrate":2536516,"approxDurationMs":"212040","signatureCipher":"s\u003dy7lSTAeW6v1y4mzwmKoNKx2h7mMd69UNw_b4mCklJRYFF90xw3BTAw05NfWWvOtsDnuGj-qAawEgAKfp8I9yAwCm5RzfT3MIJOfCfpo5F0cJ\u0026sp\u003dsig\u0026url\u003dhttps%3A%2F%2Frr3---sn-2gb7sn7k.googlevideo.com%2Fvideoplayback%3Fexpire%3D1760900000%26ei%3DrO8fwWoVtvqMW4KrWscL%26ip%3D2001%253A718%253A1%253A0%253A0%253A0%253A0%253A1%26id%3Do-Q8m7lMyIYNJegoZWVOTZrpeJWzBfjnGv6vqmr4MrYh9c%26itag%3D134%26source%3Dyoutube%26requiressl%3Dyes%26xpc%3D5nZuN8O_XrTGqHjAemvhW4QToubn%26mh%3D7c%26mm%3D31%252C29%26mn%3Dsn-2gb7sn7k%252Csn-2gb7sn7l%26ms%3Dau%252Crdu%26mv%3Dm%26mvi%3D3%26pl%3D48%26initcwndbps%3D2915000%26vprv%3D1%26svpuc%3D1%26mime%3Dvideo%252Fmp4%26rqh%3D1%26gir%3Dyes%26clen%3D28203721%26dur%3D212.091%26lmt%3D1706574405848131%26mt%3D1760878110%26fvip%3D4%26keepalive%3Dyes%26c%3DWEB%26sefc%3D1%26txp%3D5535434%26n%3Dp2K1dPgNRC-4hpka%26sparams%3Dexpire%252Cei%252Cip%252Cid%252Citag%252Csource%252Crequiressl%252Cxpc%252Cvprv%252Csvpuc%252Cmime%252Crqh%252Cgir%252Cclen%252Cdur%252Clmt%26lsparams%3Dmh%252Cmm%252Cmn%252Cms%252Cmv%252Cmvi%252Cpl%252Cinitcwndbps%26lsig%3DkzJCP2LSU5eiq2HyeBwjkgUtCcKWQbJ1B408eLphsDbe58C_7rVrLsDg34ovMDgSMl4l5-KjlGt2jcrT"},{"itag":243,"mimeType":"video/webm; codecs\u003d\"vp9\"","bitrate":2097694,"width":640,"height":360,"initRange":{"start":"0","end":"408"},"indexRange":{"start":"741","end":"1260"},"lastModified":"1706574405848131","contentLength":"34165905","quality":"large","fps":25,"qualityLabel":"360p","projectionType":"RECTANGULAR","averageBitrate":2437021,"approxDurationMs":"212040","signatureCipher":"s\u003dvIBC-2kywiv6G2MXfTosIYkzhspbAC5Lon3NQPsOWQYY6-maonttYvuQkjY1u76MKB2454tl7tEgUPGLGkv57oAAan6mwdpztZ_eYbQIh6mR\u0026sp\u003dsig\u0026url\u003dhttps%3A%2F%2Frr3---sn-2gb7sn7k.googlevideo.com%2Fvideoplayback%3Fexpire%3D1760900000%26ei%3D8P1w7leF-LhJewC4RxGO%26ip%3D2001%253A718%253A1%253A0%253A0%253A0%253A0%253A1%26id%3Do-_82qEnPBitjfMtJ8gJw4LAnpqozRmujf6OTtfvKtamYT%26itag%3D243%26source%3Dyoutube%26requiressl%3Dyes%26xpc%3DCKyOHa_1suezJ0wZbx8ZAvvFHroN%26mh%3D7c%26mm%3D31%252C29%26mn%3Dsn-2gb7sn7k%252Csn-2gb7sn7l%26ms%3Dau%252Crdu%26mv%3Dm%26mvi%3D3%26pl%3D48%26initcwndbps%3D2915000%26vprv%3D1%26svpuc%3D1%26mime%3Dvideo%252Fwebm%26rqh%3D1%26gir%3Dyes%26clen%3D34165905%26dur%3D212.091%26lmt%3D1706574405848131%26mt%3D1760878110%26fvip%3D4%26keepalive%3Dyes%26c%3DWEB%26sefc%3D1%26txp%3D5535434%26n%3Da7Yipus23zXwhy_l%26sparams%3Dexpire%252Cei%252Cip%252Cid%252Citag%252Csource%252Crequiressl%252Cxpc%252Cvprv%252Csvpuc%252Cmime%252Crqh%252Cgir%252Cclen%252Cdur%252Clmt%26lsparams%3Dmh%252Cmm%252Cmn%252Cms%252Cmv%252Cmvi%252Cpl%252Cinitcwndbps%26lsig%3DCJ4MMOv-gibM99k_CBYe2u5TokvZVhA0LJXxpcyEFhfFqNJkrb8N8iJZFUbyJNDx4Dj8cSu4p6jv0yGz"},{"itag":133,"mimeType":"video/mp4; codecs\u003d\"avc1.4d4015\"","bitrate":2489843,"width":426,"height":240,"initRange":{"start":"0","end":"299"},"indexRange":{"start":"741","end":"1260"},"lastModified":"1706574405848131","contentLength":"63193415","quality":"large","fps":25,"qualityLabel":"240p","projectionType":"RECTANGULAR","averageBitrate":2445162,"approxDurationMs":"212040","signatureCipher":"s\u003dvQCiZXLhR9fiPVkWCl-ZyC8Zh6J5wlr-bvOdKLIa3MbeWVnJWkmT5vGFYt5rmwEDsAzzKWVSQuiKNW6exNFjZ4mFfi67WoWYzX2O5nUcd8ZF\u0026sp\u003dsig\u0026url\u003dhttps%3A%2F%2Frr3---sn-2gb7sn7k.googlevideo.com%2Fvideoplayback%3Fexpire%3D1760900000%26ei%3DXdzjqnldDkZku2wod5zY%26ip%3D2001%253A718%253A1%253A0%253A0%253A0%253A0%253A1%26id%3Do-tTsGmIg7OObSrYbDjnaCxTFnqrW4vhcXhPW_tv34wurV%26itag%3D133%26source%3Dyoutube%26requiressl%3Dyes%26xpc%3DEw8mxJV5GJVlcSlSnXkutIqV2ojE%26mh%3D7c%26mm%3D31%252C29%26mn%3Dsn-2gb7sn7k%252Csn-2gb7sn7l%26ms%3Dau%252Crdu%26mv%3Dm%26mvi%3D3%26pl%3D48%26initcwndbps%3D2915000%26vprv%3D1%26svpuc%3D1%26mime%3Dvideo%252Fmp4%26rqh%3D1%26gir%3Dyes%26clen%3D63193415%26dur%3D212.091%26lmt%3D1706574405848131%26mt%3D1760878110%26fvip%3D4%26keepalive%3Dyes%26c%3DWEB%26sefc%3D1%26txp%3D5535434%26n%3D816lNWE0U-zlPcPd%26sparams%3Dexpire%252Cei%252Cip%252Cid%252Citag%252Csource%252Crequiressl%252Cxpc%252Cvprv%252Csvpuc%252Cmime%252Crqh%252Cgir%252Cclen%252Cdur%252Clmt%26lsparams%3Dmh%252Cmm%252Cmn%252Cms%252Cmv%252Cmvi%252Cpl%252Cinitcwndbps%26lsig%3DrKy1gTYFl_N-hHcSK2ElhkRoCcRf_3HTt6L3M6fdibMBVtJAo4MWTfnSwkZRZHN0eI_Td5QMm3FDDFfv"},{"itag":242,"mimeType":"video/webm; codecs\u003d\"vp9\"","bitrate":2942336,"width":426,"height":240,"initRange":{"start":"0","end":"465"},"indexRange":{"start":"741","end":"1260"},"lastModified":"1706574405848131","contentLength":"6018591","quality":"large","fps":25,"qualityLabel":"240p","projectionType":"RECTANGULAR","averageBitrate":129969,"approxDurationMs":"212040","signatureCipher":"s\u003dP_4OfzGWzL8GXgiek8vo5D28y5_mJvQ0YV8ih4u_2ADIYvwTCfUYPdkXC-fOGfeUWogBLPne1lRh7py4Oc2DWJQ9aPN48Lv_F3JW1EW0tWK1\u0026sp\u003dsig\u0026url\u003dhttps%3A%2F%2Frr3---sn-2gb7sn7k.googlevideo.com%2Fvideoplayback%3Fexpire%3D1760900000%26ei%3DzKtsbqq_u2LAX2U44OyS%26ip%3D2001%253A718%253A1%253A0%253A0%253A0%253A0%253A1%26id%3Do-tJ6u5mDmjki3rK5Y5BM1sdgAib0Do6hMcgkDPsTvDkXX%26itag%3D242%26source%3Dyoutube%26requiressl%3Dyes%26xpc%3DYDwFKqOFEpi95Lai85Xm9aSy6Ki8%26mh%3D7c%26mm%3D31%252C29%26mn%3Dsn-2gb7sn7k%252Csn-2gb7sn7l%26ms%3Dau%252Crdu%26mv%3Dm%26mvi%3D3%26pl%3D48%26initcwndbps%3D2915000%26vprv%3D1%26svpuc%3D1%26mime%3Dvideo%252Fwebm%26rqh%3D1%26gir%3Dyes%26clen%3D6018591%26dur%3D212.091%26lmt%3D1706574405848131%26mt%3D1760878110%26fvip%3D4%26keepalive%3Dyes%26c%3DWEB%26sefc%3D1%26txp%3D5535434%26n%3D67NR06v6vuiduZba%26sparams%3Dexpire%252Cei%252Cip%252Cid%252Citag%252Csource%252Crequiressl%252Cxpc%252Cvprv%252Csvpuc%252Cmime%252Crqh%252Cgir%252Cclen%252Cdur%252Clmt%26lsparams%3Dmh%252Cmm%252Cmn%252Cms%252Cmv%252Cmvi%252Cpl%252Cinitcwndbps%26lsig%3D8AtXmGeEBL1stemk3wSVjBd3kD87nIy3VG6T9-rHYpPuX2fCgZeh0uOAeCyfUFbU3e3oJAOcjfIQH2Zd"},{"itag":160,"mimeType":"video/mp4; codecs\u003d\"avc1.4d400c\"","bitrate":1869264,"width":256,"height":144,"initRange":{"start":"0","end":"257"},"indexRange":{"start":"741","end":"1260"},"lastModified":"1706574405848131","contentLength":"49938681","quality":"large","fps":25,"qualityLabel":"144p","projectionType":"RECTANGULAR","averageBitrate":102594,"approxDurationMs":"212040","signatureCipher":"s\u003dIeEJ_TjP1_DtK8LNoApOsQalma1qrp8fPT0KbvEXaFeiPQWt1Pw5xplJ7gtBT3INPgxq_bJGCWDlTK2In04_oF5mVDEMk1WXurlUq2tP-SrA\u0026sp\u003dsig\u0026url\u003dhttps%3A%2F%2Frr3---sn-2gb7sn7k.googlevideo.com%2Fvideoplayback%3Fexpire%3D1760900000%26ei%3Ds-bl1d6VMk7QPxGS0P6J%26ip%3D2001%253A718%253A1%253A0%253A0%253A0%253A0%253A1%26id%3Do-AKpYHmsw21MOFYzkR3lSIfqWHDYBUgydprPtjXD9zw_I%26itag%3D160%26source%3Dyoutube%26requiressl%3Dyes%26xpc%3DnzpJQ8HlCznvsj1J9hjfAnoQmZRw%26mh%3D7c%26mm%3D31%252C29%26mn%3Dsn-2gb7sn7k%252Csn-2gb7sn7l%26ms%3Dau%252Crdu%26mv%3Dm%26mvi%3D3%26pl%3D48%26initcwndbps%3D2915000%26vprv%3D1%26svpuc%3D1%26mime%3Dvideo%252Fmp4%26rqh%3D1%26gir%3Dyes%26clen%3D49938681%26dur%3D212.091%26lmt%3D1706574405848131%26mt%3D1760878110%26fvip%3D4%26keepalive%3Dyes%26c%3DWEB%26sefc%3D1%26txp%3D5535434%26n%3DHgB7qwjvz115r0cM%26sparams%3Dexpire%252Cei%252Cip%252Cid%252Citag%252Csource%252Crequiressl%252Cxpc%252Cvprv%252Csvpuc%252Cmime%252Crqh%252Cgir%252Cclen%252Cdur%252Clmt%26lsparams%3Dmh%252Cmm%252Cmn%252Cms%252Cmv%252Cmvi%252Cpl%252Cinitcwndbps%26lsig%3DxX4dRbT_PL-wAjd8S2joUgSCjhOdpku8eGYxjoOR9-Jwy8eSZtcvqSFnjXUGBjprccJoow2lQMuECnmB"},{"itag":278,"mimeType":"video/webm; codecs\u003d\"vp9\"","bitrate":1768463,"width":256,"height":144,"initRange":{"start":"0","end":"503"},"indexRange":{"start":"741","end":"1260"},"lastModified":"1706574405848131","contentLength":"61107391","quality":"large","fps":25,"qualityLabel":"144p","projectionType":"RECTANGULAR","averageBitrate":1636335,"approxDurationMs":"212040","signatureCipher":"s\u003dc0ezdcg4nxKbqB9ssfdkHuI8rZuQMc6enIxv76dsCkWKdrYeAwZMChbK6EBQhnUwtLomaZY820zdIS4DyT9tRMc0PYoFqUdBKh-px729mteY\u0026sp\u003dsig\u0026url\u003dhttps%3A%2F%2Frr3---sn-2gb7sn7k.googlevideo.com%2Fvideoplayback%3Fexpire%3D1760900000%26ei%3DM3R77i1KmiNYiV9roAcT%26ip%3D2001%253A718%253A1%253A0%253A0%253A0%253A0%253A1%26id%3Do-LxOTHvBgcFnmXZ0E9se0OwJnhcqrCSMsK74Wp9lRPWBO%26itag%3D278%26source%3Dyoutube%26requiressl%3Dyes%26xpc%3DpqXo01fHq8TEyTA4tzDf46fKJBYV%26mh%3D7c%26mm%3D31%252C29%26mn%3Dsn-2gb7sn7k%252Csn-2gb7sn7l%26ms%3Dau%252Crdu%26mv%3Dm%26mvi%3D3%26pl%3D48%26initcwndbps%3D2915000%26vprv%3D1%26svpuc%3D1%26mime%3Dvideo%252Fwebm%26rqh%3D1%26gir%3Dyes%26clen%3D61107391%26dur%3D212.091%26lmt%3D1706574405848131%26mt%3D1760878110%26fvip%3D4%26keepalive%3Dyes%26c%3DWEB%26sefc%3D1%26txp%3D5535434%26n%3Dqndjuv2WhcC2DJCa%26sparams%3Dexpire%252Cei%252Cip%252Cid%252Citag%252Csource%252Crequiressl%252Cxpc%252Cvprv%252Csvpuc%252Cmime%252Crqh%252Cgir%252Cclen%252Cdur%252Clmt%26lsparams%3Dmh%252Cmm%252Cmn%252Cms%252Cmv%252Cmvi%252Cpl%252Cinitcwndbps%26lsig%3DlcctL_CHBoRrTdvQTRjgkBYiXqlAbNQ263E2atCTm0mmgr_mKIRpbuG0cVRMmdolqdZBCswL3bMHgW3A"},{"itag":140,"mimeType":"audio/mp4; codecs\u003d\"mp4a.40.2\"","bitrate":140134,"initRange":{"start":"0","end":"258"},"indexRange":{"start":"259","end":"554"},"lastModified":"1706572713211413","contentLength":"3087145","quality":"tiny","projectionType":"RECTANGULAR","averageBitrate":129479,"highReplication":true,"audioQuality":"AUDIO_QUALITY_MEDIUM","approxDurationMs":"212091","audioSampleRate":"44100","audioChannels":2,"loudnessDb":-2.789999008178711,"signatureCipher":"s\u003dNrDRBxHzaf9R97F9aKxT3o2HgsaxErDW6wxllinLJ080LvwQ0yxaBzIyO7pkYG-Iz-lDU_c6ZmdU_vckwxApQzUB62Hc1MMqhOzdToHvtOqf\u0026sp\u003dsig\u0026url\u003dhttps%3A%2F%2Frr3---sn-2gb7sn7k.googlevideo.com%2Fvideoplayback%3Fexpire%3D1760900000%26ei%3DC3eYgYHYFSnSNunhV3tH%26ip%3D2001%253A718%253A1%253A0%253A0%253A0%253A0%253A1%26id%3Do-w1tBUE6Qy4ahKNAk9zvdVnm-TAQ6EeIGbCW-sx9M9tzt%26itag%3D140%26source%3Dyoutube%26requiressl%3Dyes%26xpc%3D2mMs6HI8zbuymKoKxcU39Vo-drVm%26mh%3D7c%26mm%3D31%252C29%26mn%3Dsn-2gb7sn7k%252Csn-2gb7sn7l%26ms%3Dau%252Crdu%26mv%3Dm%26mvi%3D3%26pl%3D48%26initcwndbps%3D2915000%26vprv%3D1%26svpuc%3D1%26mime%3Daudio%252Fmp4%26rqh%3D1%26gir%3Dyes%26clen%3D3087145%26dur%3D212.091%26lmt%3D1706574405848131%26mt%3D1760878110%26fvip%3D4%26keepalive%3Dyes%26c%3DWEB%26sefc%3D1%26txp%3D5535434%26n%3DYrPiKXz4aQpkcGFb%26sparams%3Dexpire%252Cei%252Cip%252Cid%252Citag%252Csource%252Crequiressl%252Cxpc%252Cvprv%252Csvpuc%252Cmime%252Crqh%252Cgir%252Cclen%252Cdur%252Clmt%26lsparams%3Dmh%252Cmm%252Cmn%252Cms%252Cmv%252Cmvi%252Cpl%252Cinitcwndbps%26lsig%3DhhquqLgBZ7jzSDMPy-3O6IdLrCh_uoOQ8-tgrTakkQcSbwL21-dgqcU4iRLlebdcBfCIZyguhUf0yt-u"},{"itag":251,"mimeType":"audio/webm; codecs\u003d\"opus\"","bitrate":158159,"initRange":{"start":"0","end":"258"},"indexRange":{"start":"259","end":"554"},"lastModified":"1706572713211413","contentLength":"2327515","quality":"tiny","projectionType":"RECTANGULAR","averageBitrate":129479,"highReplication":true,"audioQuality":"AUDIO_QUALITY_MEDIUM","approxDurationMs":"212091","audioSampleRate":"48000","audioChannels":2,"loudnessDb":-2.789999008178711,"signatureCipher":"s\u003dvoYcOOV4L9uUkElUirFpaqJr-l2tAPzEJULgmc1WBfd4pca5hGm1OnCLGq89_DrJhOLhO8HTtBwEm3-s3am1_qt5VVYO2YeqcN0WN4A7RFsN\u0026sp\u003dsig\u0026url\u003dhttps%3A%2F%2Frr3---sn-2gb7sn7k.googlevideo.com%2Fvideoplayback%3Fexpire%3D1760900000%26ei%3DFZSXv1Qxu-ENO6Q8RWS0%26ip%3D2001%253A718%253A1%253A0%253A0%253A0%253A0%253A1%26id%3Do-owUwHpZSNp0MRQDikogqDZdGwjLN6ENw7N4xJbY6fsr-%26itag%3D251%26source%3Dyoutube%26requiressl%3Dyes%26xpc%3DvUoaPDxFuwFPaQ_7Gk8qfkusNgIZ%26mh%3D7c%26mm%3D31%252C29%26mn%3Dsn-2gb7sn7k%252Csn-2gb7sn7l%26ms%3Dau%252Crdu%26mv%3Dm%26mvi%3D3%26pl%3D48%26initcwndbps%3D2915000%26vprv%3D1%26svpuc%3D1%26mime%3Daudio%252Fwebm%26rqh%3D1%26gir%3Dyes%26clen%3D2327515%26dur%3D212.091%26lmt%3D1706574405848131%26mt%3D1760878110%26fvip%3D4%26keepalive%3Dyes%26c%3DWEB%26sefc%3D1%26txp%3D5535434%26n%3DsTskZ5PgGkiJ4P9h%26sparams%3Dexpire%252Cei%252Cip%252Cid%252Citag%252Csource%252Crequiressl%252Cxpc%252Cvprv%252Csvpuc%252Cmime%252Crqh%252Cgir%252Cclen%252Cdur%252Clmt%26lsparams%3Dmh%252Cmm%252Cmn%252Cms%252Cmv%252Cmvi%252Cpl%252Cinitcwndbps%26lsig%3D8o4nv3wuS4nldUcyOo3mKeP_VPP29Fdn2YNmneuygEpee2q5qj0UFl4f4pQUsjeVApfXZVoFVIBXwYo8"},{"itag":250,"mimeType":"audio/webm; codecs\u003d\"opus\"","bitrate":116832,"initRange":{"start":"0","end":"258"},"indexRange":{"start":"259","end":"554"},"lastModified":"1706572713211413","contentLength":"1057138","quality":"tiny","projectionType":"RECTANGULAR","averageBitrate":129479,"highReplication":true,"audioQuality":"AUDIO_QUALITY_MEDIUM","approxDurationMs":"212091","audioSampleRate":"48000","audioChannels":2,"loudnessDb":-2.789999008178711,"signatureCipher":"s\u003dEG54-htw9SbCBGTxWMgDVJVmH_YhF8gYJvh57qMNmf2yoGW22NTsTKF_ei1EUcmaR7iQAyoQ8_rfAkoDRnD0fTg-xRJH4NUEh_zWHLtq7U-g\u0026sp\u003dsig\u0026url\u003dhttps%3A%2F%2Frr3---sn-2gb7sn7k.googlevideo.com%2Fvideoplayback%3Fexpire%3D1760900000%26ei%3DuIubuO9_mHy0ZbzjXpkt%26ip%3D2001%253A718%253A1%253A0%253A0%253A0%253A0%253A1%26id%3Do-1DYxLbla_sEHz0e0RKisWj9IhUILf7ls7W6cF3H8i1Gc%26itag%3D250%26source%3Dyoutube%26requiressl%3Dyes%26xpc%3DygoDNfZbk8OMC3Ts_ydXeDQLSURD%26mh%3D7c%26mm%3D31%252C29%26mn%3Dsn-2gb7sn7k%252Csn-2gb7sn7l%26ms%3Dau%252Crdu%26mv%3Dm%26mvi%3D3%26pl%3D48%26initcwndbps%3D2915000%26vprv%3D1%26svpuc%3D1%26mime%3Daudio%252Fwebm%26rqh%3D1%26gir%3Dyes%26clen%3D1057138%26dur%3D212.091%26lmt%3D1706574405848131%26mt%3D1760878110%26fvip%3D4%26keepalive%3Dyes%26c%3DWEB%26sefc%3D1%26txp%3D5535434%26n%3DU7VBMAiv51gokbvd%26sparams%3Dexpire%252Cei%252Cip%252Cid%252Citag%252Csource%252Crequiressl%252Cxpc%252Cvprv%252Csvpuc%252Cmime%252Crqh%252Cgir%252Cclen%252Cdur%252Clmt%26lsparams%3Dmh%252Cmm%252Cmn%252Cms%252Cmv%252Cmvi%252Cpl%252Cinitcwndbps%26lsig%3DfgImuBlU2l6Q0ug6A4ZcyYrpowypQpFFr07lfhWHNaey6CdhEmR3jXObWMjAsuWgDXfFl1vm4zq3Wjc4"},{"itag":249,"mimeType":"audio/webm; codecs\u003d\"opus\"","bitrate":144342,"initRange":{"start":"0","end":"258"},"indexRange":{"start":"259","end":"554"},"lastModified":"1706572713211413","contentLength":"1214783","quality":"tiny","projectionType":"RECTANGULAR","averageBitrate":129479,"highReplication":true,"audioQuality":"AUDIO_QUALITY_MEDIUM","approxDurationMs":"212091","audioSampleRate":"48000","audioChannels":2,"loudnessDb":-2.789999008178711,"signatureCipher":"s\u003dVTjzlYFWwiidKXuwaUbTZOGK3oQB511l9fSBvGljnA4FrOdHiqi-ujVajjdOQJD6GYsYBGZGRRo30XyP5GbICZtX5LTiOm5qL1PA--3Rn4Ac\u0026sp\u003dsig\u0026url\u003dhttps%3A%2F%2Frr3---sn-2gb7sn7k.googlevideo.com%2Fvideoplayback%3Fexpire%3D1760900000%26ei%3DArXzntd_StLAJHW69GDl%26ip%3D2001%253A718%253A1%253A0%253A0%253A0%253A0%253A1%26id%3Do-MWHa8V-k_4Jyqp2j2fwqrH1D23c1j-kfB-TrwUwitAqV%26itag%3D249%26source%3Dyoutube%26requiressl%3Dyes%26xpc%3DYj86HvOD72zcYRT5mTaxNXqJxsgO%26mh%3D7c%26mm%3D31%252C29%26mn%3Dsn-2gb7sn7k%252Csn-2gb7sn7l%26ms%3Dau%252Crdu%26mv%3Dm%26mvi%3D3%26pl%3D48%26initcwndbps%3D2915000%26vprv%3D1%26svpuc%3D1%26mime%3Daudio%252Fwebm%26rqh%3D1%26gir%3Dyes%26clen%3D1214783%26dur%3D212.091%26lmt%3D1706574405848131%26mt%3D1760878110%26fvip%3D4%26keepalive%3Dyes%26c%3DWEB%26sefc%3D1%26txp%3D5535434%26n%3DX9jJ_2hAPT8jyUBi%26sparams%3Dexpire%252Cei%252Cip%252Cid%252Citag%252Csource%252Crequiressl%252Cxpc%252Cvprv%252Csvpuc%252Cmime%252Crqh%252Cgir%252Cclen%252Cdur%252Clmt%26lsparams%3Dmh%252Cmm%252Cmn%252Cms%252Cmv%252Cmvi%252Cpl%252Cinitcwndbps%26lsig%3Dys767FIIYbL-j_gs021816G0BkGP6XSZWzt9P9ji8H6GHfy_OcVjS-TtRTS-SnGLBvkkYA7pIchz9xGC"}],"serverAbrStreamingUrl":"https://rr3---sn-2gb7sn7k.googlevideo.com/videoplayback?expire\u003d1760900000\u0026ei\u003decDPhu9PlcKNRh2e8Nfv\u0026c\u003dWEB\u0026n\u003d_-soxpMw1D1_SZyr\u0026sparams\u003dexpire,ei,ip,id,source,requiressl,xpc\u0026lsig\u003dNnN4e_x_imakxI3TXonB1kWQP8lUMjYFfsRYqQcrkQLhyrlzWb7asO1BXkID1ju-Ruoty4EG4KilrKN0"},"playbackTracking":{"videostatsPlaybackUrl":{"baseUrl":"https://s.youtube.com/api/stats/videostatsPlaybackUrl?cl\u003d602124051\u0026docid\u003ddQw4w9WgXcQ\u0026ei\u003dDPGHqhSJx_-I1ZfxUFiPho\u0026fexp\u003dv1%2C24004644%2C434717%2C127326%2C26443548%2C53408%2C34656%2C106030%2C18644%2C14869%2C75925%2C26895%2C58316%2C45513%2C55108%2C36945%2C10906%2C2\u0026ns\u003dyt\u0026plid\u003d-5z8f9tvG0WDs1ANgikJNr\u0026el\u003ddetailpage\u0026len\u003d213\u0026of\u003d4d1fBTUxz1_anOdLZmhzmK\u0026vm\u003dD0slL1l0A8f3hEGAkKXOHw76nGpWlBm7AsPZ2qgpPJI03mGkb4yU8AfjKJW1"},"videostatsDelayplayUrl":{"baseUrl":"https://s.youtube.com/api/stats/videostatsDelayplayUrl?cl\u003d602124051\u0026docid\u003ddQw4w9WgXcQ\u0026ei\u003dYgZFNwrlsm_OYXFKIeNv1K\u0026fexp\u003dv1%2C24004644%2C434717%2C127326%2C26443548%2C53408%2C34656%2C106030%2C18644%2C14869%2C75925%2C26895%2C58316%2C45513%2C55108%2C36945%2C10906%2C2\u0026ns\u003dyt\u0026plid\u003dItW5mbbNtPPUfqhd4tPVkD\u0026el\u003ddetailpage\u0026len\u003d213\u0026of\u003dKIXrNs76vBzc6rl5kyPX9Q\u0026vm\u003d1tXV1NA7er--P7_GQn6UXQbRVJYtLb1t4l7FJ0sYp6fudPORezzaT9jbgQEd"},"videostatsWatchtimeUrl":{"baseUrl":"https://s.youtube.com/api/stats/videostatsWatchtimeUrl?cl\u003d602124051\u0026docid\u003ddQw4w9WgXcQ\u0026ei\u003dxYcnPA8fMLV7xfvLOihDCx\u0026fexp\u003dv1%2C24004644%2C434717%2C127326%2C26443548%2C53408%2C34656%2C106030%2C18644%2C14869%2C75925%2C26895%2C58316%2C45513%2C55108%2C36945%2C10906%2C2\u0026ns\u003dyt\u0026plid\u003d545G8uqLflUXsoYN0FCMC1\u0026el\u003ddetailpage\u0026len\u003d213\u0026of\u003duGgnMlWVhyecCNIVh4TnL4\u0026vm\u003dGkBsGpw3Ay5WsDYFBNdRywW4mesoa2tb7aWIv33otmLgqQsplF_avHvH39d_"},"ptrackingUrl":{"baseUrl":"https://s.youtube.com/api/stats/ptrackingUrl?cl\u003d602124051\u0026docid\u003ddQw4w9WgXcQ\u0026ei\u003dGZys8jzhk6o1sHzT2a41j3\u0026fexp\u003dv1%2C24004644%2C434717%2C127326%2C26443548%2C53408%2C34656%2C106030%2C18644%2C14869%2C75925%2C26895%2C58316%2C45513%2C55108%2C36945%2C10906%2C2\u0026ns\u003dyt\u0026plid\u003dnKM4ROdWZ6IYGc-dQDp-j5\u0026el\u003ddetailpage\u0026len\u003d213\u0026of\u003dXMDtfSszNwg565qObEGoHR\u0026vm\u003dEzt0PcbeljRUX3rrP6Fa2PDaHy-cYZD3rkfzxIMDHZekKWpxAfP5SnjNmf_Y"},"qoeUrl":{"baseUrl":"https://s.youtube.com/api/stats/qoeUrl?cl\u003d602124051\u0026docid\u003ddQw4w9WgXcQ\u0026ei\u003d3Ic0tqyeGUbe2g-mt9CTAZ\u0026fexp\u003dv1%2C24004644%2C434717%2C127326%2C26443548%2C53408%2C34656%2C106030%2C18644%2C14869%2C75925%2C26895%2C58316%2C45513%2C55108%2C36945%2C10906%2C2\u0026ns\u003dyt\u0026plid\u003d6hDUec2EBGOXvo_Rgxv4dw\u0026el\u003ddetailpage\u0026len\u003d213\u0026of\u003de5SpwT_2ImkcRCkv_ZuDr2\u0026vm\u003d3g9KFPmOVOK6UHFhO-Hw4Th2viKVxOmR_Du-j182VNZuv9AlL7lykflFwkVC"},"atrUrl":{"baseUrl":"https://s.youtube.com/api/stats/atrUrl?cl\u003d602124051\u0026docid\u003ddQw4w9WgXcQ\u0026ei\u003dmUEMn42EdfL9z2brDYQUWr\u0026fexp\u003dv1%2C24004644%2C434717%2C127326%2C26443548%2C53408%2C34656%2C106030%2C18644%2C14869%2C75925%2C26895%2C58316%2C45513%2C55108%2C36945%2C10906%2C2\u0026ns\u003dyt\u0026plid\u003dHdWNwKQ12wVDptfTHZSHfA\u0026el\u003ddetailpage\u0026len\u003d213\u0026of\u003dyKaFclaarnqFYuLz5re9KV\u0026vm\u003dlHnsGvJcbwE91KjC7fCtu6W7F4yoZocrCZdkv6MfPwks6FP5Js7wMIi2MJ5b"},"videostatsScheduledFlushWalltimeSeconds":[10,20,30],"videostatsDefaultFlushIntervalSeconds":40},"captions":{"playerCaptionsTracklistRenderer":{"captionTracks":[{"baseUrl":"https://www.youtube.com/api/timedtext?v\u003ddQw4w9WgXcQ\u0026ei\u003duSbdNHQrbsRDEb4und1_FJ\u0026caps\u003dasr\u0026opi\u003d112496729\u0026xoaf\u003d5\u0026hl\u003den\u0026ip\u003d0.0.0.0\u0026ipbits\u003d0\u0026expire\u003d1760903745\u0026sparams\u003dip,ipbits,expire,v,ei,caps,opi,xoaf\u0026signature\u003dCX5JpK7xTjbs7b8eKEHZt0iBkIARg0eukBG7lJQZ\u0026key\u003dyt8\u0026lang\u003den","name":{"simpleText":"English"},"vssId":".en","languageCode":"en","isTranslatable":true,"trackName":""},{"baseUrl":"https://www.youtube.com/api/timedtext?v\u003ddQw4w9WgXcQ\u0026ei\u003dYN6RSRmlbY2-bloDJYrVdX\u0026caps\u003dasr\u0026opi\u003d112496729\u0026xoaf\u003d5\u0026hl\u003den\u0026ip\u003d0.0.0.0\u0026ipbits\u003d0\u0026expire\u003d1760903745\u0026sparams\u003dip,ipbits,expire,v,ei,caps,opi,xoaf\u0026signature\u003dVxqrG4naxrrc8RgsWTuHZA4e1nXQUz9vl_4vNoC7\u0026key\u003dyt8\u0026lang\u003dde-DE","name":{"simpleText":"German (Germany)"},"vssId":".de-DE","languageCode":"de-DE","isTranslatable":true,"trackName":""},{"baseUrl":"https://www.youtube.com/api/timedtext?v\u003ddQw4w9WgXcQ\u0026ei\u003dG9u2Qvln1zh3SixAyP22KC\u0026caps\u003dasr\u0026opi\u003d112496729\u0026xoaf\u003d5\u0026hl\u003den\u0026ip\u003d0.0.0.0\u0026ipbits\u003d0\u0026expire\u003d1760903745\u0026sparams\u003dip,ipbits,expire,v,ei,caps,opi,xoaf\u0026signature\u003dbDClAZM5aPWZxtNnl_cMuvqRiWnrh5-lDL9uRTJ0\u0026key\u003dyt8\u0026lang\u003dja","name":{"simpleText":"Japanese"},"vssId":".ja","languageCode":"ja","isTranslatable":true,"trackName":""},{"baseUrl":"https://www.youtube.com/api/timedtext?v\u003ddQw4w9WgXcQ\u0026ei\u003d3NqDYvZxPFxBpcex6H85eD\u0026caps\u003dasr\u0026opi\u003d112496729\u0026xoaf\u003d5\u0026hl\u003den\u0026ip\u003d0.0.0.0\u0026ipbits\u003d0\u0026expire\u003d1760903745\u0026sparams\u003dip,ipbits,expire,v,ei,caps,opi,xoaf\u0026signature\u003d6CNYp7n7tzDgzpwVQGE7JXM6xeCU9byp13iAnmra\u0026key\u003dyt8\u0026lang\u003dpt-BR","name":{"simpleText":"Portuguese (Brazil)"},"vssId":".pt-BR","languageCode":"pt-BR","isTranslatable":true,"trackName":""},{"baseUrl":"https://www.youtube.com/api/timedtext?v\u003ddQw4w9WgXcQ\u0026ei\u003dQ75t_tcxtp3HzB3Zx_pfjd\u0026caps\u003dasr\u0026opi\u003d112496729\u0026xoaf\u003d5\u0026hl\u003den\u0026ip\u003d0.0.0.0\u0026ipbits\u003d0\u0026expire\u003d1760903745\u0026sparams\u003dip,ipbits,expire,v,ei,caps,opi,xoaf\u0026signature\u003d1FNHZ2iwu1bI13DZ2hmprtws8OK6lshNF6JMlxHV\u0026key\u003dyt8\u0026lang\u003des-419","name":{"simpleText":"Spanish (Latin America)"},"vssId":".es-419","languageCode":"es-419","isTranslatable":true,"trackName":""},{"baseUrl":"https://www.youtube.com/api/timedtext?v\u003ddQw4w9WgXcQ\u0026ei\u003dmYOWG2M4Me3n6kyE-KvHlX\u0026caps\u003dasr\u0026opi\u003d112496729\u0026xoaf\u003d5\u0026hl\u003den\u0026ip\u003d0.0.0.0\u0026ipbits\u003d0\u0026expire\u003d1760903745\u0026sparams\u003dip,ipbits,expire,v,ei,caps,opi,xoaf\u0026signature\u003dZqj0wEQdaOdGvtzUbFA82kQdjW3LlBwZvGIyyFtU\u0026key\u003dyt8\u0026lang\u003dru","name":{"simpleText":"Русский"},"vssId":".ru","languageCode":"ru","isTranslatable":true,"trackName":""}],"audioTracks":[{"captionTrackIndices":[0,1,2,3,4,5],"defaultCaptionTrackIndex":0,"visibility":"UNKNOWN","hasDefaultTrack":true,"captionsInitialState":"CAPTIONS_INITIAL_STATE_OFF_RECOMMENDED"}],"translationLanguages":[{"languageCode":"pt","languageName":{"simpleText":"e mnkrsojmxzh"}},{"languageCode":"ef","languageName":{"simpleText":"bdaicqpoc toyg"}},{"languageCode":"cv","languageName":{"simpleText":"zgoozyweztm"}},{"languageCode":"me","languageName":{"simpleText":"pvfmtwyxhnrm"}},{"languageCode":"bg","languageName":{"simpleText":"s jsyh"}},{"languageCode":"eo","languageName":{"simpleText":"j xgr"}},{"languageCode":"wu","languageName":{"simpleText":"ipldhx"}},{"languageCode":"sc","languageName":{"simpleText":"cm izuehcizufm"}},{"languageCode":"gl","languageName":{"simpleText":"lhggqkhvqrcxf"}},{"languageCode":"sr","languageName":{"simpleText":"ghpwe"}},{"languageCode":"wi","languageName":{"simpleText":"aquozein"}},{"languageCode":"jk","languageName":{"simpleText":"sxfntgrfzjlu"}},{"languageCode":"jy","languageName":{"simpleText":"ayyysociuj"}},{"languageCode":"yt","languageName":{"simpleText":"zlxlczl"}},{"languageCode":"vc","languageName":{"simpleText":"z xeb"}},{"languageCode":"wf","languageName":{"simpleText":"szhfbz"}},{"languageCode":"rv","languageName":{"simpleText":"xnvkkug"}},{"languageCode":"it","languageName":{"simpleText":"asqrlrgea"}},{"languageCode":"xq","languageName":{"simpleText":"ppolbuv "}},{"languageCode":"zt","languageName":{"simpleText":"rrkj  knym"}},{"languageCode":"vj","languageName":{"simpleText":"uacfa"}},{"languageCode":"tr","languageName":{"simpleText":"wohhqulbjhm"}},{"languageCode":"zz","languageName":{"simpleText":"rciaehplnvn xn"}},{"languageCode":"eu","languageName":{"simpleText":"fzymo"}},{"languageCode":"ge","languageName":{"simpleText":"stcptfa"}},{"languageCode":"ej","languageName":{"simpleText":"rylsdvygtza"}},{"languageCode":"ma","languageName":{"simpleText":"bndojvrsjwmty"}},{"languageCode":"et","languageName":{"simpleText":" uhqgjfbymbe"}},{"languageCode":"kw","languageName":{"simpleText":"fzwjzo"}},{"languageCode":"wh","languageName":{"simpleText":"ylcklehbt u"}},{"languageCode":"dp","languageName":{"simpleText":"kuanlioqvxh"}},{"languageCode":"yg","languageName":{"simpleText":"dezxaflihfqmpr"}},{"languageCode":"ki","languageName":{"simpleText":"hjoerazz"}},{"languageCode":"ge","languageName":{"simpleText":"uydqzijufxsvn"}},{"languageCode":"fl","languageName":{"simpleText":"tjwopw"}},{"languageCode":"ic","languageName":{"simpleText":"ehbxw"}},{"languageCode":"lf","languageName":{"simpleText":"dhtlkebst"}},{"languageCode":"nd","languageName":{"simpleText":"qwtnbm"}},{"languageCode":"vq","languageName":{"simpleText":"uzrefndbl"}},{"languageCode":"vs","languageName":{"simpleText":"jcwenacvpa"}},{"languageCode":"oa","languageName":{"simpleText":"prldudzzypa"}},{"languageCode":"uu","languageName":{"simpleText":"gkszwnjip"}},{"languageCode":"sx","languageName":{"simpleText":"lfnobdt yuvk"}},{"languageCode":"kt","languageName":{"simpleText":"zplyy"}},{"languageCode":"qc","languageName":{"simpleText":"yojlmrjmk"}},{"languageCode":"nv","languageName":{"simpleText":"eofij"}},{"languageCode":"om","languageName":{"simpleText":"wycbcz"}},{"languageCode":"xb","languageName":{"simpleText":"didsialhmp"}},{"languageCode":"hi","languageName":{"simpleText":"mxvucctxzos"}},{"languageCode":"qg","languageName":{"simpleText":"x szamevufvvox"}},{"languageCode":"fp","languageName":{"simpleText":"wksfthtguzo"}},{"languageCode":"lc","languageName":{"simpleText":"jgyarszdmfshy"}},{"languageCode":"al","languageName":{"simpleText":"fnerkjdmb"}},{"languageCode":"zt","languageName":{"simpleText":"erpqph"}},{"languageCode":"ug","languageName":{"simpleText":"ejyepnbyk"}},{"languageCode":"yc","languageName":{"simpleText":"bl mqkfnd r"}},{"languageCode":"lz","languageName":{"simpleText":"alqwpdfu"}},{"languageCode":"ka","languageName":{"simpleText":"mjqyijzrsx"}},{"languageCode":"di","languageName":{"simpleText":"skazsbpvi"}},{"languageCode":"vf","languageName":{"simpleText":"vuvwmvaiq"}},{"languageCode":"tk","languageName":{"simpleText":"eqkywxukykhhff"}},{"languageCode":"rp","languageName":{"simpleText":"orppkg"}},{"languageCode":"lk","languageName":{"simpleText":"mzart"}},{"languageCode":"sc","languageName":{"simpleText":"qszyik"}},{"languageCode":"yu","languageName":{"simpleText":"rlinmfyhl zqrd"}},{"languageCode":"jj","languageName":{"simpleText":"lassikbw"}},{"languageCode":"ev","languageName":{"simpleText":"p ooijschc qd"}},{"languageCode":"xk","languageName":{"simpleText":"kde tmbeomci"}},{"languageCode":"za","languageName":{"simpleText":"kznpd"}},{"languageCode":"pp","languageName":{"simpleText":"clhwcmnjep"}},{"languageCode":"zh","languageName":{"simpleText":"gnzkjxxi jwzm"}},{"languageCode":"rg","languageName":{"simpleText":"hzbwsawiex k "}},{"languageCode":"oq","languageName":{"simpleText":"ne kgihfxkbhcc"}},{"languageCode":"jn","languageName":{"simpleText":"fjavvlrggeek "}},{"languageCode":"ov","languageName":{"simpleText":"otyerw"}},{"languageCode":"hz","languageName":{"simpleText":"cwrgcgukkmvnby"}},{"languageCode":"zs","languageName":{"simpleText":"s irf"}},{"languageCode":"ec","languageName":{"simpleText":"y tvqohilq"}},{"languageCode":"lo","languageName":{"simpleText":"vlxwyzwelrgl"}},{"languageCode":"ad","languageName":{"simpleText":"jroocr"}},{"languageCode":"ze","languageName":{"simpleText":"nditwjjrgis"}},{"languageCode":"yi","languageName":{"simpleText":"ddpstjke"}},{"languageCode":"kx","languageName":{"simpleText":"temmqterrz"}},{"languageCode":"ej","languageName":{"simpleText":"traw p "}},{"languageCode":"gb","languageName":{"simpleText":"ezwjbwqoqbldbw"}},{"languageCode":"nu","languageName":{"simpleText":"dislsmt"}},{"languageCode":"je","languageName":{"simpleText":"zgoyyesb "}},{"languageCode":"ii","languageName":{"simpleText":"nyutkvnya"}},{"languageCode":"yc","languageName":{"simpleText":"qmkqfoqblboru"}},{"languageCode":"mv","languageName":{"simpleText":"pfajwb"}},{"languageCode":"zf","languageName":{"simpleText":"dukyhxlq"}},{"languageCode":"wb","languageName":{"simpleText":"pkkmfii"}},{"languageCode":"vq","languageName":{"simpleText":"olkztdrgwwc"}},{"languageCode":"qk","languageName":{"simpleText":"khylqdxrzvyt"}},{"languageCode":"uz","languageName":{"simpleText":"srnho"}},{"languageCode":"ro","languageName":{"simpleText":"yndxnvb"}},{"languageCode":"ja","languageName":{"simpleText":"oi lgv"}},{"languageCode":"ew","languageName":{"simpleText":"zo idhtj"}},{"languageCode":"sy","languageName":{"simpleText":"mnazf"}},{"languageCode":"ke","languageName":{"simpleText":"laeuluf"}},{"languageCode":"st","languageName":{"simpleText":"ethpgdxwpre"}},{"languageCode":"mu","languageName":{"simpleText":"gjqeev lbju"}},{"languageCode":"pv","languageName":{"simpleText":"pkp aw"}},{"languageCode":"rc","languageName":{"simpleText":" h cosbufncvv"}},{"languageCode":"ud","languageName":{"simpleText":"pjusc"}},{"languageCode":"kk","languageName":{"simpleText":"razsjqm"}},{"languageCode":"sq","languageName":{"simpleText":"enpkewom"}},{"languageCode":"qu","languageName":{"simpleText":"ghypjzqtxbd"}},{"languageCode":"eh","languageName":{"simpleText":"rnsnadjba"}},{"languageCode":"qm","languageName":{"simpleText":"krngtoaxnt"}},{"languageCode":"ci","languageName":{"simpleText":"tfhygu wrcwa"}},{"languageCode":"vl","languageName":{"simpleText":"oift gclj"}},{"languageCode":"dt","languageName":{"simpleText":"mos ytrxwk"}},{"languageCode":"tu","languageName":{"simpleText":"fmwqv"}},{"languageCode":"gx","languageName":{"simpleText":"zonqh"}},{"languageCode":"ao","languageName":{"simpleText":"nahkjcectioq"}},{"languageCode":"bb","languageName":{"simpleText":"zcovvg zrfo"}},{"languageCode":"mj","languageName":{"simpleText":"gdadnltaks"}},{"languageCode":"fg","languageName":{"simpleText":"qtzagccf"}},{"languageCode":"uv","languageName":{"simpleText":"iokdm"}},{"languageCode":"tx","languageName":{"simpleText":"yqoxllkkidmf"}},{"languageCode":"wh","languageName":{"simpleText":"nsawza"}},{"languageCode":"wb","languageName":{"simpleText":"ewhfd"}},{"languageCode":"ye","languageName":{"simpleText":"tlkunjvtgwd"}},{"languageCode":"cd","languageName":{"simpleText":"zsvjnsq gx"}},{"languageCode":"wo","languageName":{"simpleText":"jjjnqyvac"}},{"languageCode":"iz","languageName":{"simpleText":"ugmqaada"}},{"languageCode":"ur","languageName":{"simpleText":"dhgckyxjr"}},{"languageCode":"eb","languageName":{"simpleText":"lifkvinfoyvpqk"}},{"languageCode":"td","languageName":{"simpleText":"splwxeo q"}},{"languageCode":"vt","languageName":{"simpleText":"fjizlvrfr"}},{"languageCode":"ah","languageName":{"simpleText":"cdq bcb"}},{"languageCode":"hy","languageName":{"simpleText":"hlc paelunzdqf"}},{"languageCode":"xk","languageName":{"simpleText":"kcv sqdpvvi"}},{"languageCode":"da","languageName":{"simpleText":"spol w"}},{"languageCode":"md","languageName":{"simpleText":"cmajl"}},{"languageCode":"bf","languageName":{"simpleText":"vu ljmtwyyk"}},{"languageCode":"eu","languageName":{"simpleText":"dlefid"}},{"languageCode":"tt","languageName":{"simpleText":"ldml ie"}},{"languageCode":"yq","languageName":{"simpleText":"syskygafvke"}},{"languageCode":"hg","languageName":{"simpleText":"ehdgbpgtimijp"}},{"languageCode":"te","languageName":{"simpleText":"w iroko"}},{"languageCode":"hu","languageName":{"simpleText":"elyudkt rzhdxd"}},{"languageCode":"pk","languageName":{"simpleText":"bfhkwycrqg"}},{"languageCode":"sg","languageName":{"simpleText":"fudphsmnzm"}},{"languageCode":"cn","languageName":{"simpleText":"ghhnmhty"}},{"languageCode":"wx","languageName":{"simpleText":"hrdffeeds  uyt"}},{"languageCode":"rm","languageName":{"simpleText":"adupdskfg"}},{"languageCode":"fj","languageName":{"simpleText":"eoooelkixd"}},{"languageCode":"rr","languageName":{"simpleText":"bzlozhq"}},{"languageCode":"qi","languageName":{"simpleText":"udgltnc a"}},{"languageCode":"pg","languageName":{"simpleText":"vyoswnnm"}},{"languageCode":"si","languageName":{"simpleText":"ebqf qezqtrubo"}},{"languageCode":"qh","languageName":{"simpleText":"spmq  fiy"}},{"languageCode":"aa","languageName":{"simpleText":"htnmpclnt"}},{"languageCode":"cm","languageName":{"simpleText":"s qrojuufe"}},{"languageCode":"oq","languageName":{"simpleText":"hwwpjs"}},{"languageCode":"bu","languageName":{"simpleText":"qncnfukscfuui"}},{"languageCode":"mv","languageName":{"simpleText":"h hlgpju"}},{"languageCode":"yr","languageName":{"simpleText":"qbyxlg"}},{"languageCode":"vo","languageName":{"simpleText":"uiytkdqd"}},{"languageCode":"ob","languageName":{"simpleText":"vowlpo"}},{"languageCode":"mp","languageName":{"simpleText":" bfynanul"}},{"languageCode":"eu","languageName":{"simpleText":"wczcsf  oeyrt"}},{"languageCode":"tr","languageName":{"simpleText":"hu tis"}},{"languageCode":"yx","languageName":{"simpleText":"osqetry"}},{"languageCode":"hw","languageName":{"simpleText":"yiezjd"}},{"languageCode":"hx","languageName":{"simpleText":"aghkggsuew"}},{"languageCode":"me","languageName":{"simpleText":"gukieiwvrd"}},{"languageCode":"xu","languageName":{"simpleText":"ydmuvn"}},{"languageCode":"lt","languageName":{"simpleText":"mnrzlijqyhgk"}},{"languageCode":"qf","languageName":{"simpleText":"lmczmzimiaqmv"}},{"languageCode":"qb","languageName":{"simpleText":"bidp vsq"}},{"languageCode":"qr","languageName":{"simpleText":"mowcnqy"}},{"languageCode":"vf","languageName":{"simpleText":"rktpclx"}},{"languageCode":"nz","languageName":{"simpleText":"xmroo"}},{"languageCode":"lk","languageName":{"simpleText":"ntqkdoynnbx"}},{"languageCode":"li","languageName":{"simpleText":"ncjkihiqfou"}},{"languageCode":"mq","languageName":{"simpleText":"i keazubawd"}},{"languageCode":"vr","languageName":{"simpleText":" prjfux"}}],"defaultAudioTrackIndex":0}},"videoDetails":{"videoId":"dQw4w9WgXcQ","title":"Rick Astley - Never Gonna Give You Up [Official Video] (4K Remaster) 「ネバー・ゴナ」 {HD}","lengthSeconds":"212","keywords":["rick astley","Never Gonna Give You Up","nggyu","never gonna give you up lyrics","rick rolled","Rick Roll","rick astley official","rickrolled","Fortnite song","Fortnite event","Fortnite dance","fortnite never gonna give you up","rick roll","rickrolling","rick rolling","never gonna give you up","80s music","rick astley new","animated video","rickroll","meme songs","never gonna give u up lyrics","Rick Astley 2022","never gonna let you down","animated","rick rolls 2022","never gonna give you up karaoke"],"channelId":"UCuAXFkgsw1L7xaCfnd5JJOw","isOwnerViewing":false,"shortDescription":"The official video for “Never Gonna Give You Up” by Rick Astley.\n\nNever: The Autobiography 📚 OUT NOW! \nFollow this link to get your copy and listen to Rick’s ‘Never’ playlist ❤️ #RickAstleyNever\nhttps://linktr.ee/rickastleynever\n\n“Never Gonna Give You Up” was a global smash on its release in July 1987, topping the charts in 25 countries including Rick’s native UK and the US Billboard Hot 100.  It also won the Brit Award for Best single in 1988. Stock Aitken and Waterman wrote and produced the track which was the lead-off single and lead track from Rick’s debut LP “Whenever You Need Somebody”.  The album was itself a UK number one and would go on to sell over 15 million copies worldwide.\n\nЛирика: \"We're no strangers to love\" — 歌詞 {unbalanced [brackets} and a backslash \\ in text.\n\n#RickAstley #NeverGonnaGiveYouUp #WheneverYouNeedSomebody #OfficialMusicVideo","isCrawlable":true,"thumbnail":{"thumbnails":[{"url":"https://i.ytimg.com/vi/dQw4w9WgXcQ/hqdefault.jpg?sqp\u003d-oaymwEcCOADEI4CSFXyq4qpAw4IARUAAIhCGAFwAcABBg\u003d\u003d\u0026rs\u003ddYXZSUJH2D36wksIIVWudFSRE1N1spdY","width":168,"height":94},{"url":"https://i.ytimg.com/vi/dQw4w9WgXcQ/hqdefault.jpg?sqp\u003d-oaymwEcCOADEI4CSFXyq4qpAw4IARUAAIhCGAFwAcABBg\u003d\u003d\u0026rs\u003dM0LQVnGldPc7m9jiYaJkiqOEKAcjkMCz","width":196,"height":110},{"url":"https://i.ytimg.com/vi/dQw4w9WgXcQ/hqdefault.jpg?sqp\u003d-oaymwEcCOADEI4CSFXyq4qpAw4IARUAAIhCGAFwAcABBg\u003d\u003d\u0026rs\u003d6vR5po7z-MvqWNR9XS5iCotyyNd6G0ge","width":246,"height":138},{"url":"https://i.ytimg.com/vi/dQw4w9WgXcQ/hqdefault.jpg?sqp\u003d-oaymwEcCOADEI4CSFXyq4qpAw4IARUAAIhCGAFwAcABBg\u003d\u003d\u0026rs\u003dOFpsr9HDqFqTPgcHEYTSSNGiGAOTC0Gr","width":336,"height":188},{"url":"https://i.ytimg.com/vi/dQw4w9WgXcQ/maxresdefault.jpg?sqp\u003d-oaymwEcCOADEI4CSFXyq4qpAw4IARUAAIhCGAFwAcABBg\u003d\u003d\u0026rs\u003dkPz8XYJLes_P0dm6ig-0Hl71WKLmNgv4","width":1920,"height":1080}]},"allowRatings":true,"viewCount":"1682512359","author":"Rick Astley","isPrivate":false,"isUnpluggedCorpus":false,"isLiveContent":false},"annotations":[{"playerAnnotationsExpandedRenderer":{"featuredChannel":{"startTimeMs":"0","endTimeMs":"213000","watermark":{"thumbnails":[{"url":"https://i.ytimg.com/an/uAXFkgsw1L7xaCfnd5JJOw/featured_channel.jpg?v\u003d_op_EiEg","width":40,"height":40}]},"trackingParams":"asf_9bA-BK-lyfdo33GfqOMdi5gxJXCIMqcZx4yEWG5g","navigationEndpoint":{"clickTrackingParams":"HGWcTY6UfJzD5UK4w1Hjj2G_ey_Hw_isA5H9twSH5j6M","commandMetadata":{"webCommandMetadata":{"url":"/channel/UCuAXFkgsw1L7xaCfnd5JJOw","webPageType":"WEB_PAGE_TYPE_CHANNEL","rootVe":3611,"apiUrl":"/youtubei/v1/browse"}},"browseEndpoint":{"browseId":"UCuAXFkgsw1L7xaCfnd5JJOw"}},"channelName":"Rick Astley","subscribeButton":{"subscribeButtonRenderer":{"buttonText":{"runs":[{"text":"Subscribe"}]},"subscribed":false,"enabled":true,"type":"FREE","channelId":"UCuAXFkgsw1L7xaCfnd5JJOw","showPreferences":false,"trackingParams":"4v8jXuUEWzU6YNKKhB3DvoC5sj3IsIseGduvmEkAceXo"}}},"allowSwipeDismiss":true,"annotationId":"s3Fv4ycgXQO_FpbgfLccov1gqMZ9M_mBPP_8"}}],"playerConfig":{"audioConfig":{"loudnessDb":-2.789999008178711,"perceptualLoudnessDb":-16.78999900817871,"enablePerFormatLoudness":true},"streamSelectionConfig":{"maxBitrate":"13710000"},"mediaCommonConfig":{"dynamicReadaheadConfig":{"maxReadAheadMediaTimeMs":120000,"minReadAheadMediaTimeMs":15000,"readAheadGrowthRateMs":1000},"mediaUstreamerRequestConfig":{"videoPlaybackUstreamerConfig":"BV4MtVefnqr_y8o2c2ssyedqydfGOpNLtXLO0VK3tQLaRQOda-Nw7ayeQOyDi5PGvQRdx2jA_ouNqWY3ShSrEh3u952xueZQWcsUYLcTMBxCM2CUlufkswy5DR5oiRhFR5xZkzTmc9VWLibZ_WsfcAX9XqhH0gpwXW0vnVzSWioSd6HrWxl08ETPRiczSGIKS_e5ZjhR-siKGStu48jsYOcxzhp9x_NtKMhu6IXIyqJw7GXLKIHWRc_JVTCfGmHryH3F7ZwNfFpu4PKOjNbMjXLa7hKtkJMT_Ez-os9FPjzoPHua4mAcXFWYd_G9XonCIt1gQbE9BsXG7omSV6fhkmqBK78U_P2OMQjYAjuBtJ9z7RV_ykehCXhve6iSPcOcD-wlZ8BpBB2sGMdSFb5neIL7vw_Cc1SL3Q-g_9Hx1uRW1YMLoC_Muu_bsyzsoZfOPCDD53tgaXTOASAva6faw7qT-1CGlPz5y03nLEHtz2Lz22J74UZmQXcccgBad-UCbYJ78N3UziyYOHUVBotgXpQDtXuDTjoUKwf2aMuBzv3T9C5qddZSWLWwWcWj2R49FG3TJ5GR7ct9PfnMDaAhxdkC"}},"webPlayerConfig":{"useCobaltTvosDash":true,"webPlayerActionsPorting":{"getSharePanelCommand":{"clickTrackingParams":"v0zRfXkv2Io90wrR-g4hrxZzfuV3sll7PVshqJq5","commandMetadata":{"webCommandMetadata":{"sendPost":true,"apiUrl":"/youtubei/v1/share/get_web_player_share_panel"}},"webPlayerShareEntityServiceEndpoint":{"serializedShareEntity":"CgtkUXc0dzlXZ1hjUQ%3D%3D"}}}}},"storyboards":{"playerStoryboardSpecRenderer":{"specUrl":"https://i.ytimg.com/sb/dQw4w9WgXcQ/storyboard3_L$L/$N.jpg?sqp\u003dscEOr6kpsfZQC1nlCs7UTTKW3eC1M-wrVUUd4PMi|48#27#100#10#10#0#default#rs$4M7OqWI50IdtKcvONfAq3I-ih6t0bJm_|80#45#108#10#10#2000#M$M#rs$hNNKSKH1SqRg1YdRBAHEkuDVOXDAj6Yl|160#90#108#5#5#2000#M$M#rs$7Q3wqnMdsR_LhxuFhmzPEdtAizK9offl","fixedAspectRatio":true}},"microformat":{"playerMicroformatRenderer":{"thumbnail":{"thumbnails":[{"url":"https://i.ytimg.com/vi/dQw4w9WgXcQ/maxresdefault.jpg","width":1280,"height":720}]},"embed":{"iframeUrl":"https://www.youtube.com/embed/dQw4w9WgXcQ","width":1280,"height":720},"title":{"simpleText":"Rick Astley - Never Gonna Give You Up [Official Video] (4K Remaster) 「ネバー・ゴナ」 {HD}"},"description":{"simpleText":"The official video for “Never Gonna Give You Up” by Rick Astley.\n\nNever: The Autobiography 📚 OUT NOW! \nFollow this link to get your copy and listen to Rick’s ‘Never’ playlist ❤️ #RickAstleyNever\nhttps://linktr.ee/rickastleynever\n\n“Never Gonna Give You Up” was a global smash on its release in July 1987, topping the charts in 25 countries including Rick’s native UK and the US Billboard Hot 100.  It also won the Brit Award for Best single in 1988. Stock Aitken and Waterman wrote and produced the track which was the lead-off single and lead track from Rick’s debut LP “Whenever You Need Somebody”.  The album was itself a UK number one and would go on to sell over 15 million copies worldwide.\n\nЛирика: \"We're no strangers to love\" — 歌詞 {unbalanced [brackets} and a backslash \\ in text.\n\n#RickAstley #NeverGonnaGiveYouUp #WheneverYouNeedSomebody #OfficialMusicVideo"},"lengthSeconds":"212","ownerProfileUrl":"http://www.youtube.com/@RickAstleyYT","externalChannelId":"UCuAXFkgsw1L7xaCfnd5JJOw","isFamilySafe":true,"availableCountries":["AD","AE","AF","AG","AI","AL","AM","AO","AQ","AR","AS","AT","AU","AW","AX","AZ","BA","BB","BD","BE","BF","BG","BH","BI","BJ","BL","BM","BN","BO","BQ","BR","BS","BT","BV","BW","BY","BZ","CA","CC","CD","CF","CG","CH","CI","CK","CL","CM","CN","CO","CR","CU","CV","CW","CX","CY","CZ","DE","DJ","DK","DM","DO","DZ","EC","EE","EG","EH","ER","ES","ET","FI","FJ","FK","FM","FO","FR","GA","GB","GD","GE","GF","GG","GH","GI","GL","GM","GN","GP","GQ","GR","GS","GT","GU","GW","GY","HK","HM","HN","HR","HT","HU","ID","IE","IL","IM","IN","IO","IQ","IR","IS","IT","JE","JM","JO","JP","KE","KG","KH","KI","KM","KN","KP","KR","KW","KY","KZ","LA","LB","LC","LI","LK","LR","LS","LT","LU","LV","LY","MA","MC","MD","ME","MF","MG","MH","MK","ML","MM","MN","MO","MP","MQ","MR","MS","MT","MU","MV","MW","MX","MY","MZ","NA","NC","NE","NF","NG","NI","NL","NO","NP","NR","NU","NZ","OM","PA","PE","PF","PG","PH","PK","PL","PM","PN","PR","PS","PT","PW","PY","QA","RE","RO","RS","RU","RW","SA","SB","SC","SD","SE","SG","SH","SI","SJ","SK","SL","SM","SN","SO","SR","SS","ST","SV","SX","SY","SZ","TC","TD","TF","TG","TH","TJ","TK","TL","TM","TN","TO","TR","TT","TV","TW","TZ","UA","UG","UM","US","UY","UZ","VA","VC","VE","VG","VI","VN","VU","WF","WS","YE","YT","ZA","ZM","ZW"],"isUnlisted":false,"hasYpcMetadata":false,"viewCount":"1682512359","category":"Music","publishDate":"2009-10-24T23:57:33-07:00","ownerChannelName":"Rick Astley","uploadDate":"2009-10-24T23:57:33-07:00","isShortsEligible":false}},"cards":{"cardCollectionRenderer":{"cards":[{"cardRenderer":{"teaser":{"simpleCardTeaserRenderer":{"message":{"simpleText":"Never Gonna Give You Up (Pianoforte)"},"trackingParams":"ROcw3ob-G-C14BxNnFXwjRa8Cof48RZtSf9Twnh_wAg0","prominent":true,"logVisibilityUpdates":true}},"cueRanges":[{"startCardActiveMs":"0","endCardActiveMs":"5000","teaserDurationMs":"6000","iconAfterTeaserMs":"5000"}],"trackingParams":"-hIGPCXAEhHYEAJyBmYDujqSCGucKPs0cv2U37nLhjBW"}},{"cardRenderer":{"teaser":{"simpleCardTeaserRenderer":{"message":{"simpleText":"Never Gonna Give You Up (Pianoforte)"},"trackingParams":"LmVMXAzoVATZBDLgKQPREuvY-_Q3Yqs_verMVcpBpggw","prominent":true,"logVisibilityUpdates":true}},"cueRanges":[{"startCardActiveMs":"0","endCardActiveMs":"5000","teaserDurationMs":"6000","iconAfterTeaserMs":"5000"}],"trackingParams":"upe7a_YSrYbL_OVWvCoD-b7gBwvBylSBsii4EaiMcJfu"}},{"cardRenderer":{"teaser":{"simpleCardTeaserRenderer":{"message":{"simpleText":"Never Gonna Give You Up (Pianoforte)"},"trackingParams":"m7GA9tczkov-hSQ8nszfyUNJg04SXHd_ZpIAxEtWmAd_","prominent":true,"logVisibilityUpdates":true}},"cueRanges":[{"startCardActiveMs":"0","endCardActiveMs":"5000","teaserDurationMs":"6000","iconAfterTeaserMs":"5000"}],"trackingParams":"0NDwvztCstepxlex8bFSryh5nUzhPCavgOVVMJEzXEl-"}},{"cardRenderer":{"teaser":{"simpleCardTeaserRenderer":{"message":{"simpleText":"Never Gonna Give You Up (Pianoforte)"},"trackingParams":"bK62ZiokPD8UkzBp-z4qAiyKPy652fPsssNAoh4og6d6","prominent":true,"logVisibilityUpdates":true}},"cueRanges":[{"startCardActiveMs":"0","endCardActiveMs":"5000","teaserDurationMs":"6000","iconAfterTeaserMs":"5000"}],"trackingParams":"jmyPGA2c3FTTLszM9KdB5v6FW8dofhekxdlFREMn0BME"}}],"headerText":{"simpleText":"From Rick Astley"},"trackingParams":"PYBGqKbb1VFl1POb7vJTCTH91eLlo1DIIhe54xu1iaPN","allowTeaserDismiss":true}},"trackingParams":"kiP_XNgjnqHAup8PEQsO-FajQvrUSkPzGGYSGjLFuGE5","attestation":{"playerAttestationRenderer":{"challenge":"a\u003d6\u0026a2\u003d10\u0026b\u003dnvomLLmy28s5chTp2kH3tT-WuLE\u0026c\u003d1760878145\u0026d\u003d1\u0026e\u003ddQw4w9WgXcQ\u0026c1a\u003d1\u0026c6a\u003d1\u0026c6b\u003d1\u0026hh\u003djBZ9a3yx25xdekCGd-d4SRb2rBs1VwCmc6-QeGvq3bv","botguardData":{"program":"bYvv5KLCWieeB1Q29G7cvF5pG+exzceKKlMgSWmQ59NTZU7S/TC3vmKZaitnxPJBNAEES4HbRkfVVOB1JsvcXi/dHmWtZjRzD8IKPndNdqAewBPl6GETmAjwOgvmy0Z1I8ZzABobvS5fWGWeWKUQbnSzS6WaedjgTsytbReZEtWBeSFUgwZKQDBBYUJvAPohVPaoO+B/4QAU4bPiFXF2C6giO8BFLqQ+ZbTJ55H/ioSa8HODLH9Jraa6Llx8iNfYYoVbSAfRi5xyNE+F9yKIejeibA4MjgQLW8YCEg0vpgGYmQBwBFjy7XsDibDAvDO5L4H84YEa5HrDt373fyTH2Lvd9Sh7q1hfUubXdJWkkSX8O9tMM+o9x2e6tGMXuMR0MdCf0S7fLoVnBAX5GWkjKznkL84L+2vsVBATyBs2KKB7tyue7DVUg2P/FLXz/rcGBw2oxphE8UCuuK53TUgzB7wheCtXbM+JcgEqEoCTHj58FnwLonJmBktnNyBJnzbjLmRnS1RzWCs1VTuOn4pdHNUYtL1W0i5ldQSASiSUtnU/L9MVnX3TsgIXrzLQ9dLYU7u9fJJ9Gy41r50yT0pFgk01goaDb5blKTvXJ5MAFZN4faMBLmo5oPeSChYnx7igi0OsVWpnAR2jTr2ftQ8x0aZSZbOFCHfIu4luzCzUja43e1kpar7AnJqYzSshYJqzZCDa77N/jhcoL1P9fTDYwGFq08+YQUThPRpjMJof8sN3HX/i6u0fXWyRzNla3ZYtwNuLrzpdQXJRv0abTDNT8OnViZey3IpMW8SoZGj7kCAigkmzZxTle9RKdow7q3s8/VMSXGCbC6X5VFVB8UtPnGmJCXXcRurI1InlJ+R7OPUrx3UChryIISdbPgCHZp4nP5bWpvInIUh9/gwMr6N7seGTR3E9uGSDvUPJ46pOD6rorFPsvIYmjVxva/32ds/tiEnOL+Ew+QPIPvmlB0ppWoKIMWZMGxIBuo0WxGpFSYpSO8VzWJ6DW0PeXff8FkiujUm05t/t4ci+br3uohGKJBssNY0tVmVx958872fn2GLR1Lqv6cHTIiegz0WzERjASDTPCdn6Nn+yd56pNweqJOMweHeKDvQfBAAqtEY96gCEJTW9vp2MUrgGLr8ezrJVquXxy8UDQoQQzTM8AqiY9T7STHPLIpNX1eHuUICYWNrue2KrNUaABdv8MfXyhZFQFqM77BdzJ0E2oy5EEFfk5H0k3uBWPYCs2EXFZFCubCG9goUMuLM/Qw+XPnBqkbL8fQCdvzDfIcs2MzoNiwEPWA96w7QA2pB7AltGpUumj5NID4N6f6FZEbD6GFK8g8FqosvnjSsn5Ahmlmxk2qrQ6qVuyv+oqNSDRoovz+XU7ksJOR5GKmLUVVzdsu3ysc7bZn8cAT2PdBrRMDPw/OLnUFVsuTP8LtbWGt/l/hp3WKG3BQheJqkiRbxAVw4fh3FzIJU6UHyPT57yrHLDs3yzhCcU+rljdfrShLZaj4cCi4aO/aTwJUfa3cDwKcoi1YU62WzzCk2ZhncdNfiwEApm2htt4DOeOl8e9E0/mCYkqPMt347VNAMDg4sNi3c+ehRNKuCHKP+5t8rTw772DlveiLozyqnKE6dzYfA4iycmIn5tOndoaqFVtCrcaVFWlrXcRPo0mnGalS1/7ZvhwZSplY1LrvC2nZA9dbDJ6SL8Z1F2HF3y3EzcNUP/vfTJdgS40w+QShJR8J1VEfH60MHpcPiaIRupb97BfI24ifhOoeQcrH6GFcaMN1sZGr7N3XnD2K1OkMRqhiDJ0tme3XGWj/20f4yqTDZc8pUjsHfKlLJk0qfXTSj2o+MOFHwEEkFyRDSFEImdbEPP4YwTkPlYMUariTioqil8alVSnWSe5tMNUKcmjrG4DBBAWXc9l3MS9rA79s7GNRJ+8XWmRog2d6Ib17D1YWpobaGJ7JiGIQ0sj9S5R6ylRN2oUyWHb3acg4rRH6rRosNU2pkRwfdmUXZCFayCqOSr23Fw3Ho2u5jNr3B4ZAtd1pqby0S+p28Aev8sLan+jZRW36x9UJ9yPrZqK/2+8pmkHNe+HBpIXK0Akb7CWsCU5h3266uAHp6U8b5fBSb5tn2hMVl/Orr1899dMrjS93fl+EHBQWhTrMILx7g+Clq18HWn9kIVxi5bsPm70UjX7Nl5GVwLvQm/6LMux1/x0tcpOZo8/UiJ6dJgmG/6V+/V73f7HwBiYSn3o/tAg75jcAfymTzK2ct3TYFSPiak9jMNgDxRr6r7iSBb9kqahHnmVThD79FInEz+efzC8y6P+5pDAwSyvt4W5s627QFxDimvydEnJdz7M+wPwP7vUqJeRHwNaVDPCis6fXxS/LZGZgYH21YhJAy0kR1W3Zk6Lj22tmyE1lwhYN5T4T56T5PFNWNZ3msYL0jaxreroRy4tA3rLc5MD25fnah5EKSJd68GqAhC4TFvmqaAQMyTqWag5ZiAKg6/lk87SgpSYbfSxGQE06oN495Z3uHCE/EnfqQsI0tRJmxAjcJSWDC6Yfl3imZRGkbX3XHdSX19RCBSiiEHVrW0GhOiI6gF2SkS0+mlNTMudFTfoFmiuMy3ei0ntCcsiwsx1SuToqAWw4Dl+xx91CulaeDU5lEwD4fBr/er6r5WPEC+1LyL/fmXf14CX0oIgDSmr0JWHyUWZ9zPgemVicO/xrRV2lVc/heIEaM+FPm8Qfjxa/ysQ0oEohTEPms7iYnZh794hkLIIx0Aq/p3Fq0PvizBMlJacgOhKUqhEcrgu3qsKsqIh3Jma8JAxtC0aewfNVN1yLGfy4UXRtSyarl2B8ifnHkFxhWUidjZH2VY+4lMIeIFN8cCFPmDtN6aJcmTUYgkyPihDJB7W8qo3YSr596ehDHVCwmmKGa+d7voFdiVfKW+L/I5Ymhd6eVfj0CBPpnjBFRhCtZeXqIusr4GN0LSD/7ffHDPBw0OCXBRXDTgCfT1o5NOifab8bWKiFFL6rvdcCOvM96842nzfUhx543YnaWf+v/Hg6+3g9rIBWXbFkS3UZGEp4XKYlEsDmWh88Us6l7FSnv+17MujDGSya0U2UrrnGRfXp/lr32QS1d/QjI85GRyiMLEvt4jZq13lYzxhgRPbO+YuYYxCVsM91iklk2y+MAPRsbkaYMSkgQ8tK7wH2idKVpnFrJW/icZpICFE1kZnRU9B6wGk/rgbVPa5x1NjusnmhUPrlGr1hIvJhVqNFHd2LqtcYa7Py+KdY5fA2av8xwvVwtlbQo7HQhCFk3SHpZPynPxQa24RAoZwBcUrHZQyF3d2sLDbq6atvWZ37LC0adWhXyvwuSr1/T8n6Fx7ohWIN3rUTPZlb9fyigGN0d/wHCdEaczS1k1GvZ8iw3KPMvnFZy59gOIQ6PS6LBKTm6tTEXNr0mK+9SezCyG6cF3WSAXwad/2eBOCOtxEB/hYO4hliquWIvB9PSiX5gt5wg+Li27DiOkl2RLTOdocWJTLkSKDzJiMGKMKRSEgDejtf2j57jqOSx7j2HJ+BInBr7qQwJALtjyCvi9hdTaQu9t5I4hjoJpejFnU++llnPV0qR8pECJMntJFG4mOTMbhG4jM0JR9ts+4imLbzCUHRea6OWBHQWCZol+/vE1L1YwcKLNgFibgAolLPkpQLoHU71WLxNSS9e0u2q8zntMLSv0hcA3RoYZ17fBaygeR4t44+pxCh2O2HQbHrNBPZfQmDEkfplsXc/SBMALkNkQL5cEik+eRAdeMS+ww01i1lety4ul32zJrbUFotUtu25QvnbNi2Hcv7K+M9k04inGfzk99dR2nVRPuMSDUYzcoMVPrPIN1ILmQ+u+Rk/2yPeWq9Sy09VptaVnh4jALo3zDO7UtOfWUfOCIGGWTyWrI87M5VIp8EpF1ItYeCNNPHQMfzVN1EU1JZ7QvSrqmL3mqyjTMNbT+YQD8Sk9qonhpKD5Ipiv0CD70cHHxjEbCBfbf0nX3X9JE7hfh+cvfP53+5LTgeXJwoVY9rxaTXiqk6O+dEnlsOAOOpK5znuHH/v0rNW6kz59HoUsFnX3cnaS8zfXNDGl7+7tTyNrNDHRoEzhjTNowwsJALniE1cY757CQf0NVKOW/6o9vkG+tADfG2sqRMbZP8awt+dJpR+SV2MqKTL6qc/RhbaYEQ5TJu9cYCa5d7dSb1ixjB0KhF6Aym8bKLzYe/tBcBDT8yjzfex4Am2a9TVCzaI5vUceyLe285GXjujOvF4MdeJtxWgomI4s0ipZkl+Q021A7BvrkRAOd22bH61RxtvGaWM7AZXf4TawGOZwjGSlFjb+MUPtGkxHTTWMmy8ZtKoWcU0hDOEoJXw68fRTi+NISmr4pjLcd2IEZAXAGr3zvh73SIOWJa+FEhLBN2UEIjGFFifHqwOPJvr8GiOh9sZTwZsSM8n/MlodQJr4IrYjG6wDrIruiWFf+xT1ktKI+3y+ReJ6ArjSjZCIu8sOuPVktkmKF+tAjE/kEcySvu2wH1KUpd38oKttPzKfwxB0rcR0FhTBxc9ARG1igbZmFGJHuMAvFqQWD5mVsSY1qLtanuuw2604OpuLGF6X18CtYfqhCo/HgwOKnFoOtuRSL2/jZd8IHokaDGvwUX221rXqrVyPSCZ1Y3TeDNwRQ49jPuiqJk2cj3Nd9s3qDVYTNVqx7TWRPE32oXCEveRD2HTmzMrASU0HtdyFkDVJz3ga70Exy0tlZfWHSSZPOPyQ2UjvoQqH+9HfMRlN6ASJwM7HgJ1U8lcW9oKQ7U3iac+4d3gX0jqUgACiq0xY8c+akDuUBA6uFwPs4rl99Lq8wbCg9/5vu8kmZGgfb65yxFlhCPGgMXVjUotofhKeOuuAsea3i4nl64V5ekXnEBR3JzH6HSONdOoqj+qYTT3XAg0fOhNJ045K66/pKTi3PlmutA6sovhfBhPchBdA9bl2FJCuocvvfHINrBxJuJdZhja/OpHBKXouy56sg9w5dybapAxyv+evGPnptOD4m6jcJv3tJ/HuKzb1z/+KQ1wYB1pA+nBk5vDshts9dUPKG7GM5IrrRmaFJF5fIj/lrwOU4OsBCUpi/I6AcgQbxKl+T4kyPQw2eMEP53+hE38gJmT3JzyEvvPnjeA2JWqZdJncRSIWNLG6a7nn9jVKsYuGTHUh6ZxThK2dJRQdXMQJWL85+8EmoAgNstfGRGrv5mKCfkPjAMgJ5oEDohZQe3M3eqb4mJSKy9OHUfqgQ2fSqcGRf5+GnEBtsxTQIKYdWUYoqyeqJ4Cb3wLrtGL+44fYtYtWURdeIBRNo7gKxQqULtpRj++7uV0JICZMVuVDV49+aIO6gR5pJq73agJpob41iX9QnzeeHCFHl0QW1bGZUeWKWpmphdFTM8pDXbP6+7aOwn8de7eM/rdLvkxa0owtbapE0OX6UN+/ydZDkU59kZwnJBWBmpMMgqPKXGFWouN4wbTV8XVM3nACEU64gBMomkV5x+J4fFIw4L56mtQu4BDSSnXu1trgPy53wtEGCV+7h9uaPGUyvYXmRRmCuF03EOg6J9lB24sQjC/Pve6KcUSPMLbDyuyKX/C4yg/v4EZjW4tyhVXft9+TIydc3YmNnDGPTMisVZQ86cxgLtv0MHiNxkTchvkAjtmzOJSRYOAgwhqvEKbijUz0VDY7BOrxOv6QSs5S+IJkcBB0xLHuMhBsYv0V/J6sZHWFfbX8pdFok3GmFZSWTPtpzyV4kq+2FiM1ZXEg3V0wn1Novc6ljw6I4YbgpFmDLjIvZEfpSeACNU85T66jTbFCHAsVpyNkh6yGvS70NY6zw1LNe9TutI32WIW17hVscEAskvz7YBclNplOwKezjoGyHwSqEAmKzXK6cqtI+QNnWrYVS0uv/MonCYFi8nb4swXl2J5W5Gc/g+a2TqqHGzyLwHbEEZQ9U3SbZhrO5Vo9ucWzB//JsktTS47s428CAoXg1kqjctpJOJJP6OSJjNzm0IzRLBHhxa1YcVAcTXO4s6ta0D4vF8hTo0pzNdEO5gi/Ta+IvHS13kivQ+EZ6IUf6/y/OhpH2SpVVopDK2GbWNBZzblW6QcM36wrOWq1bSULE1A1tvgqmomg46npuRncX1TbtuYUkaA2S1xtdEdfYGfIGHvf6uvhAuJL1CUkqS68TG3/AqKITFgrAnVRJ2e3hTPdjzb8Isiac/LRcCR24DJPMFqVhoEg5Vhogzl6JEyxct1eKV+gEH+d6jk2wIkvE25BJnjqDOVyqdjrsosuE1iBQT59Rw1K1QL7ICP0oWSpNuVtA9l6jgUAN561fqI/epPf9SZ963jbs1eOC2qusj9vfPFgn/Nc+ua1WFpVxHfJUfzVlg74cU1UieVZ4J7xMJh5SUEz8O2T/NZ7ygE1yjlf7eZig5090jfsQu6Fld/kzYFqoPnLUbU0ylByHTzeZycauYr7rvrEHsf/ifzjY6rMSD1u4LQlHpXd6OFS3CPTSWJLbNHtGqtMFDzX6DktmDiN1lCPtxocDRq1pFL+q2V2DsbijpK+mNm0fXmG0znGRZwRCh1LP/Vy1hKT0c6zZnh4sjKUkCGpq9oTXFnFPLOFk3ljAMpKJ8LfoLGiqGOyqGFjvoxP7V+HmF9jmkjmmnx0edcir+l1R3LaFN7eENZM4iYRUkfo4AEfvsejX8ITdlTMe2YRxQwnhWzITQ8B2eigPw37jqCFtonYFc0XaSRkeIdgX1pZHIOIlNYP0Vx63M1G8V+RjKR81coWKKA6nRWWn3WLv2jkyXb+Tegr3S1iSTNIsZPZph/jWFMTlvjc8LPezH74AavqTylrUQJ9PG3IEs4AssroovuU2H5ke+nr4YRKVMWyC3ztyLwhCI2X8qN/gtajCdoXHA2i6uES46K07mrItIjffLDEn4Op+CIPFSnbAbyBYW2Zl+idByUh21GS5Spyu5riaIy5r2gwYVN8NqrnFeBAvgqcQL++mwe1k8ln237hdvte6zcFrFo2OwXxB5/ngSLjzccBiaS2I3OFKHI8vsTGotd8dNn+7Fa3oFJCpqT50PN5QPvIC5PHZ2yO0jQ0Kk+aMk0aylOieVsmE8VpRqFdIaP40x7wxVrbkKCUgWyMtRq4AeGAOnzUT9Oaq+qDkczZONKjHxNXnL7Bt1M2UtbKXFNJJEwcHuDoaEZeI84u7ybKIaHlAPFbf4l8fr+EDgCv+jmYbKiKk5lBP66JOHVlAYEZxPpr5VOR9gs5wVy3gpRvrH0ZWn7iLd7TSu3TGxx6PapXSMenvpmh8/zhACfO9jFDhIK98WsjBttqHkXQgC0GoVpEQKhdDpfhCvB0fb2TRoW2UPl9rVQjwr+JGVkrk8osblG12L42bgZvnBl/ScxJ7fbGJMV6zoCUdWNuk7uPVDbO13xJ9WVIkiHwv9cqBzfYk3bP4iZC5iJhs6NHhzNjFESTfdOTe1CnDgkfXxNaAGc8Unx1zp4Ezynzse3o5m06+F7z2hidqvu7RuVAcj0I9/558UaWP7RDrCu3jo4nppDShOxtCWdKj9tK00UBuZioU6v/FkYz4iVa1/yxunomkBlDzbnXe5ChY4SLCG+riZIHeyBScq/Y4BPVup2iOVxONuHGrH3L5tQffWPQFsFY8iHez0q0LXXPhj1OqaeffXjsmIsaKaUz6iOlf9j4oXOUCLAywzp7PLeCuNDjHx1dJH4nYXKbnPpGk3l1emg5+V6iXcO+JC3ejbvCKUV/jWh2AXgdT9o+CMB+c7rcqyxYtkAsyBu2Vkk2K/9NNPGSUUI+vrZ2eSWzM672JKUbmEIM6wkx0oDeJCPP/kXGLJA4c2lEvZVSW8/ZiY/jFLnNVFJk5UzAsSKoWIMcr/zuQ4Sm8N0iYG4C00X3Ib4JNyBmUOOOTnhuauzCYgoDH1gLBykU/bn16hBgVnN4fKRnuj3Q85vamKu5Hcb1JuxNY9YEIdWoX1OVrK0bXm/fRIUzjc36WWYTaqUMdAByfeK7KRU9xD0VVafWmSp+chDvEGkfnnVSTrD4TDAtvOBfLNvmUgeNwK2cLo8iWUo5CdG1U/a4pZrzfBB4t1luXXk04YAC5tWQVr0DXdgazI940dWSAzKf+tWOIcFDcLu8Bx94sJ6fZFMHbnVzjVeM9PJ7VlXhc7+2OnypM7BLfgUOrj0mdf8bDaz8KTbfKl3ssSxK0qO/nxaO4oapuximARY9eWWGY1rCv4YqdTgUTLPWCDCQX3nVv/pAuMAx87NbSCpNwywDzkkKjndOsNUZ/Bv4gfddtupWCBf59NyHe6+VRceglpSWRyZOKul81506Oi8MJpLIEZaAqiZFWmyXHq89skG14rDFeg4uQQq+x/mCYqCiAkILGAE9krjHrA0MA//STST1Jlz82cTT7D6LUbQL+Nn7lVA4l1KjwP/XvsQxwgnYAqZ0f72ufbiX+YYc5tye2uMn3r5TQtHR+W9CfrKJxwcaoaNLCnI8Ux3VslnBa2/h5chDyDM0uybyyT/53YfE4jFfwE+2BfeRh1s11OL5p6fIYKys1Dqw0ZbxTQuLkeiLCA3oIlawlvdlWEDXEbw0yFYv7+yhqEriXrE/SAnVDOt/JRThv52NDayBN1TonLF0/7YrW2mY9lQf0b1TACbDbPmX6BAYWaytMG5+Cs3RJaGBnsItjePwgqmzLYgI5hos/yc3uxZhwsUAaOO0fQG1lyTkxo65Nl2j2gEsvby8i8RdZJIR1y0FjndTqBQZi8+5Pm33J4jA73iwHFpku0KF4xMuZWeSFgH/LXHMM83R0FzpKPmEIL/e567EE/rEV3/gVGHlnkBtlvQ6hQtLMQgx8ySz6NtVTIom9QjaMflV6DK4AGQzl7X+t1xxsuF8VWD4UbAcPoJZdRhweQTjEzWcm+fVfszc8tKQUc2icjPb5onz2r6Dg/AGioR7kuqo/R3TKf+Smptmn12+TRKJraXunKV6HD0Ahtcx7HVLVshQvyXaWD7mbtDsXNx1RKajZZ/bobfApPZPJyICYE/25Rh6bMJv538FQPRlNPUqANNStio//TKKYSbNjh1DDtKw2AVRocZ8iiuRYC1FRyNHqDsVXP3bWu3MwMIyw7vRUUsYcmhzowzCMkKn3FHLa/uTfYdABbVDfJCKGYgiHR/2BtUkFLUYJlAUgqDYyxiCztYtMMiyR4KG1oR2RVAvfbgEJy5D+TFXzrOvmgPutBrLRDLmp3LRUJjKpu3GtHpn68TLS0fIInjbbwxdD9lXVkL7h0BQz5qGO/cu+rn92sQqbuDYV2BY1LPpKRiaFjyq6nma2dHcoVN7pk4ekjnEQW0mB763/O900xWI3c6bHYFsf7ewdW1lGYkQvO57SsXRrCfKO80DBOfDQMIS5IYJUMYpeRPOzwnfjxOITqn/uvWKsAkzEK/8Ji7u2MD0nxTRYv10l49p345mLOAJdXMVK/VlPqr2F71DhIIgqWSSEp1936cNyqh0IMAi+B3jdZODZ0bG06n0Wk8raAC8v+kVnpGboyPNR1HXuS4g0LLsa4GwTM7c1ExD5pMB/8mqOXu2YQGLlLpPdR9UoETYZ2vGm2WBw8nbP4w+8CwrftfruQjcnDSA//7eyKl4o8O9c/XoAQnWHC0EWbvJ3N9iXclSaTTF9xRTxdVROuneHV6ZsrK/p+R8ou0IIONQLF7Usli9uyH2JYHT8XjWTjT+ozW+dmEBz2wZoUXz9KQTaKAXxzFAuht1QDhGu/rtE3NIrPZk5GHUNKaqM79f3sqU2+whruufcNYfY/vYR0ty9hH1kgqgaD+X/xisyxdnTcosGs55CWWL4QzJTvM/4erT20p4qofUm8WRRlpGPENI6CvLsqI7+7rvMSIT9ye8EgEx23IHHk/XEaAU7IuuJz+DYD4Cz9AR31dSiLOwk16mvJIKtO6djokkLy83/K8M6vSVbv+M+IpPMRShtkRZmwZ6qtxDJOJw/Vz41jZ95DzmH323utUzd9uMCcbqmMNQyv9vt04YvCCZBAMPWW83RV20jdrCm7gAPT5F+YQ2gdJf/jls4u8ZkLJgH03nGhzoiqLmHKy65/uFl7D8t+iiqyF8uZ3pFYvgxQ+ZxtGkY8KtHFwbtmPb1BWfXBB2eupKeQi7SSbXtzkzrf780a0W7q6P3Bv+EjVQtFUUsxP/O7gEda0C/Aq+VvYa/63JltMop2wW3ly3EZsvvNEPCZDfDE6MTlV8WkmGWwjpnfLGr9txv3fx/LXuctAudaEiPbqA3Pelr+fY55BvxgWt/9B2oGKO54DCdmb76ka1RfLQbNZyWXoj1maezBsJoiUV+wF6BH+V0r40PnFLMlqCMafuDQLT7oMXPo8pW03odqMBb4Eb9hR7DnOe1mStZSe/0SYLc0/11yozEG6Ur0a/5uQEOnXGeLxupi3yWRQdbxWPc+EytdiE3IOeKyWi8sZt4+fZWB2jyshn9+k12hbxQb7SxiUBVw3P6qh34kmeUDc6bwscFny9AefGXbJT04NvK45D7Hb6xZTDTheSNKwSyd7uKuimhxUowEA8S6uu34E9SAY7j1dIKLqjWB0A4LY/08j9OMRGmmQjpQZMb5Z41lvJKXq4bdysFd3aPyhnYeihH6Qpu6E0eFuar3yWZIKv8/o0Ac7h9U8E2dykz+lZN1S0ihLuoiNBz3uhTxcC9/0+kSCG2AtykGs0RfMIF3zYR7Rp0cLMzjGGgFwQSGUOaxZr75JlidJZbUMrudWjvJtvCXLp97mEBnuRVEXVfjDZJZplTKzO6z27eq6ZvMdPpqgMLXqhjyg9jIZLrVj2hk1NYSII9kZesCt5VrBv3PU0rS/VnPBVY9yeFZocH6WLvYbGAj0wO75A0oPL8BzG5Q7VZoKKBiLx6o0p2GsAHQbW/Cm8uALSkDGvsmMxyolBUae8h/uImxF4e/z80vHdFBzDNqP1Ri+huTMAlsvNeuIucIM8or5hgJ9yQDpLyQmvGWXw7PXDaF94zapOSHegBBwSfp1Xfv/KS5XAvi6mqBhcHHzBHFPAs0Ipp56I2Rm7k8iUs9xjpVnnJA8fsBrbIdkQ9oKt4sy2IA55nyxulydB3jwfXKXubLp/OKRVReOlZvabV8iJ5YQaF0J90jgC3G7hk0ndPJedZPs/1csR0Z62QvtTPpddqEtONTIS3dlmaJvGZ6eqDNcguktDJTb8hf8UZBWxh31M2O/5/u88PNVGwJQjJ6XZ0K+cvUEM/9bAtIRiuV8Q8+ZRZDxWYCnR7jUMZMYP0EF+6FDSZaV2gtIY3d+2wB2BEj9Xb6794/4DiHx7oP4uSihGaNwhok5fFlocqTEP1CCUqTYGVUhJbev9sgCQuCIVoJmbhcqTG3rUf9nE+1ji+JfBbAlChd1lsnzS3lzuVvf9SxRx6yP6GnuryC72bcf4qNOkR99tv11PP0D/uh8TviwtBH3FF1Hj86HT3eSAmHwztdIFnnPbuQjrzi9eU0jS0hlsregmUmz9kVStD7t5gGskGZtsvYpGhvUa+ehEatxTUCWFyKZNKvdr0XcWU51SR5yMDI2K4DWwbBQqblXUgW1CB7fsmdAzTcCTCfPW4elexV+1tTYlZNnWJHUC9lPStwXbuq6DABw3vDzo8wIbZbm97CtW66twH2jWiovx/IR1A4qEF4i+Yoeuvx5jwaQRk71zugy0YMIkJAi4gA1FPzTalCeCP1lasqGHG0sV6TQ246J4NBoZm4AL565uRr2xwqg4bg6GWhAnnWkkPGjAxewSUQfEXASk44WGv8J5b10JQ6lElQHa8BycxO18crv2sFvwVY3vgNBqQe6wqrQpnvUwqrYYKzKW3YMa1gdyZPUGjGDecmDzzP98C9U6Iuu3Jq6Scout8Q/zA0Byz4qlTzk6pyIME/xTODyHU8r87ojkNJS4gSz0V3Cqt8aXY3SqKoLWslWOK3ye/1F+uRxfvMqqKiRvpCYdjdVclqf+olMwlQsJ3xxFD66j5fsqZNr4To7qJmWDgdmrjoqzeXfFPrFZssiKh74g/oYJ8I/fT81U/8BWbbSIlXBDNeF401kLIAmoAkxOfQu+a+GtUB9lTbcfXEyD0Dipgh5jGl1v3Icq3cJTCbgl4gStZrMaOUFCiG6BBoJTX1iBPAb1ljXfm2JKbJvjZAsu8hxKtJ1f2v+tUJt3ttr4r2AFo+WT5noitJ62wSm0o7HKBjmEANuOAMsLfbv/OKa3UM7EamiKC9pSEb42hjm6/BAOFAtlvhz4V+2smesbT8v4pu46pFRRo0571w2fad01HRHpZatC7XpFDux85O54a6zGwal/v2hVv1p+LIg5W5ztUrubZ0SugHjd1AFvQHQARO+k9y2hoTss7LU0Tu37StQVwAmigk9KUV6ffN20Cf1iI95XIAivqx7XTL2LLkPlOfLdE0UzSRjuqn21O9RrG8hFg2L8fJq1LEKDthb4A7h6epiINDB+8rTEIobwZ01vmfLsE94D5QXPUQMpopi+JkJSOXrZSscwifBkQOCg1NXajcBa2eLdqOOEWNfkSAQB8M+hpCybWflfsHJzQCJjghVFwVfWjo1ccDe+mIOEuA0lsdI3nCTI49XIdt2WCn5y2fSYkoyuHHIkMyBxWF4Kopn2tlDDb/AkcRW6XmjQmrmlrKME/pHPS5/NHzj1EVMGVGAcq6EKuAv8hKk5PMjPwtIQ5VA+02cOkf88WOFMqelP88sH5lNeieCcicZ/V5ZUHrnY0yus35RemhGJU82sCmqyIN6KW1eJ05ynls7/rCvGWY4GQo9EchukofKVj0WlhgApYe9Eds3V/B2RfreGN96NH62w06Jgc6EJrT03PC3onmsdJDFGutzLsHhWIMAW0vop00Z39jL4owE+iJrNQUkr25Pclh/oihYh1Q4J8/hVGP9qg5MmOx8+8ssmaOtWT2KY/ABSY9sWXAPBgdZpDrXuyLnSvdbi1WwuW6fSjKrARtrHNw6R9wZfk/zw4/K7w7Z8/W2R8G0fYjWjga6+5xyQIJdtLUNSrZZrUWXIOJzARZmOkh+VKuespf8OmFrUJ7GzPo473A+28n2nzcl/UZsSk6w+xhiJdY+jDx+6W5rJiHdpBosctLvCbGw7IXx13jIfhh5Tqsooz60jmLf8CULZXLc67aNLUgyjZykO1uvKMjPw5yAbVBCulCEVqHe0J0yBQH2Q3cuGvk/BIAQqfY8+7q8OV5cPooyILmojY5lfEG7awfwTSxyuTSmS/dg04KZoe8ctnQoHQVcEm06ugfdWE7v0smvue4zvHJJ8Qfp2leTQdGKmBeHZTvONrOkcZ4E1myQyEENSyQUs3GicYXCNBEpq2H5sPnvMoKlbdXwEH6ZuCZtt36n/HV6cJJneENX18A0KKVK2c5IIr7EmJ6uD41xwMf++xD7iCyNZm79uCKKZox3+V+8rZTcv6j1uK+bC/h70vRTEOEE8PdoBdwy0b0d7YfemcfDi5XgJRaq6coaxPFpqlwIFSu/MXzT9kqqVeXPmmhQMLP4xMBVDgG0kwNeUyNFCLpKRS4OqGfwxbW+ebvEvmxRRD3/jabFI7lwezXp48D/h6n5QSciJJMF0Npo0U2iMOCaDNm3UBDSQw54CgQR7fjSoSaCXHApGhFTRh7+u688swpBVL/FvAIWJusdjLqHc2oCPC2QO+ERvCTCWl7AOth4fkTQAtfVOrj4VM1Icqg6WxPH3mDGr1M9I1nS8CvHJp7HPzoqBpDNkhWc7Zio3AuHrfkWVJfqMdgIHVNRHVeRV91JmtybabzMRp7T3lIGynYYYFYiGRNSrOvtm8KqQGaSX+0ctYdRRJ8AmdlDSWJ2IS3kuQqm5fJnCq/2zdUR8WEYo8oeSxDT/K2ugtuggO1qxQr17lDhyGScOQAk/O2VVRcbk3If7ogxUOb+EvthiZaB1GOnGaJYPS032SasCFsfGMKekalz1n64ZgibQknTtUNJRH0nOafMMk2lpDv2HWsc1xH4UtMQkzbkAxFRZJBuy7dbIyj13jVavce8srS35WukVQ3pRjBeaYk2N/q9nyuvAtdUY7djYVJXA39+CBzI+D83eyD2sWrTmttAArB/1yMzGzbBDisoKLFDfYeweM21IGL78zCSNSFmbmVYXLjR/lqZVT5Gb2FiCFtW4yxGrIPMFhQ+tYvhpR7SN4FDYg9ZEx5bgAiv6zddt7H0ELhvngtSvJVyUm2f+gX+epD0iZUu9nceK7fKuHTpsyGjalxnd6au8jtbKAfcdF51Qc1DgZH7f0pDusNmZrReOWWvNkncQpIXXe/pFRJst7Sgt6WA1IyfDSHzhtgoSU8ouR/x4eCbGVewWKGg7RafMLc5tw2OSV0HwaFkQpugcBpR4xxa73GpJNaLUqbBxLrniNMHcVhYEq9NJe9+0iPcsr8J8Lm9GxiRZXI7XN3X32qjgHYh+61SqD0xd5fCpNDsP+XvE/Olp5iI9saiP2XIz/wS6Yf65tdJHfgUAN0fbcrPIawvdEfQ91x9XC+LExuG+srKCQ7jvrp+Rlh3sAoKPr/QqyZAtWj2r3D7aWRgy34myFrnUdN3eCGhAYl3Hn7Lc4nb6pvPaJQNgGGld/cXVYcmDhXzT9TolLWoDWTDM/VLCr6YeCw7jmr5TTwNT5sYfTDL/Uhw8UjBKHqLo2wQzGfWgAEFW6FmGZ71KAxVi/V48nhPoc2WzJHBsp3QvkBMYC0d6QNZnBigPfzAjJasg0O8mJKdiXAI5Xc4jLGXRcoMibuyrf6nziy3ZwSxtiYw7poiZxUn09OyRO8Y4J2aT6ezd6NZ1jAAyPwqfsO9F+2WhAJbaEABfo2iw1cPITDjGGQ4XZFViWSYbfp/ciZIBW5SDDug1JaXb1VIUepAYr9/WpfbWPSJrZFdE5XS0q83yI3/XH95z97vBI52ExrHIBNAEkc3qqfqwQvMCxm6RauPx+kPjTPPEMjr2STJHZ8AEzzfsLl0JbC0MZMgQyrJFqz620Ehnzz1utqSQ5Onz88c5Pr2HDhguirW5ue1nM2vJLFYHMZeGcpJ+e3Hfke/dMS/wrNib6xS1yoRQcbmEWM6os+mGQt2hySFBV/hc42e5ebSNqxLcx0clItsTu4bKRG1gekn9FQ4CW8/ABFy4zmgPw7rYCtfbwcaKiY7wOFEcLBv+R0tNJL/kPyRPSDE5Sx8NMVaTbTv2iFaCMNqE+tPilFpd8pPV839DlnfgQqy64JHvSXKYQ2j3qFAOVxLwMpMN7LP0FbvSKcTrpfeOt7ytjPZ0HGrar0wRMmIiBSrzKxnObc+PAGQCQG18u0F7BCGyskRJbmS0qtPan6LiTT44axPm+RvWQjyrpDcmHIsCS9/Jq15BDPACi9rOgB1pul5FaPSREcpD9UYMtc+JGuKDflJOG5pFmifjjOtMcet8iEEtg0zCtYhNMqKePOk+A6udQqNnmp5Xu43lRdtVkrT4nLtOAqWdotD6s0cqeJBr0Gtb/E6r2/NtjtHeUbzD1MmnREduMPF6tc75PxuCDkdpc5lTAPxQONYibXPTkKH5ujQWEhFpx0KCVbytQxThnN767m4muvUggH4PLFUKERRvo3EKG+onrtDTAcTTDIyTSmG3R24R/xnEUH+sCpfVyKM8UIxZkOV4DBIvFXxMg39QdaBDj/ZU9aNHh97Ml5gJCxt2MFHUHgahZBMgS6VqyDqWdy5j3tLbwXh/3DlmL0hdsBR3qxZsS8cvwxW5PBTzr7dWqgqgCvIQXH0TVkOlSI4bDXiYAkratOIDCkP3GYeMUz+Zpa5BmFb4+NifBDi4uDdOoK11WjCS0zdZzSuCmQF6ObObh4KFV+0MMagN85+7SsT2aa34Lqlb3FfX4KsA7pjajIGgMSh9Xq9etL2uear+aRjAAaqMupcVQtmRIBSrWha9NqQUbSOkYvUsqX7aBx9dcQFZQPTHClD04Wd7IHbihCayeyxJ2hftei+UHaiX5EPwhRVvWOVnaD+5EbaUPqN9qLQnyd/oVNzEkjQBdHubgrH6+RddKWxm9pY65iSVq3VF+yMZlmiBT0w1JOOsui6ifV/1pbrTfKr+2Piss9HBU4fcFFD+kDlLbE9peKIkZNCp2CrziywcbkRgv3r+7rEy5ejfY0MjjHCNdM2QAOb49DEkeExWvrKz3j2ni+pljEj7egOXVl4p1fkIBqZIay2bIxFGUjBUYyowcko+6dki3GxZtThpUToLJibCW0i6i2WJ7OLBiaQzgj5yLdr4n+XMnJfAI90vJz333dd6sMkAyCnrnImk6WoKzCJ9cf7BADeqNnzuV/SnSPM0QBuEQ1KYLNg41pUxaGYa37UY7MtPmhj/jStmNomZKI0F/VvdgOeCZFO4vdJd6b4J0F3AbyrTv5qTgqj62oT437kq57IpyUSsrwbwUGrmHUJ5p44vyho2U6r9e/FyOPwJV4KcIUP8L8XZFqV1+9rV6LL68vy7Loi9mxwE6tQoipF9swPK/oABVJCzZfKzCccqzmMQk4AQFPEM0pC4RpjIN4g3kYME+gaZnRWESoO4oJvrX1UGennZ70QLRjWRnI2zLWsyCHwlNhx4Z+KExzYeTv0n6uzR8akm6/dJMlfw1FNizrFosWtpGSrgFBs1twzfo69XsGF1fFa/NuZtmtdQ4b5kfRAIallzAek1zCNX4+vl3HwHipTB/s39Iwick7aPW7o3jtdPZ9/WuNZMKoZDAtTwoGaGLkfdpCzBe0+VLnsPIuFePez5DRDgZUYN2JSgAlJuIw036PY3qLSUa6Wb63e3xL863gs3Q7JraBDOMhxLRasIE99Fty1FQqOtPpSVL/1PXc27NvNO7G8t3Pwbd7fn6Bg9ATcXBN8lSmNyv7yrNzdDxp54+9uMkRdJP/CHZfHdEdr2KJ3ooZNK3j/05zjvAj83ql2F8l59JHV6f4VyRx0z1Xr8lclEHebsGEl6bywUVZn+jvH2Ib6z4eO5lp0CpRxulPgC4YCiJRtQTws8Oud4jmaiPLsgpM+czvb+t3+3HMhuLv5rCjrcDtt+wJrUb3pY1SrKwVo71vwBUIHbZZeeuwG8+lhb93CdAG0RSLeOF3kUBYl1/TtWW0g7hj4JUatZ+s6kK+fwa93PSh7+9YxIERS0HeqWyQiKfYhWR1gCv3wiKTXjsmB3A3KwachWM7REG1yX4QhWduVx/TG3yLQTNwHsq9KTy0Fviy53VLlDcigeFvqY1O9qDJzVfwMpnjODwBdybC1CAxGimtdEmmFsSIyneEuWT2rzzXSB+mq6K4FuQAC/vepXpE2AF8tNEvi/yhKbvTAqnk2caYXu/cA6WAT/33q4ahpBIDKSZhYaxOChF5EsKlMGO5RiROmE0Ode/+A1qOTCmgmJqQ99x/KrvsBhv1AEdNE9ne1IBGWWDitjIm1rGRo81W4z94Jg7mgBBZ36zEeFqItcSBHu130RWbiPXTHMqLId7ERUEH1WeZ1p1FbiDo3u/AGU8RPHG9Ugs0w0huB84wuJf+5NdGWrjNcsZ8V44apHiN1sBFXa5QhMAwTk2bGnkMS4nDuIvtLrXBIMWtSbHPG30N1eORSO0hEf8Qsaf5KYAbNcQ29+Y3Nb2xJCP8QCXl51S3kW9Zzp3UpLhi+FmTcPSp8ZtIiPIaOo7tB/rXdT6TesO8YdMpu/k+HC2KWh5DSyqMTC0jMre2+I1z1r62JpCAKJMdrfhpQGMU+ubMiEVwnqMmxlRiOxYUyMRYDMFNb/mKYZG/OMWZJeXnfgNd5rx4qZWGn4lI3c5hLKiDGdFBLJolscw0sBgrFdpFaYgr2I/PymOqikQQiyG3sPSnBFCdU+m+GEEhR2gjyDwNYAiIaogrtAcqbptzi/Oc5pXlwhLksj3KCvv/VJ57dUIGnEuXUaGXGLPipfyUx0mXgPGwzyOn4hMAw08ftxRsUUWB6cDLhwMGOzn2CkOaix8BX9b6ubbehLSky8lKyT33hU0iJYt0PzsYHvkKlraEfS50e3t2RYBtZDY57P16Tw/YTyyzbzC3VboSa1DJhRtm6CMoPoXn/OsSss4+HRp69NnZhTcyp7cXWEbPaZtNPui3kLm24pD3KS6NePsSaQbohXwAF4gYojbMoU5KwX6W/IIYZIwAIqiy1MHisX0NYaLpBzfYXHk2wudhw/O4FoFdI+jZ4BjT2QqDJWlgHEvsWjNT4jUxpzvSirH+v79NzHQWFQIm9RMzjtEcx6WF95VzLosHOfMJkS8KBrP9CA/QMqeu9TogU3Uj+w+MXU8XPw6TWeiQbumJHJlvQ3eyGXJLCnPtP99YaG4dKTqzQAozT4locP19WjR9MtiWXeSHy6Hb3HoYLpDjfoEGmtPNQOgGSOOPGn9gnJsoTgJfUW+VPXx7qBzlGI6VoPoFwY+PuFtZcbUUMHP5r97lAeHYHCkSYB1a4AZRQvNla/KehQnJo54Vc981csOD/aDMinDfoDV6vH9q3wHm5NG1tMuLXm9THr+5cJ7utruFwUuukGOcOkuoYNDctjK+8EJcvBVGdsltHzhnadtd3P3jikiXd4A5LA2XH1oQvCXfAfJIl/8C/V2Nlksw5ysE63wJmCo7LAoDK04x1t2OvFhHuS4mHKSmST6x85QpDFaGNZQ9a0fqzyLFoYxu0xlZAQXTA5YC8MXjmryIFVPZMT0zrDzJgJsbTra9PFFzl7pgGVq0GMeD6flCgQYozWo7NfkyWtSDk1k6De1XGYrv5WQ6BqKFKVilzsJxyt4NX/Ri8K8QanufJUx8melNRZ0Cd7/Ivu8d8l3ighpsqIXhoMF8cO95kCTybqb45nt8IzizfB/kpuvfzv/UUVewrvElBKdi9Vqabw3ClNh5VqVBZ/QhevNFiCiyi1z0XZtVgMkoMLLITaBoF/GbwByv/X5qWL3RD6ZTUwZbFGtLEDvpEv60ZHRWCZ2VZR6ILBjPl7mLmXcMJyJ5e0paloknVq4g8Mhwp6X6lm3IWIVqU9EDyw+ipErWSm/8MqGUfcpMO6Gbiqy8pnr+3EHoZqbwFStaeKjDdu0mC86TQQaZ6HZPT+tTBuwOymqGIAxUGJmA5JnytSIZBXywB/ptcQY5KY/L6Y+SWa6r0ZNC4QmmPEA9IftQPDZKI6qTu9WiulvWyiA7mpzgvtW6hoBqXAfIBT0FC2BOmT3xMx+7nsIguFYfdKSAHUQIAiPoHLjbUe3/yVku1KePdKKwakJ4dEkrSEDnnXIHu7U/eJLPAxzxvMIk+u4ns5y882dMS2d0h1NGAZiGqSGyHNGvi0PdWX5xgZv1yyChPr313H2B41Zj/o7UyHFyRosSXcmnYECTTTkNdWo3EpjZHphBeSKAfQMrJ85TJ8uzlGqshOIObbzxPY3G1WSsPJ8uCYgd4CCOrlbzTEl2xS/71eqXnuUbGbWBnciZ9j6skW/InDqB1TP0IC17QW/u5UUiDLgbCTNbUpE5VStLFHC+hk0FsrArPOMLQsTtSIKcjSyAYJLOfDli4ltkbwoo8FcxsjJdF+Ef7Z/I2npQGr+9LpKdckTiw3C3LFUjf0TLI7S7sEVBovLcIG0V0az3i05D/iD/XPu6Ma1FT/scK8uPpMZl69nt7IaC2HwZd15D2/uJrE8fTNF7SCD2ofKOjtzWEIkewO2pN6SofsA/vpQcPQne3f20JG/cHRYWg7IIETBtdINGMBxTiqZ4NtRAMv18Z65yCakil/2ST82TXiqUYNexslMhhSzwrqq9SuSiNN3L9upSkebhmuWn+L+n+cF2BukuIa2PldmKK/axigX/RiGGWnzMwex5cGPy7NHgG5kkfAt/lL1c6iG8XS98nwBBiERmSaD6sRQSh8pvQfGWB1xZuq4vjRQWXRea+7AHp0xcxNqWiLCkXGSUjEk7yhGATUcfXRPFztvcschB7AVSzCimF//TNN5H06vPlSGyo1Yeg+zGdpcHejZa4CI3TMsrArE4I6JOI5YOX/O8+j01IrfgoCDrUPHwLZV5ASFfMWVnujatGLOGzVFi4xMhYQoBCJ1OBp5tVFO0mBbTr/aekkKwfYq1NWp/38M+lhSj9qUeCUhtr3894t9xsWUFxgTFRsikyYqu+DgUbzJMZ7kESlS8Pxgq8nVcgeQQN/B0HnkX+5bb+DSSZ6Jbb+dh74XIDk8Dpc6Cq0yPFRMOpirdR7qB8kdlKXETy0hyUPBtwTK3/RxaQ609zdA7ikd56nl316GBc93at+0eEctr4HfbCR1rFuHAEkUUU0OCH7ydZa7OGNS+IBUvm9YA0yHfDtOHZ9BOITSRwEiMCC0w37ey9UQcHaXKFNN6P5MDO1KeDW5DtvlgT4Eq//vMfS5gYLilQjO59EuSek9q+4lc1+b8jOWtc86zZ0jC0rzzoFjnEkkK6zW+TgpUiFqW3GizgR4JwcaTa//IeZkcBStEbRvEiM9Yz3RHD1RYvAN5/RWMjMRzN0KlSOPovTK/IqiID+QoNVVUO+Mc62KXgmfGS8lRfZK2bqpXOmLSxRQkTd4C8l7dYYdYYiQkKqsV6QcgVUgNrf52OyP3lTNC+YkvSPwcFArYj3xTBPdHaMmVNeyinRs/Whxo9TWY0v8b4fyLrp5v0Ol4VprEBT2LughNJxrd5tr6v1MvN2ZnL4kQRLhfSdR5Vdo9CQwvNi0dnANXMsuXSJNGqil633RDWcptdQOqgPKtkbAgD6C19sBXeCuPr25IpejMmdSvT1SASJkeZddJBxvc9bw/HFasTjGhUGDFB6zrehSQdBfpa8CcFr2KWBPrOw0w3ENyWFLcyvZp3GN+rhvbE2hISf+z22iXZGj5TEQ5s8eLxqKRR4VuT8vLG6eeIgJdEeW4mY/XxuOlV3/zdZxYpl88VSzJ8wzEGF0gvi9rEqo0o+99ouEt2Fu9Qloqk10EkhvdHuJLFdiQbe0mj87pbTzd05y3wdW6cyTwImYFjpfyr2ba78tra8bWhvfIDgujgfPlKz5xquEzYuojcGSJ/kwIJ4n+7vRxfMR8ySGTw9PyvuRJfAlyq+mjeqax+REKU/Bg4HWA1aYjRwQ3OTNB3yLki8YudePEgo3RoJzOZtwoS1WpqNUJ3KNPE4nSKrU7m+LinN6ysl/60FnSjscYPP5smY+aJrib39jayXE69pdjhcuQmBI+GAWC59atK9MUXpGKChXgNmfIOdyB2uKsWaV1aXQftCNMtH36eskcn6p8bwzFkSqnA9VuSnZifgKG1UvOSveyxWP0QB2tfY8z4pdoGeQfD9BPk7POihtXQnhuIx5D/HVVi0AoEbTTtgNsLoZNtFxAejvJSbUL4WA70Oi9athSAxqg7hK/i3uT5cNIamTD2Dxc6hx/krJa+BNRAiX/dp2nCvCvJY9DwVzph6xlwIYY2yFaDb5+xMDs+WzzfJawJr1EPfo/kcJ0yC0NcnbwU5T6cw3Wkoj4Si6WoO8oEnObcMoENr2jUa/xmaQ6zo3mM7bVsakXw+41dtIaQegTMwG1zeWlHTHJi6ObkoEsnIJaVLLiTutEQEmaNc2Thp0UyyKB2PlfSGoUAZgif6+OIcYrPLpmERfXGrZra3XB1Ltg7Rcv/RSu0yO38I2NyohUYoRcKRm0FOlIM+PNazlKhwAQTliuw81ZpGa8BTAgNoLHB1VUKB3ZtVUuvKcmfDQ1o1pGto+bYAMF4/iDeooj9tMR/ogKMXigt6VPsmZ+VvToR+3MclnTR8cffWv7h7Tdnna2qhmnRt1AP+sGkym7mD1AjAUXBiWwOe0T+MYfzrwRED/LB+vINpb7C9SJMhM7Y4wZ90euy0i7jYcTgPrUUV4K+7pHSKV1v2MsU4Hla+XUAZQ5yzf74zH8elD0h5eFnKOJTZsir2gEnTTmlZ8bo7+hDcgNsWzzTBpN98CzUcmx3wcYFsMZu+wjtZkalxIS8U9PP7j25yfsed0bqjKb9ZehqGPWx3aHLhivxrUBPe1XjqzPprxpJqjEcKnjGhGHZIdfUWKdwAqPVXav9T/U3kCBvcrDQ2ecYJuVPScVrjplsbFuVnl8Vs4lNR7NDWeXn0FVNuzVMlVtHt+0UizNrvyMA790ciTtsc7glGhN4WcOi7PLuDpgX5ehcPeVnMhHbkgB/ATQ5hGD+4FI+q/OFd7AP0asmjizglFrybDdm3HEh8XAr/hNstbqpEVyY0X05rzfY36gTxFhSKz4bI4ibjSOYBeVTXVDorVs3mMyBO06kVLO9Chjb4EDrL2f7ynSm0xbKt2Dy67jqvYeBV7NvtoOE5ffJNSYpXD7q6StjJ2ftrqRMr4HAF4L9v+sv2/uLQQNxPIDsBsYQW/FN+bCIMlafdJrC+nhWnjlHf/sus1s4zFIKhluPbcqw1dSEmzZgzoufIb1uPTABVNrC89VcFQ7oM3B4lHQVLyyfLNTOrG9wANmwRW4O93NKzthENMo7ePiaLqM6MpHukL7sczcgJeOYgA7TsmdvOlTeQoOoMrukPxAKqgpE5YPZ/Hz3GdnDwuRDQZsKPUBSlxPXFVHP8B2Ws2r26ddPA47S8X5NjqQiM87baE01ZCLmem7N39XSh83C/HTnCWxGXd5ufdgh4rqSjFRSMo0FRwEWg6WLw+oGdOerhBJAsbUWEYaRJPjAcVV+KqawGKC/R+zjfRlfS8NkbiUVDWdcPSPto/F01V1qII0Rbm5z7V3ZqF8eRK9euIbXatetQwoc+C8UT8fIpZ9HYG4nDZmFVrTctuNL6D5SAh6gYfeW7fAcqi/wNgMZXYg9ay6V+uVH6qAD/1olVTV7B9UHAy8GuGXaIJZmBfmfBBlYGphTGJF5SK5tKyqENt1X2KcWiZXhZrhFUxVpQBOdHLaJawKwjzZTXdaSpulAxBok8tA2Xrj4xwBFw0DhMHyab5byTa+BktMHPLAshWYrjXBvpIwBKp5WQpvHl0+NLsEe0Bk4lJDMBmhw5TNaCYL8jZowgF8nzJH2yelNGkatKpdq5rgnZEUiDIhZm8FsMyFqbGOGg2A0Id3uEuA9ITqozYyMjEWRJKaiARQkDdz3lqW6NOTAkYQhYxcGixPScaRKZNokatUhZmOraVeVsbrWAlmMqAGs1nhvVLQDeITKiLARJXPCvW/+2FTBpoDBtsNn/85oCg9i7gnThQkHKKQhbhTLiRCyoDqY3hTIpiAuxSnSdgrr0Ge2/mDxZz2oLz4Spnd8q2lp9saV1jy/xcc+k9m5WKtHvyaWnqHI3fCoRWVTQfqwzn1R5Af9JI33HFuPhX3Pl4z5YCxPA9bfSmIjGLhupxRSlYnf2VArVPQOqhGq6nxNa9W2Fu3uzXkdtcInGT6NCKw2Vxs/32SRNZo89K7mlBpmldtKRcZzVqW1Q6n5OTACZHHpzcIRhQe3yL6StNl4dw6fUwg6/OcbIJ6xONRzZPQGZQkMqK/M0zrn5MnUNBbGTDut2Y+1EuYluiZ6f0CAthNF/e9aQhjHG4h2QVvAXOM+aJB3ApTrWjlu5TEhsEVoKysFUhiWdpYx3dJCbEDaKe6RDVHc0A9rokEM/iN3ouOjdZ1hXi7mX2QyHzN818s8jy4dqzADKzJT9wkrMHTm+xUij5g2j13RtLziPJoV/EdOOXIaM7RxxiOPDSQflrEv5jOyEQpUyWhZGASTsvsGBCKDYMEU67NH2O8aKOOhROdDNP6TaEJ5JBuaEwcUHjF23aZXLAAKu08BPvrF3iL8laZTWtLzND03JQ5mGGXqOa2VHvhY6Sd7zNsKcULR43z9pdhbYT+1Jh3kLMqbrEPWkhTOgGYvCDVKP/Sl3TOunhJEpCVStE0wMyCTqx+FO06HH/ph6TtDACw70XHYUo/T0uGgtCNYV2WrBxKZjARHtGSzi50wtpVJMvk/zaOHIjMf+G6/jwSnU5FEW1dC0C518+S3Guo2v6a27TG22XyL6xcBI1QdELO//cxDQl9DXOct5nj29VqBEbk68TE2GGisVIIQuSzafT2atZrrs26o0CQ6Hlnp9G1sw1wTyAZsMbQALsEeGHdkjPsV1wU5PJh18+bJaQMXtF/owBUhFPtxnk4nmOcSKWaetV7wq55D23r3kwC350u6HyzeLhmJjAhsyTVQt3rP5JI/gHdiJ2Nnju5NPhM1TORr3igZWRqmoDpLC5oguP3lVtmYgNY4FhZ+jxxw5kyJQhHiwE5bZhu5f8hRlGS1CpOXYfMNcz4AxLbPZz2S6sKRPpKLTTxs5hXHfoZDadF7ABJqK197/OU9cXD8lEPmXoWqxUIUmWr2jZaA9aO875NgEvQGPznY+w7fedrx4Q6P23SG0hmlVEAB5pkHHdxBwMSUxI/zaZev+7GPh2eea/AP/5D8XJWsi+on3WVXxKLgSFXH47EtfP+w+cKQsYy+HBFZKMxxAs3Up8bqYhwnuLwr4wuN+VYtZhzUY3SSgsF2bb8t//jKBJlpmuR9Nm3WmU/A4nGFUNH641JUEsJ5DuL9K5y0wLwBpOI5bn6VmvnPDsZwjglUSA+LHG9iCrDRUEbPob0QalLUmzGBdEm2QnfK+LKw7KP/35oy4M9uPDZYWMJ++1q3Elwqpl6SrpUBdIuKGIspCh9mIoM0dOnsdT+m/VKaBRuPaCDQHuZEt/6kzFbFKKiIk3l/+vCYST2KY2qheuAfJQ3KrTbwDv3GlIAdhSY15FErnJo3EmYsI+cp6X8xWztA4/+XWendC1RsqRFlG4lJUAHorSG1TkeNsRj1XQWE6V34KtOl5nbC8E/uSlpYOSiPr3vFi4G4mY4+MYoYcXDqQLGKWG2F9yhbvQQEe+I7JdlJUCGjB8HP6H+cFq7Gj8/82bu4qhBvJuQak8yaQhsqU7neiNLlW+vYfsFR9+L2evKg84wS1rOLP0R9jJHNaxU3t4gOfxrIEXcEvnFI/6Vzlm28cX+ggBUKwxV9yYWKvsc+HgxQ8ym3139w126LRsWbKmpmZoIQtD3vywxOJoKNpMK22if30ugjxrUP6V2NinynpEY+pq/cCjxzfQTqXeuZ8bg65RGYlAApQMbGyLoonQsbnSmQ37lG46nqcMFTtWxg6ZiWrg8WTf8FeWWAx5Pff2Eijbev9wkuFG/r7Hw4+3p4e33nFf2ZYm3i803+kG8XFDNL46/+JloFX86rdp40pSktcTGsTTZJwAo0BKJn4L3W46YrE57njZgd4Sd9IRh3YXSbo3D2slCkkq0LER27V8YetU0kWeGpLRWlgE3JwDsqEGWhqRhcw6odQSkkxk86mlCaqnlE0HL+zck3pgbGVBPBEk4/PWcSAfcHtau6z8FO2R9bPRL5b+9o13V2pH/TGbkEcZhbHIHm8NAsNp7tSCrgcMxHAE9w9W0hBQ9dCo4PPskOereBnHECtuud4BShtCwetFCB7jq7ghwJvoWfRudwyZOVQKEEqHy+6Q6GDYwPZ1u6BQlcV0yviuJPJ4kka2wb1S745I21gwdAFuip6WtoVmOayPo4mt8H2VRhkDENDCF0SD8ggfwJZel8jXZqbIoLYQ4P7oixfh3GiwnzCyQIYVf2e1nXnEVgMW5p2MPPS8itMr8MRZ6pvXxV5Ssyx+5k5f28wCbFytYhgEA+su3Jvn+nPdQBoFtIUk3jsjbNBflEd5fRwN9JFkpwJUEQ8BOMtmy7cr//IqMA4CaN62soyQMJymfur83RrcBdA2nL0c81/7NkkWQSEO8vXeg1yXN4qW2mqNw9Ehl27oy41hHNNjupUARF3R20IdGJVbpc15DiQfsq2H/Eyaw8hvXmYiVDfyQHz+zp5KTBiNDvRAce8/wIy94BatTGQy98gDfj7AQjQGlEitKnA4XMfESCOhuMgT5iUVu8eRH1PMlG1ZQbZCDCSaGdcm3EQf7sOjlw7rGSHOPYL2dxizieWrh0Ds4PHlqEFNuAbGShfz/W+qEIZfkAg/WdUZqF3oote7omxdEsoleqLKZrdKya9FgLJCyKkHwvD7Zns4QBpx9o2GFoXwqc4XkHGpcxsMq5hnW0atltBE6SNxHykWsCJc7mYr3qVmu/sj+0ozbn/eyqZZBRtwpqbE4bnhP65rRcWiJ8okX+9NM0YFM12lNTO0qJTErbRFiCmFEsPYYVjF+5czlKduAdtxcZOPOaTypc2J8gvmK1Byv+aCyhpNQy2qH8PfGSUcIVslmlS75rUeU5AcTg5Vl3kjhsVyIzqWcMmLtT7b/3wF9g3NyUn7dGTV6+bODQPc6joXTuE3zTbLkAB3VTQMXzaSrUXB0vIe3/fHhO6/1upRVgE9AiTECqksm6zDJ2dO6D8tQ7NE9m248vKip0fokJcoKBeM6BYjOCV7p1rRbBzBOudZF/Jmp8XfWixWPQj/HUmWL+//7t/VAdaW1RhAtDkn6WX64auWhZmIH69romuNFRyDm2KtOV7tT24YFtyF+ahFaj+nyPGPhBuCrrg6QGZSFRglb/KceTYCa9YiIO31v0jMTPz5PVt0B69ZYGwQ3OBm44Ntn2CyMNk+7V6+iNk8utqkajqLCskWmSj+OCF6oJ1bI7qft1zas+xFznB04E0aUtKHpdnErtdhyECCJSMQnPnZPU9FVs27Hyx3tlNZEoZEitxYevuUvpRoUYDALpOoBRqZlfL6oIlavFF+NxOyQ0Sfnhmofi4km0qJPkHvAIaaPHhXgv8mp/mX4QmYDu4sNOMYLGboZD0c6O6S7vpzxK2WdrrM9083eFYiThBL7ZWSl8wMQKeL/070eT4Z4/kXI/QYiw0Me4XDtDb2SpS2Iecg8BudNYvxtpSnquDMWbauf9rkko6rocO4kVjglM6nK8/0CKQXU9vhEJRIGKhB+wjC1zwFuAvjb4GgrItiVP86I08a5kMmQwevP/YE3faxK5ZzIa09msD+2LJ9o0pghaZDIJQfpeDgpStSNgfCpHqGPRQ8H0L7WAPJwGzfEfBYtkCEeB028MCFeiCnIC2hQ5hSp+fgn2QyfR61S4jK/THpGpp6vzOrdml3XubC1g0s0cKOGSFrtoxaHszvJ6v8r78IXHmnXZtU9TRe6QTDPdFi25VirkK57D+MKFT+DbHXDDbjpbB0oYWhCpz50oq1gxnxT5Qi7cEZmGCTv7Mu1Ok9HXVwn/dObLcUwLAxmws+1j5m/auHXA4htrIGX18DU4JpLKDnSzDrtLXmz+f96TVgfM2j+7gcKLiZv6VrhThuHMjeevFyuhG9QiIJECIricn2oRYzGmtJ/qe4KdZhdcdHdL/cULiR9bC9dm9qBZbbOMGWar8oBbCqlyq16DXzBwC8X46/yTHVzLJc6bnl3CzrFA5GaY+xS1EZ0yR7IES/wXWVrZldiOZJGQD/a7Q3f3D8cbHYPF6cwh/lGAr1S4Vi/TbHYgXHt3qK9lMwpEWvC7m3nxU6mPbb2sa+CgjThAGgSioB22ZmmVA9L6MuT0sx84L+W9nLgx63w354daXePPH6Ox4eov9R4vSEhcaCFWu9CxZgH68LrmvktqFZI5tCH/oheXyaJP7atqcP96uK7XIWLx+74gGkTjs6dk8mj5rPVY6AC6mTcs7an17mTsXM5T5ysosjFd3i2pO650Y415N2YXLaBJ6xN6TmL3pVzv+4ST6LTrAWfjDC2ECA64FrXQRs1HFDjW7Pq+9TwaLJP5owF05CmQqmMuOMFWZ8Nf6SZXfOYMJYDPLI70uPmf9KQLDB9ZVaxl9Jhxup3OIEfKoiecr5OVa/AwN7A2/sL6eK3dnYEsK6dGvKKvAMDaff34+KWOtWz4PsxGtTnWwLUas4Sm0OkWDcKnRWx/ptCEWo9eY8rJcL0A7NVeicj5qK7IM+DY7FnmPuEU8dOIDNOz6phthrQ9kh9KnUp4HCLdgKtxALtNOh7qgo8wReyVarwcP0eBdA6mxLM4gVdbU0sxKrqiFdq+qSC19QtCuSENS7MN+NPX5AZisodoiYQHEqiQUrphCUGi0+zoc0kEoS70Eoh1DN/BpP7i7u/isAi122EbBtsGkVZ+SAYTZyc22waBgiFpvHOscI2pJO+ZZdMomH5b6ZomPPhIPp+KYUvAkwl0UEg/0POk7UHOELNv9uIvXDRrPWUg2IxfKnN5H2eCl3Y5tYMSK5dm/WhWdml1GgepMEc3cUYHiUk8ayos3tVGBKcNpW9BXzhEOAZo7EWy5NjSOFZlUslrgFdjFdndmbb1itYfmwa3g63/Mu1l/TzgX+YidLisIRQylI7uRHf42xbEusO7pvWG9L5i/9uzdaS6Q27mHCliTURdwDZSBs6Y8QGFJGHP0L0bCaeIakmhFkIN7SQGtz0yksSkpng8mngwwidFThYkKvxdv5ZWgowrdI6aUg3BlWX+6ybbjH9eDMgHcEL2j6qAr2QUSot3SbExkvlQpV7tIyEKqrmVnvsptmLmTVS9LU92M+d9K+uVBIm765Or2JgF44j5zh+taGpoxTXPR5tURCEcvAdVZYfxEiTFEHWpZX0gbtqNIkeY+llRzbYxldAg1XqFEx8xT3UZGQJjDoFYM3vi+HHJ7hsgRYzk7VDqK5HMh6rHHBUm8YQAfaAIeiOqZgDakwXNUSBKzZwDohMEuTSXeOzrbdb3f8qFDPyjUai7DG+nVD9+yyrmL3qvU45lNJ59ndbfRYgmhv5iFyCrqR5tnw9i9zaK23GRujoeCX3M5ZhV7e2LHP2qlT8JIHJy7vorTgJKxZB5fYxoI/huN86GKdDiB/XZNtHAGMs5BxX9P/tl7ScyicN6BBZB4HUrQ5oWV5nd1eXAcoHx0vrRYs5kcjxanNEddZ7Q/My8ikKneZkyG7ksHke0Gd1nXStWuT2pFd9ziwKFBdIJVAUELWAsjsBejXvWcgNGpZU2pMRH5FKY15xBxTBb/XZ+FcvLHXeoLbYJEKqOZYqqMCIrTl3EAl96dqNGG21eEJgt0YaGy0B/WC0Lj/+YVPdMfdpUuWtAIobz4FYl7qn4BSDvcZG8bYRTaDo7QtnZ7MyamdJwylDezMJrrUccbtDkOOwuDZdkcca+gfHwRveDInIQ/rTEZzEBQh4CLkBcdr9yu1uXcDO6z30mu90J1f4xe5CxHAP8XFdM5JaWS6i1ycI2sl655uJFyzev6jo2vQl+GQLHM4s4Rn1N5hYWesOCBrcs3JonaAMd0wJRwd849JnmFJ1QGDMCoMMdiaAn3yVq9zcqkAx7O6pa1G11e2lukRaFXdEq/wzKKaeXcaAyTzL2Kz2UVlBLwnb2Cj2gxEmjHgn0Nla3rtZhseiHNPPFF8fzDDUqQY7D6OzNnDOa1pzwYEoZ0YZH35GiVRFtKAeWNnmcIFhbnvcyDdjl04TYUE+033/IHfshrvlnGIdCF6t9dPFGlG4w09jncD1sw+k6Pp5gTa9qSvVGINbNF54EkBvx663Yv/RBNvQ6CbuUcQaJdAjrD9j6wmEknOYVYu1MCaGIvKkv1iyB2Ce8LRqdp9tZfATO1cJAPJsA1ekwzhBDWcqeMOlHczIrqW1MQ+/95sIH2W2AbVg2pRNwCgeJO0Y5AnoYIIlA3GSMKZv1hWYXoN0cl1Vk9rXKN97FK+bMgvE8/XXJbgadK+JWDGV200E/+zEkhkmPEKPksYHLWIp/ihCjkfV+1w5Kdkj1A3+hzTZ3teH8rb6WEqsLop7TUHZwxEamxMJ5TKNFFJQ0d1x+xrNU7JnNklyL5pvYo++MAByqCgcqWcVEzbAZjyljOxrFnIwB0TNqeiNxW7KqLbcknGWBGLRjmctSF28yNxP4rmsz3YOft9f2kqyrIn9U0mRBihX51lSNHKYI21wA+hnCCqBOvk8YIC/8yZG97hh9Wy6Bx+NgnYgakfMiaBVR1hM+Ffs5j87xNW4KDVTsUZdBjY72U9eQTQ0lsWifgDeFleqOa1Juu8eNdSFPk4EEmDq10UM2BqdFQGY7jks9U9bD5EhnGHB7Th6lVtGN+anfyyQJgVKwrQ5VDotz2ZlhJkDUZVzGmLCJ1SuNskgXlzgwHretiCQGPCB4Kv3XrmRPZbzi8WcNNkj4lLgZOGbzpTpQgeXkM8GON7BR1Yl67UaYdRE9Bqqop58znbC0aT4H2tIO4ZXyw4dJTHbzuNDmDFYoO7p7SHUtt3E6qBZWWnV1x1nlfL2/9O2VD3iylpyGv5XQWXoc7X4GUVGaLwzj5b6NDP4QRalSP+0xX4CPaal1mckennDBhUbWczbmIpKeTld2t9reL2mImg5CP2Rd0l+g0+NLijhaGyXeMvqEAlk6eQANEP+XK9tuM8Hw2G9FCEqIPKsoCqXqJOTfEdBh6ULDf0Qfs2Kmk6XL5Uw3jC19vksKL9ruOHcVGqVWG6JTRdPFOiw4IBVfiyqRZtvBNbRig5UhU6uNR4yOiLGqcUcxPVabqsvd11s+IPC9SMhW2McOmAvym4YKxpJYSU/jsTVQ9ygpWtq8k0/3SNnwUlZgyOgBA1CW53lVzOV+eYGpOFTEiJIJFoUePKodB11PSg6iaWISiy6Wzw78+aQGcdOVmtOGq0fiEoCZWy0/MWnR3+sXwnnYbV77Yzhl48gn2HwFOdLov9EnSQQeD4Q6UMeUT/GXWSaVok30IQIU7HmxD0lMUNKLLnP6s+hYrFr04xeCyzrLWg+sgCcvznlhli+yeQsh6imxMUmk4wZKIFnEDo/KPlK0NOtyo3xu/rWmA3lFF/4WMiuiSXjReqxybN5bXz+BE7BJdvdMoIliLOVz849J/tGCyWG3189yCp5kMF5bVf74ixyh4ASgrnaZyoFURsnkWMErWbjYZf4Ttegff74MePWwddwMErt0CIqih14oX9eKllr0Vg3P1YB5O1yc79HcFmZuXMuXlhVo+5OwMIjvb5CVym84PfboIoc1ts3lZqM8BBrXIhd14Bk65sSG5ESzZV7Flx/5akktwwGCCi/AxeK/o0BXpo4nN6cuHxhzvpEHT7koLPG2lPb8sKzfoHOtgKomwl21EgIB+3AjjRl9a+5HLhy7NwstN/UjV8DJAkUC5eBMf0ClMQsWN/FMf4EKEAAO3JgESHpsxrdu53MSPWS5Ij26s5HzgooztuCaABfPbkb7XrFdbygfItgw5iA+dj9St8q7uhUHAwW2Tyif7hhzS6MR0zyIAsEpkzN7FZarl8UIsZ/Tp9LGX7OSuxW6JAl1DtYd7CNHifXRwKv/PcJAMG3WOTihKoeA5k1vFyCAzDH4F813AAjgp6I12CkZDAexq2zKzJq0PoTwrXyQAmOxAW4QqA0QriOoxQzIG3XCZEUd1TPDBQIWfsh9b6aeBGdU1WB3Q2Y9+ygiu0MXAWvdH/niJxcLq+Ez3cGx7KDy0J/ixES5IBxDLTHermiFJ0S+B1/Vikh5eDVZtw4kJjVja+gF8Iht9u/EXgxf246Rnxt1TtS05eQEQblIuT8s9M38rm9uU4GGIEnnhdmzkO4QBHKl82gx5vUe7MqmvwMGOb0c+kZWSx8go6MdrK2B6Ao2oB16/+Bx0ou4hNggefSkiBPIADS6cj+kwoJyh0vIBe5+Qu2H2K+Kit75lMwAqOSfb4gLiCEPgGd5egei/P0AVxBP+ufoLkPU9MzYa7xxfRIab40NMj44fARcKELELw0MdzY2blyftG738OYfE0GkCarwRnBNigfeAU4mnVuiQuRXPv69TlDtvQ0JDoXKGVxjCFPhPonRZ8D5jwLIdYNwLIqDGMk7ZApdfLKfbTqjR5zfYh00ncK9lInJYzXvlELyCUHXi2/zdFnGtpc8DtGp891jZUW6bsyVmX8pfBjRk7VfX9aZDPw9NjcjmlmkNy7ca+o62fZAQ+j99IlRwn/0eShlpI9YrBNKFHui0mfTX6EfwRzW88tNcbb0yPBdB3wAi/+pmU6gazbNFRWYwRc/pmxekOOGbJc8OhTebr3S0YSGpGeLl7WxPdwUNzSNtjyDyV4jmwUeEYr99uZax+tDxyAWdwY/VnxYTE5Y/NrJY8lXr2r07uru/jSHe9Fedqe4CFSECx3nGPtqu42tYqE+jZaIEzOgewduAs8i3kPA6VQ1msZDFgCUjlqqUssXTET7SyVtQiF6BnmTZIDo+Hkjj4yowGn8opGQViaKnCbJ/EW47d9lTBLNs4D7NMHPkM08S6IjHsKEQ/BybDeLpVkLSsaSPWp7Ilwe4f9QSvJm5wWoHDQ1c+MmSB0KOauO46CgW+5mW73tN3WsfeOWRFj8rJpbFGgaI/LgEhC9CsZ8xnFtJsxElVKF9LMHh3b+UvMau4ZaJu3kI0mSaeueZuDj2D41Au92Xuiwu8TztGrrQcuTt/0qHELjVYgHMh3nHRxNS2XukEO5JFCckLuu2D43FzH5b+VR5xEC8sIkzhVgKzhuvpEMhFlfvAqssLAets/TY4CNeGcAWH2KSpcEwZZ1k4fG/zquLisWsl7MRuUYagXLPre3nJxSBhoGLAXS51TPhBAxuC3DO0DnDR2E9MWDBTUOi7jEL3PhD4N1hzkcqeaRPDgCexxV1iM5RBuu++Mrk5STUmvzB7CBkADLklLUnkDzwm9Ls+2bNIiL3/47UM9lXSDBvn5CHOu71ew2TfLazL8HTSi5WmNyzihA9kCpcbVvayfGP9oIj2eHo2GTE2VwS5E8Asvz8N0qr+XuQEuqlxF3TeT4vusvh7gbOr7GCyU3ax6VQtAQ3x1+bp3SX/haERTjv0bHWGtgV7tvWOsRpsF7MXymDw9CE+6h82Vip+l4ZErKenPEBfcwgxU6iXG38V+uWKiDotyL/SIKLDiJXoLqGrKvsoPDW2qQ5+mN5zj7DNsZTDwBDN+/07M4dvkiE0xX5HW03UwM85QduA0DFZi0BBB6BVj3Bm2J75hkJLwwnffoHHiD98nB1cd5kFtetxyroWEgFJnV4dzu6eCiInH7k/PM6LpI7KU+MHRhdfoR+PQsyKoWloy9Bxs00SoP9Q+0wyYwnh6ISETjCOfLxJhpllXe8J8Jdi0ntCu5DPa5qA0i1iqSa7mF4bS2mnz2kB0sexuGxsSFlzlsWqBtru3+2fVCq9J6nyPfNDunDOVLsOq7OZV6PrGvgm0orDxfRWI9GUMjtTxaGC/ikw/wot8BAfigAihBv0NUEZJka6jU7eWwuES7Zk51XUWBhWNUehp5s5la8hrEvPa9XXhHD5iO2VEp4AAc05UUsLeB/W6wbPWchl049f9OWMQnNwGsM+8GzGC4j5rK3aVxzv2Ai6dLLUNJOheYiWsacluVxQHRgaQRUv4mPCC5yprgWo9LwGhVnG3/OzrQ4cWInvLtzR/poKIKAkbj/j25CMPJfbDHBIoqwvy+mcawbVK2EiuK9mHnYs+K21iJubVUJ5kC0NM1AizKgScwEH+RTWNUJftVcuTkdSMMDLKag6bVCw5wZRgnA7DVrS7LoWXGVV5snV8GQXwgAxytBjZEZptwh9kMzbH/GAQazFzo2elY3o14qUZzPwzMrKcySfWAN+2igIHNH16n0KsvdQwVLslMF/2dkKLAF6sApunlFBUx457dCxvuhesztedvyPXEIqrqH2NRjAhvP7bGgocuW694adsx22i+UeEMN/LzDuGH4laDU6qYNSlwsPDYYG9Oiu2iQsdX/rVstRJFXhe+0g/x1H6oeyO5f5mdBx9ugMr+5CZnmoYIyVxCsguTC9E1rCDc1M+Dv1a9240RU9Bth0RV0IS7jdFrSzG6Z8zsLTIhJMEqGCDZAJCLgI8nwKVt56fzizI85ZgpRgTgIe4yVP7te9S7G43kPULNj7QZJHf/zo2S20YmZ7gEcdIDXmw7OpbJerzFtXCza6vJE/aFcByKhY9trkH56MmThc+1I289Law7PyzBo8DdyM9pcGNyCvvDZ4+QMrYXilWRP+6bCcSX3VRtiWwwDk5LX1U3v4kfFxSxK9huH5nYCpSIzdnAXKAQbbujFf3NcDegVURlKo6h8KIdFx7tFhss9AD2AF9HjQCoIqorqGiRmuqbCd5XVKOorZGVpaABBp135A1RrVZAmRtyt4r4K/cS5iVa8OneQTWoy6wqkyXwytQjLRdPvkkGToPAHutXXgatjUHBVAKiJPQyy0F/1HW/+wbgAFhQKOFWdkW/mnzKEo4Zub1rPBnyMc3SI80BHquLJkojgfzPCg8udsK8gG0L1FbSOcpsZtj+iixT1S74PKWLf+kK0fElFkJjnOkvF36vDSdsTw+4Gp2ki5g4OkxcluDxgehRLYFWuNCC1KJUtApr17AhBeTk8Eh32fC14GsfXUz3KzyyWYSEB9Mo/BW5lCekGl/SCCcXa//Yby7k6VYNpUuM3kJQjCSLlhjK/R/6aKJJCUzmy2E7KcN2R5PBvZ1z4ujBc4oFF2UkFIEdLf4+wihkwspMBdMzx/QDe7wOA9SDJmtg2FgJoyOhDn/ihMMyA5gJOxrcauMU+8DQuAaJdhPujCBZK40eBB9PnkrlQVlPu1REc8S6vSQc4AJrd2+MogGgqtK2L6iHIsQfpw0yDI5stVfIX0lZkyKTG5QUYfMNPDCRdumy3a+cmif3h0kTzLlQ44FnsPlIHZ0ApONn3/vPEwUsKlHLGBoPA9iUENBsdy5wIN5xQHhqeAua/+RQc7NeKbimxnBA3gaFIYXVyC8IHGs2W/c/UegZ3gZ2MXLbHfJiGjn+4gTwP+O/vK/NNsSZjLeyjtjb6ucx+kdbh7sGg6tmUMFkoCHfh/YlLUnXmRHvC5E0Tnet90jp+L6yifDBAZPqB+5/l6OCHNjqE6TcFPcP0FIzFXWGluWtOS6dR/m9+CuxfmFdPUkmhqwfFP5xq8PTIXT0J7/jugc0/yhGd1jyPbvkDoGoEB0BNhRXmbwCJMeWJy9XzVDG0c9VdB/VaMCzqTP80IWav/nAPXtUormEKcfJwaYos1qBy2+I/ebsumW+z7w1UNkhM7xrP447TM14BGrtPUTzHYZX6Kng0iuDvgrXwQFkUJv3TB9fZAYp4iokc353AzwVb+HW2dgHea58cK3Zn1Gcmssb2z7BChe8uZIZFywL5+x15tv89KuFisoMC03XSg02BjztyqzX/9U7GCXcz9cQ24b8qB3RDCHvF0PElyyxa5kt9ibkMHloRdgyRKCyMqhMdFClKsmT+7/mej/+KoeOmd6fukTZY1Y0FxOY9UBSludKj+JShTZys+LrAtC8h6wlnpdhSsrwyxq3LuepmW22AsqP7o2MxQLKQdjr921Elacy36Z5fSNrYGPgaE0sr1ixgWrV6sJjblTDR35lKNoz7TH0oXkpn+iUgeRm1OWbrKxPEd5a9JuJgl4wUFonp9iY+iKLV4H89PmVV23PujG8oT22vIOaAshj8xF6A4f70NzmwogNd8I3Dxo4wY2OZGSIg7q17wLulCpHJqfE83oSUcHEyv0wBx1QUBLCiUFCBHFBJBTcEfnkXaF/QjPivWJ3uHVSPG5zMJmenv2fgip20sknIPsPrPYCRKhgzWDV4BLDGBkmCMsoWhS2sxoYQuPC89e4TQjy1ljiUZr1zfei1uoP1AK+pvVJ7sqmOcA3N2+l5hQjQ+VCQGWYZXzIHJ3tM2Rt3JIs/78r4+QajWXpStM5MEA+w3EDuug27ph7Oscvc/ZdUxs0J96C6bzio9/0/x3Cw+A2WkoXhaIe+XSTqhwqhMnNS+Fgihy56qxNTR2Hz97AUXbrXFIbV/haK3mcUIpHdIQCV0O5oCX+wL0LpYR066JWvsIfWgKmBsQY0t1c9mYzIk9XL4781A6XCFrrUaGXrMbTAUdHmvXFcjXEVHpmaIrhhAPJuVs7pvXqoG4cnaRuyzrYq7m6TvWFOc4CAb2P7iM14d7OMLOdQdD/5lxtZUF5AzryMCnl92JUtMHOMS1bSJNFoe0ojsy+6jda1ZnUUqxPu20QM7y6rytBMU6icWgFfBM0vTW3JMN2ULnYqSxpI/8SVIfsWMmctB4jgpfqpkczPZBilYPiqx3Q/VKU+2AdPDLY2QuOzWv7M00Q4u1AvMRA0HwbGQCWpV9DIEOiWc1IDwoO510s3l0UYp3p3uGvEnPllqNyKxAg1py/aHbbZGlSgaKJe8wklZhNDch+d8/ZNYOOZnBf0kLfNd1lgWUgsavyK8Jh/xa4fwAsq4k2zqGl6bMUDH4r1G2oK1XVnE9xVYNCzgAEmWRFcVqgoQpNbbeuUXz3WSrFpf2G8OXfGOw4xu1ztmnBQwus+k8YR0MnxVeYAMmiAYAQ277CLfWAqpGG0apL7i+I9dVcvETOq1lva+7dbkcTn5Mb2DooYbtYlvKPAmvlfN9WTSy5DoCRxRNy9IqKtVxH8mtOWR9ki4yGbUz4dURJG4cpPwe3TadPF4E8any+6tcvEyqSbki+21XFi2M7Y2Q5yDzeWzvczUYpe+wi7zH8ELGEFeBYYSeYHWYLwlVb5IemIYzke0rNyJC5l1A9YdmnZ/ti/nKiHUCMflCZz9Fm/2rKwxmds5CAg5MXkGjn+YOZQ37wWff9H2NXiioK/OvsluudcGJr4F7JpkMQnY+5HRenUo1AQHy2C6nAUSiF1cwXfUMGdeujWo5XoSGPNu5JVG9KdmlUc9zQ/m+Gd3g7+ZNkn3t8GKWHYkc1BWlbCuH2621LLNqzaZSGgUevfuc53BkU31/BnAUVqjoTzXNZZdjEjAlt6SvIR/10roYfnfFTrEsTZpz8oaHCkxbVHKxhC5uzk6NB7tCoZwprNhMCLWEN9X0giBpF6cYvKhnIvxT/HVbIRO+dDDUEZOF1lxyxUc6I+m/3jIZyc1Z3/Qg2L/RcT3Tx6scc9Zgo72nLJGTW6UpxvOeF+oJAYXuZ4y4djd+wBeNKIETkg1sYEelG9LIotCjPp5m/OSbue2pZHIn5ZalZMBZx9W8TdfwtL+GzHmUHUMlZSUkVCTStK5XjjUt6YrH0HTo1SGBCx/UjUWUXL0XRpcQ+lu30Nl94d8lhPTd2e9/fvVSxdwKNWwqVGyHEujma/PwDPb6gnvYnK03XX/RgS7AWc6wPzNKoIivP5LLJWt/MG/HTKUKFvzWGtJle8WOI5vd2yHBWWo4nTwko+59doE4t7yJtBnNZaQYV5AmiWrc+f4WEi7gHu+pCiBQ0jEY6sCci5MHehEzhgpjefJxx/TvYKgPBacTiOki6nsY/af/huOcz2bYd6ml4SQ2INr6N7w1c589Uiobzp+z7Gp6+6TgcsW5vx6m2aiAWWT7tcVlXvYBnUAm8Nxdrr2PIvT2Mj3JCm4qK8nVGu0G65Yo7sdF9cFVUpk6vl86itrktkbsWlmyn0141Ece2eO6wML3NzjxS2q7CO+ijcUlNdLVp5pHbFxRrYb0ibFqXtHYadPMRLWi2IGPpyUShlPH78Ftv52TDnw+Gq8ivWZ/EjZmtGaMv+J3siPw+HwFVkrzt1O/5sgJnxFkaNyCUXmCi8wJCnTLp2LaOpYqHzik+2YoOeJUrCZ9Gkg5FDW8LadE8KuOsMKg1RpFcCe0SZr4wnJTgOjZvZ/UCxDdFNwwQQN7UBt76hg1m9tLrRhOot0x4g8kmfr2KcRe16AMxFBSxt7/n1M8kk2tAN9vIcL5vCcIhgRmFCAUL2TKzgs+PmLx67fZ0kVNL8MEZs3sBRtuQcFWiU0JsfepyG8xlgFTPMfhZJKuxbcj/mGadzEBfZe9x0M+eQ51tMyG46SWZUGzkXbtQldUqnnlEHbhzOB+efPoRfAyAHs4HrtSYTTTibgK0q1rMxEQT/TfaPrLN5g5UwsErAo04HKCDFieuR1qZLVqcPIToiw42hpnBc3W0CkRekqXFsPOCOfelWhngFeGNW5OTMKi/aSHptQDXTP4bzKlsi/l5WbdOrQjg9a//wOtVFUFaET5Ko94tlFOFiaccqJcZ0sHl0u5qg/1Yq06Cws3JeKkb2k2m1Xo01bwupuQuWSTps9N9GEe6MUt0zDAbFjTaItlUzT3pmFKyrC8VZTCo4diq1VE4Foq9JEgw6U1GSB3zuQpWb+O8Bkge1mV6c1y42M01BDRXuyc6eCcN53peO7Cl8WGT66Lmofs6KnAvTHYwaC4cT/BNORJ958oSoa2dw0ZofcGqTb114iH5RH30e0QliImaXyn9vx/KtdYPXnuMCupveK0DVKL0dNCZou83lA6aiMBA7CYLfeLoEcS3iXJ5i9LNGm/1NC7lks3AFOnqqpg1Xp8yssjqAV2G9KZkIqtOhBsZxGEYncsE2p4RVvzHEUclqAp9AGqma0krZQ5pd7mA5AQlIDKGU/RP9DPIcgQsjUCywdiuy0P7JHY7xRfbsoCWWDLeNUD7dpP2csDbObvSoL/eorCOaliatZt7GO6U6uEGTbv1T37TMCmHaXF0X7yDvmUdnPk03lGmEWvoQpEwsVUSbF1zWPrbzh/THyjTe7r2+0P3xKH1X3XQxZ3TJ/Qkj3WKmqtxhz8g/bkJreRO9Qh/8JAiy20LYYmrSJrgpGOPxrHxG+Qk9BOX9gz7jdrW+aj3hqHHHXmyFQ241lOlyH6Lm4BF5LyI1DaAugt+oZEcYmIwT6yKBFiDy6O/DxXf+JU3JHJAu1T78TrfcAnZPPdVitVFdp4m6FrR4fMc25EgZS4DW21+fttAjQROQROAfpIQdBXS5T0Q5/q5lVSgO3fcQsNJLKZ7D9A8GMl44k4iaTszqKMV6okgFNPMM+xvVrSNKIEAhjf4DycSnyozUxdjq7LcginiRlTrIvFfmElYnm/KuXtEK2kRR9pfZzqk+Jp7KX4ppg0aYWzpyQB0PETlOQXd2otBN/DIiODI5Bfi95GwOBLA/CN4VeNh9jmooNOF5QaefSAZDFx/J6Oc1Ubyj+CGwWpuz1gEVMCa1Q5DHTzRbxC5BNy7GWW1kp5Y8fDtto2J0VbfQuPfkq+Jy9fMaUwYKOeZXV96ffpefEZNM+TEzDqJh7dkM1FD4dbKAl/Ppii+xruBPpzy4fun3dFhlFYmLJm4IFXqTvpktx8ZhaB6jMzw3DXcaaeK921qe4o6mb/9j15JCnWEuNGOOKC/EIMiYbyDTTEsLLt4rpETxvU8ojNmiRP+pQhckl5nKI2QonFJMY5K3nPH8vXBqTCUMe+4XHlZAIjnyZcBwwmXg1mRLNuVV0/RPYyd2mgUgi50W7nxuSUU+wFmqDe/tFBfW3lX95YDfbL40CZMf0Ic27huPXTB3dHTO6N3A8whra8DhUOEhOQJ5MGVo6jkAYsV3udZb6BB4qrcLjvrHZDFZAwgVND9Qx9UjIE8FreVKflmisJwuBXa3lk90TH28eCFuBA9fxxT94z1dvSNFsyStt6l/en9wynU4CYEviquIHu8bes4INS4P4r1xmV9Y6ZC9Mo5xovrkW2sDE2fFYAog8p7GghKDi9R69us84YX/vI/CB8O1j9vq74dFsEk5p0VNXZ2UkaiSqVayCmUJbRl13aCPtQLq3TiNVnZsNxF0sPdz0n/YMnuVZ0Z8ltvKBDOJ0G+NGyziL0zY9NeZZHCZOrwAO64tlLNhhJED3pj461C8MrfJCZE5//keZh87u27yEb0L9373YKjHoblOqWwoE3vPS9/OhtCxSty0QwvjwlnDcR+X/TJYKWRc4zD565cXn60rQlpgd+x7wS3YkC7wwB8dJAkikpRlg9kZyRCnTP1OzwQkyXnaby3z18il0nmZ7CcpDImDK73wv91CHYYFWDbqk0zTnOCsigtGKQaY7W+PV50RWAJQmOcROjs4YwuqcX0By9TEwt5PJRAX5Hxai1m1reYaEpV1MWMGjStr2Z/A8q7T51DygMnOSiILnSZlRgl8Tj1NSnS/by7vyVFZTg7ZIn+cJInRuyD1W5OQA9kksGoPkWc83Xsfbl4pz2fbS+u1VuhJ4yaxDNp4Qe8gGOM+EHmbvgQgBAcZdA5Lgm1pRUNqKDblU+MirvuORzE/rrMKkIJzsmIwWMuAe0O8lkCC/InqSNMEw7Px0bLGtT5eMhzBEVwOdRtDT0inHv0siEueM69OC25PNqbmsPivZNaqqGDjyLOrhSTKcHTZilrG1bj7HRfEeFtr4pPsf6cTQqHD7cgXkjEUAUeH+rzR3CxDCaogRjpMdg1AKVzPFWEMaSVTFvzK4YgaqHmwy4Mqrn9DPnz+vip/6YxKQx2Zymhbp5Ce82TeC2Q/sorIXjIgvnO/yU5n8dLRSfCT90cNS57QETJa34UbaJWe8AVEhic+bQ0+Tfc8+EoplWJC00eXTUJHH4Pu1nij5JIl8FTTtJC7GzpCPC4mNJVi6AeJvnMNZ5coE7cthjV+nhO9RWvjtuHdcnLsNVfevLtzcnC/5xWFUww6UnphuOi73IovtRbQoTX34HIXZ4P2hHMxQz++j35PnlfB88NteKI4nYIucNluzClVARyvvd+UHRTdR2GKWEMNrBvJ15KNxvCx/+dpvnue8S4nkE9/Bg0W4Gt5db8JI3vyWldHItSmaLJRxhxtFnHo21Lk7O0nTj2WJLPdyjsEyk5t05P02dLF7IlARc2SOPPA1kr9Iyv0QlrzhxVWZ1TshGAf4Gv5VHdjDvNAI5btkItpGWCTAjlS0G6liXN2EyoXnChWjKxWt8zblR7vKd6Zzq48S+SstijCP2Yy2iLGF32ADsDVjA3LtomHwUIQyI/j2zzsZv0v5i5yEES5htTfRVq8l12Ytd8j3s5DDRWNxiU71vQ4KAmyEZLg0DOOZMUky9Fzlry6Jg39Frea9j1oULygSK3sXUZK1p9RbGi4w3ATT5eZ1ARkBaKKW6gw448OYRnkZL+Kry2h2FucXHvhLtg5FiNhUME+vudYmn9iXT//P+l2WY7jJE1q70fXM+lkQSF5f7o5xQVoaXERGe1SMib+qoN6rxMHiCQdsllapgVbX/aXkWUNePxe62vmamTa0WH8QoTdX9Pj6I9+BYEyM+3Ka+Tr+Zipj/cVScflhtbF5HcRZ/0imZiwfWvi2dwCTqWaoaACpypDAJpsTFhgTxPopR+wdkC2a81UM2+QoeHH13xjcmPI26+1xk+ghPzsw7QNtkX5rwQg8nbL6FzgUBNEBzOY2mXTdEr44/10LQqEd5sQH/rzLartqqVAhJZyfIp11JdZ5cVU4Wy1zAL+XJDsD+DGhJ8KPWBL4eh9r4HYNOtUhtbHXQzemqXkLqglnojDNDJGnmYi9Vg3IfHz3zjnQ0bw48o7267S9jYaqj0jTxFBot9hnWpqwsj7DTOSBRviV9j0ak1KtMk+ZLtfnoWJmoS+ACzw2kQ01B8Qf/j/UfWaFbGVrgvDUSkqueklyPqWu7zfw4WAkMT1Rq9jDchzLQ4XYaCT5licI3htMHloB5+5PrA9fbbFYZLkYgv/I5YcgDATxt4BQBfaBiUBizbJ1ih264vTG4+okEIuGpBqCKzKZPW+rJg6tRhlESrzeB0yyuFFKhIKnaL0JCNw9nTQbg/l1CBmuUxW4+JtN18z1RlpcyoYgQm0h2l4k3rbYaBATke7tLpCf4I2xG2QdOgphgGZ2vkFDienneWEtS64pZNfPMEQFeI+L4phqRuf6SN+1r8zqjeeJctUqv3bxhx6tI2xRCIIIL0SjBJWPSyhig6LIuYRB+GUrZ3RP6RkniRV42tsPeKvGJa+MS0LH2XMSxnHAnpxzt5Lc5OWPq3sXB+vqaObndnhzhE2w/FdkTNDVOqjK7DJqU9vaQotYQHdapmLsQ8ob0ZZ67o/NJturoAl+RKYI3Vj4PHFKtxPZHnAqzZusrOn+54vqlel2q9yxvZjw9M1OzKFvhUgNKcmerz7t0E/cOA3qg03CINNsY4nI4hxzA4UeFRQlgQOVHLz2Y6Z44WWjbsEMpxl+hSDlT5gVBmAL7ZvC9GXFEjNioumpEfgMkP6iT4SRBwC0Lt7W4/AUrvV9mKVku7qZ8LzHz2wADf1G2k5l5a6yisWRS1/Dl8G6kCx4ODcg5zgZU2kk9QU93B9qCGW7/UuHIeKNi8jRcRqkCTp1aHF9+yIrukGgLqcF3UPhZKbmhAm04YXAt6foD/VfSghWGuhHhxYr+hMrZxBeSOvqHC0qLK7wYw/Zr27ObZ9mPdoZ1Um7mIuyXXkfLO6EG0KxkyjaR51Gyd++NsgxMZL1WNMwZf8NHjiilMwBZEExyTt5fCQ98pNOuE2hHtUNCcdWDMs0DQKLN/2zjlNrimP2vFhZYMJZxDKH21aoi6nmpao8YxmFMMeXrxpD63wTY2M5YfKHrCLFhHAgJCgm6HLXgx6n6znRteGQ88NxvaresvuofOXOSc+9fh7wugnmx4jDzWepNFRRSOrwKie6QKzxJlMm7sT3xzBpfJUY9Ue123n2EOUBc2QmtDFBM3PEiUBxWBdhFwDzA31DH5PW1hH5c/QeDTLbcm2ruOQsdyTQd38CYqNGmQSEvHECQv0KVCtUopd0byh5Y67GS/LrwJYlv0E/9Sg0lZFZUzL3Wifrphzqw+wZIBa2dIuDZfGBuClJZ8DQZ2+R4FvWAE12DorSFUR1Dt+FoOk8xpi4C/LGJ2IXRBO/H4v9TB15NxeHPzwHwQakaSlGGetqskGsCAC7UKBKKPj1cYyCpoWxetlIE2CtBKIcHoxb52dTwVwuVddgD77KNDctYlPJILdI7W/nS4+Jf0ykgmpDSFqv6ywwv2LTin9QAO/0jYNV7z6peae42mgtK9tt2wmcVDs1vJaa6qsWwo44gVpMf8EkGMwG4gc134BQJy8hT2XKORdpsjMhONSXfJfAEEl2F3BFSLU1UXFaaw2L8p7XJNSpUxGfjA5ugrpB0LsxzHGGFpdSpQF9I4Rxmf5tlPjoD3nrdMdUvQY/rqoyq27tAK7nZsxF6U7DDm8EDx8pdppq/3hOm5MJuqr5wGCwC4WEvBq5bIMWdKWXHngCv3uHiRtvH5rVo3tFnGFmiNdRMzbaRFQm0F67KUeXKwUjLfpaRCRJWotkUL/308o69GylsFMRsCtLOsGd9Ub5vJe48C+3WMOyGJB/IaGgg0zDuB/xMhIlkqakJH/Zr3jjWzyVebT9+LdqYODZcNQ3XmG4+yk1MmXgPOxYRg+HmKzFAmPGjxWXtBArSfeW5Iv2j5O471+/iFoZmo0CN6oQUYFNHqAvd1OgE9MXxfv8zKsmNarJGaqSOksL4vOiNAe3UyyChVQZC766dtoxK28jqN4uQEdgCitijOLzkjEJuwO1J7/tWvyx56ycMShdFN2UA63asbd2UzFZDJ3q6RAvohs9jR2ZhysOXZGlTp2OdhyTI1e4n5ylf6wup11a2NsZ4thIzWnQh6PfuqgVlXADCxjRo8fuhb2B2rFQiAaedeYGSRQ8+Bj0jQ9L5JqDPTNmFEYtXZyXMgyTKrzzM3EuaU3q0aTHlMuA6NjOGqc3xj0tzzbYMvoqANvkkj6ZsWbTqTEHX19Um1NcaiGUbt9ySh3RENJBkUcr5DxaQEMK/nbRdLjvdUgjlveBQflgqE/W4UE4MWi+CVuQh3qNpydv0AB7xWfW1VtYWvt0rqF7PVqgXDchmYPNIyqKelqqK6t1f0iOad9v1TGSy4o/thoD2r42gahaqCCAAgOlWjQTM+qSosIV5aCirlR5kbSsgexZ0VsSTpAGj0p36LHCZCvLJ9wKWGMCoaRbWu/ETzyyx7jRrV14U5cWDpXXHYi6xRi+Vcbl85yjLAEwZZF6Jvab52vji5GXmmmYSXEslo2oiEatNz15PQ+HRweqeU9nxSMjsqmfjKYZRaiKrL2MaLBo0DSgJ/OYfkigXcd/4Hkp30z2XVP3nU9WFrK0b7hL8rPTSDqApfGBbiJbhCpSdtTQupbilO6V57IhnMaAg+pQ7mS3RK5QGW1QgWL4v5zc6ihffUrzfGGi9Q8sKAv7FUMuxLXtElXlNbuaNcsY+Yk0V1kM4N7QSmZYrhjjZ6833akaAOHP1LySDUqaNvm4EU2jnJOTtrpf1TFy4w5+s6JAAJJEDYNYojWmXtniFqJdIJ/cA0WhygriVrUZgW8WhD1xkOUiczn8zkIIZzYM/AhGB/GhZ8tJVNlCGzSvcnkvyy3Ds02sF7dlvVyGAQJJrGS05S9snlc/SYS/dMOQ1BgHYWdr3nNOLOHyEXnwiMrJDL9pIe9jMCdVqowOSzxBALe5gFvdtaFHmNJGaXraBKBsDhSjqlsZ/WN054S33mcY8A7tlbk7NxPUxZ+dxhpfx2IkD/qYRE3kk2WmSZivIRmmFIlegyljaZwa1P/XNioW3qdA1/5h6GJ8+V/YTPFNWSnfem1I7jdSHxNxCQVRZEQuCl7hW7ksfE7xN8utEr/XiDfUEgnP3OYujDqWKsnuPILs3RogQ0ADVzVZbVr2ylhujTgd5jE48R4jRpojXtOaOi+GvhuusJzUEp8sb748Q+hhyFiSgJTHhnroZ2K1FK2BI7nGRlYu436oDCNs4eaKKc0WePPBLy60h9GvOZdLDCfe8DZHcupnxDKUoYHB1ntHWjZ7x+1yJ8AmAPSBHJZyUJvaD2xM3R9AMqgh7n2+5L7O7hIu7KKlIHNloH1kyuXItAK5gbaFCfITCCiqYToSGPxHNjz8Qmel5kjJoad6nR+DBxz3G5yK48+SrtScTFUxR/PndMT7ACrQHEDIe5qw7GaUvjKaYymh23LUj1WOvQXgElRK3Q5pqbH4V8sTGt4meAQYQnhPfdjEjIdC0Jv2AffcK0ci8Ci8UApOw98q7nDS5+2RNdR+iRCZjPvKgGLLA4FzaGC9A6cCGfpQyR7B3RLdWFD4NaGoxkNG1oYQTBhbS7muMVxEK1t6HkKEOi4Xjh9Zj8c2u2g9oMDBDJg/LqTVZICaycBYCnGZqqdgMgLbRyYiKXvCIH29nnAj5Sf6QCK0lP+mmixVkEVDLzQ7OPeTtuWmf2/DmAt+jz8v8xaZrDyIvqNnvBnDd14xnpS7HuRyH3UJ2lae8oYXR4Y4eLwxfwJtImkLgjBtl6ToLhl1Leo4u2hw1gtd6oFkmnvvA7BC61FwavbdLodcdJCVW/3zXnBP9DaudaFdSn67CIg6M3i3rQHuiyLzIORZfzkY75wYJBBjPD0phMzk99SkcRec2HEjiDUH4vh71F8V0eGpq/vDy/QpWf7ipeHcD542Y1o0OicLlshv9LsnkNb4x/WMAtPJne8a9fwigNV0e+d6FUi1oYPkhjoe/VvM0Taq882SW3hoW3Ah18cVX7jGb/Ylh5YjFLPyOMJ2ZNHUqUmDeBX06U1rJ5XpKshPbp5YowUrVRMMevLHD/xB+yKXfDU4jty+x7f2XLIEgF9Zri/ojxLSaSrIyc5jSdszlHgJbwY0Ti4d7zCs8CF7IANf58J7dPWy/LvI9JIhj09Wn4vAfHtbqcHksUD6cyya3SOc8yf6T80GItxPy4cScbj8OJdY2rPYr8wIHAJYMDt8bsgZH2M+Psu3rSF4GYQTlgSY8INFYE3eSZr9O1Avw+p3du2CyI1XTxuoYmDY8JvxDMtkuyQ3YnYkjnx4ou3+2qX3rKgxxN4v2kuiKHnlc1x/3c7SQZXhgP3B6iZOwhvqiJy8PDoXpKsEesfeAMeB01Yhwyxx+Cg9IIjk5dPC9UeAJD5bimyGgpwH4RUqjjOJcWnS036+uMf+dB7G52Mb/51UMdcGkH8Jr+1LQK0/59FF3vt6s8lmP9UX4Vg2ITIpzwvJwGrEWXOOqeVs7xsfsks4ks8wvYMDNF3LoMpjPwiRERQe6KragE7fqm/NW5h4vz1Bt7tTZ61PcEUu3LwUUsSuUOyZf+1H0Td9ls4R0Q+dbCYjNtl49b7f8mXidvQxmhGbNlk8wjg3BTSTG/wVVtf5QlKhFbA4NrYcIKUg3LSWRRoiZA7yuBWBh76LNvML/utJgGjBYxLkxIvrLjG+aa3RmVPUBF1XLzWzrJfWH6BQZygzpF8mxz1UNS/Cq/ej0HYeox896etbswZV94O/nRcLwu5W0yVeD4f/MDYbzMil0/HT/URuScJOseiG4JTCopqVO3ZL7XoaCNQMi8a8jQKFTUfzZKdD3T1xpyoK4ijpg2k4fn2ajErMR/8j350xbHSxRScjsvBsbSHV5/KiOkbrxWq9Z6a5xp2Dwk4eHKnjx9l3+CCLlwbCLAd8uunIdEVM5uT8cjyRiMbsDftVp7SYpYVlWrKmCY8Nd9cbDOgd0WnVvIM/uMjjDbqKD07yIVxvuceAkBVHQU1NVI7Zw8Old41zoadqQcLroUmsfjfcpc+OdXg1xr0UhpOiP55uSAlwuttHLFbalSKraZC9PIWKb3Q6WrHV4anGHSQM+gav2mX/IQD7/8kZCChvp7/bQ0Az72Wd8/ZP90mUW/M/Z2EfRVxGMDNAFevFb+aU3QdQ9TA29ovbQc49RDyNn8Fqax6iWsPsY1A/B76fTUZvtkomNLyFJtlvIppBCT8RXR2UfGPWU2feooA65ujLcCvTx8zowOQuKAqPmv7HWTIYvJr0MfXX8LHkV+kiidvm9+hMUSk1GHaxn0YTHOObuicC8ieK96eEYph/buH5oKFgxb751jnsYA+P/kFdfoPy5LbPw52Ve3YuOerdL83YDD2+XgiQw3bGdfkvhN6yzA3yzXkzFf6vG24CKJkv58mSBznrlTNULHONL7tAPpEsqtLmwm8bU4zWffsp7Rpk4G6pERVYPG9n1pjrO5tAhdK0zmu0wd9Hzv3syZRLeD93yXnZNTetciz92ZZ7SRjwhCVYxzq/kxqmNYVNwGN1bISppmVxqRYyuIQCbYgnEPXjzMj2F0IeNRYNrp5yhj21ObXoEt2VALJB9vOib8RImISa4riOFPG7N9ZDVizQGUbfZ6LOkQQK/tz16l1r0XVCFMY/xTFUj6bv9jTtifzBWWjTCTCKJ3vpowwKyYamQNs5w9xBocrhsGccpgzJ7ZE9ApZbHRFH1nagfQC/g2+CBKQ+dZsUEoatYIm/yNlyFY4aKfUJCZG/8LjdE8ZYAiVkEoOJL2ABxPTa0rYXtM48bRKXdgFufNeqxVWhc9wR3I84l55Ab6TjAhRKPRDpxiSgXrqV2sEztzcJjP/mzDpy139LEJ3JpOfishNhyWGgYeOCvRp9ZsteH3vWHWEgvz8TMHVNmNqHvF6bpp/KEfGUq72AIQhKCH2WztFw0BVtlYLtYg82rb231zR2qEUGl2iAUvLaQmd39sTkprPAJEPeuc1QaprTe5bt8ShutzGDgDbamNPQuDaZb2mY8EvdSv94Y58iij86RPtatBIruE+rZSMNQuVm/8HbY7zdGzFkpaE3kEkIz0lFR2w8TCnkri6pntSdoShJYtc0TREn91zEHoXdeXyb1cTLbYVqPiBY0llfCkEgyBiQHgMeCuNRhv/nd3Gahrq1EuHJ1RYhMevE/dwh6vl5gCV4XuvIroPvYWa1DbdWl5F6H9HFoSIPbAcA2c0+T0GkzngP8WXS6PXwNCIv88OYwbCDOSNl1ALUlHQ2OUvOewP8LRS52McrAAeaud5cgFbbO6L+5IbKvnJqit7npbf5xTGaSLV7zSrlEBwyNYjGxJYB7grtSIWDx5xwp8JG5MeiscZ9G34lGwhXLLFywI4CsNYcmF9lHJ9UFUSVdzhnNr7MUKTt+ZQnVaA1OjH+N4yA9YXOIS6v5pVy48WFPWQUzyV/GALhrDf+/ORWz3iECK6T7J7XhHLvfoGh/A5fR+XzsNBz2cDuluvqu2M0HHt7xI1Qh4vcry4NqFGO0ycz2Vafxb6lxAoKXfOQsh9sxTvjAkLyt7oobMYptZ+FksFMWWM8QPTYBEZW9CoYJh8gXB9P0ymH/IywGCR7Edjg79kIXb5yJz94/GVGtCyB1MZnp22+gcT39uqs0PmW5xb6ENmU7ZClS74TokobxsMMhBbrlMgBTFVndtcoxjgit+67Ym9XSGMb6QQ2XZyL+NIUseEIMgoWTPlFuB2RTeeBxzhFDM58rjg2qpHeN4B2mFwtGgv9R34gd2sWezLM9J0W4KaHsA4dMujaV52URTb5pa+qS4iHmIiwqxd/bfeVu/cpsVckvh3C2eCpVKJEOHtRp0arQ3eJ+qu4Pj9kAW4AP4IOTHQqQ2pykUnN8rl179l3qCG58LvsUyHL9sADmIlLOBte2YJs/oJKczpfBVcDzEHLk/gubGnu9Q4JJjkSo9aGdNUQeF8fy5UuOA1Xh2BGN+5CRhjwMwi6s/ltWqx+ieXbYoKcdfyNn3ux852oQEX5orqRydYhPhJQ3rtiV56YG81L+Q3ZvOhIBrPrbxh/F+g1cZqDmzsIh8QdrdJG6cPyK8imi48lMEsZgJUmtMNhDQK8FK1kDqdkGpN651bw0frhMg18QJBPLQW7KaA4okSbT/32HuNcvAmj02cDR9SeE070lbfZckaFOSeG6VlzWTS984UU5PXmjld8zgDplqZM1hUvL77pdQvNEYxEvhTWjCYITHaPKfgShsiaAwNAliDwDEaWQ+b9GknuiPvT7jd1+2YONotvgpmgJD6Yj7wM24QGu+iwzVYk2V41xlTQJAMh7FMU8PY23tHFAskxklylwVXC92D9V090V/a8vWtD8wFgt18DmW+orzfFVoNVejLjdo7WHqlQ6PQR6aWU0lLrbmoFC9L2LLU2eEbYZB8gXUMclG7MaxWAXJJngH4K6TkXfIoIQmWNruKjntajftbSrF069rOLO7J29od8GOPrZ7f44frCKmQSw9Ug2n8LOLhR6Ja11UIBSQOVDDK9FCl3BVORRi82Nf8t/25QjHY99B+aBklvq2AacQ5ACnbMTJHbiCaceUvIp2l8iahhg3ivQUS83Of0itIC1oCivTLnm193QYyE5Z4JVhggGNbthCNJ10aV8Ya8sXk7HdhAW1BD1GYrShdah7bd/g05nxbj5QETDwd9SNKsshgCp8prt79iTWgs6kaQyxXlsrZWJqkaVqrxG3XP/yXxmITN+L/h+HfQQv/tv7WwUHwnvdc/bqMLHuRRxE22ywpav6pB35BaRDCKfpKc3ShlGwOazPiPaJL+Kcz9jOXGaGnx7fKSbsxBTIsx209/TELErqg1sII5VSNVuuggdrFIa4/eMUN1ca6ODulVSBW51qKeYMWrMTkpo3z3E/R6zXYdPBtkbAKFch1EMGtVUPHjGbugKcsb9YHcDQLI+9Td/6RlsbWW8SJasCa0md65Q3OFArgss6eS4qZOItnAUhuyfYY6X3HTzLxb5ya6dRnMCOwxJIEIZsQ6hFL+eIoRfr8cigd3wdMCyxSCo4pAvbb/s9R8f6+Dkg8W6mvkNb0COngRPNWRSwI2UwCdoNdmvMiL778qpI4egfz2XwXZm6YxvCMXrhG/THBLlv00gqSbbf0lb3Y0klc6kx5kq4xFIefvCmt1miPDX4m0dHSkD37UNyVwZzzq115ICpP1mn/PIcMfsAbFcPGxiun8S/OrB9j3hVBqovgvTWoOWzkA/WPl3XJJ1I04kb+cuOzMn0fs7wxdJUgKvJY7Ni+20OmVt/Zj/e06ATtfQupLV8NkTKtlSHIQjwcLTh9JLkaXH9ZHnAwKKyQaMy0gnuIDohgkVpEiQ/IN4Kp5VOweZIcpGolqDF3YlswSWSnBFzWnDPxV8R/0I3jDG7qczm1rAVmEpSu0CctbRDuDbvfdNcr8st6zzIfAFpljmvuwlmEI1060SArjk+xU4FAatI6X8gB34SXHAAacdvcFeRO+S3bdARFsgOa4wlala90mEsqGE4DdBXYsS+MED5UZaq6yfjOxbO/sRiGuUMN+NuHdVGeoX/Tu69pf9yHcatz/vqGqxyj7m0vWLrNAplhEkEFEQky+UsrUTp8NQ+WAAoh88mt7hKFhs20M2GhUIqh7M3DgAywNd93PeeMZJq3MbMyoG4kr8dlyotyibig1Y+RyeAAKD1hUYUkzvqjJ28n2A9gkxJdKJrFp6W9blQrULkLqoQTmrNET0u4Sj9s0XBvRny3RTOXWCHLECjSpKAqN0Tpo+Y2FTamRZThmcZf4eUj6Zx3oFjMNeyJAFYU6PhVW7Y8odSte/n0VryKTzFNGjrFogdbwaCYGdLMSMkCwU2E3yk+cnmp8QCt+7Fx37WT928SFERtA5/RdgvZ/5uCiL6Nj+sFC//K1EeMBSTlxSJT3/+zqhLbOJZu1RHtU0GqK2x6l6svl+SO6FNdCmgIAvuJbLizwC1t8fYSe6brCTsyt2SBxxgd6UV4bT0LRHaaIX7s4z99+9D/0X4Xbzy9qVli9ysyQjktjfc8lJShHW01CctlnWRR1Me0ozV5PbeZEahpcxJyzsL9+HL+EZO17srCRnOWuuT42Z5EQxgZBb7WbF4RUqifTz6VQyQx26znGJV35Pf+W0DHxFlKQPUHKNv+PICiWEHnE1LzCKy/BOSujZRMtNsfbx97nHpqxHggTdOU4EE2iWgMUe/6ZDdOSGdF5yie6+xwSSxhbsco2hc7/gdLxBMHuxQT9ojYFpCcqx8W38vtBUOl9/Jm35WVdhVDQSi9dcVjXBHxA/X01X0aCiZ8Q9GilUU4AVkBHEGybuegJkayP7mvlHFNXmZDaLilJfNcrWM6hVvJDk7Iv1KjN6AkWg4EEFOqyirYjqdnJabcZFvYcSYqpuCHcsigT8ENQgWlN6MM2n0w1llIW9DM5qxyl9FTqq0jkgtCWNVXVnbWkA9uPDEWjgKuBOY1E+ueRubjrTTo7RGZpS6kIJUv+1aoq4YOwSDiQgU+X+0Iwkvm/zX8k7MzfSxSiJqm6ZSxU8DEn+fUr0b/pVOOS677E8P0V3NWwEfNwB+cteCbV6EMjEwEuSn5LNxrOfU3OZmFs4cU4haQt+f19RYo6HXTpPG+p73tknm8jQNzoQEQmnaq+FVdjB0HLTPmyyqRnczYK/cQkYlQIKhFPk3qfSxudbnxh364eG8E1j2NoWyQp939Bwa/NzQkUx2wQ2bWhHMXXjXC8N0C4y3u8htdWukItG85SagxfvSGoSAd3JTwEW+RwTtDqJeHBvDYfvTeFGl4KDuq7OxdSl/X6KRWeJAxracOfH44+//rqRdDBTuqnYOiTS83FO0TY3UldAZQmIunZj8PdTrTv7Uohvgaz9I2xsY7OoVVSCdKKlNzs0KAyvXdvm17nueu2FmaRjsppG7uybH82p+oeUfk39+GQhDvkbUzb7i2rJonP1Y54JjyhcZhLHjEUg9zfJ4gn17y8y8qtmb3W15d6+dZFbwlIBTpwynmNaTrSV47dVWkFmDmcMtHlKkEfSFmW3oj9WuUOtKtqx0uP2aywKs20BoG0WfZxX3hkPhs5fyi+Vwx+sAFLfpsAklVPADES97hofxJ1kC5415HPJyMGgUKQQR6MPtB2c9r2+ix716uYYALhURuEY39XZz74tlJK2X10AqGLkrsV1PX6Y17wY0/rotilU+DKIaQcZ310O2nUlCRmZbwQLF2LBClkmXblORpNbLr3WdTxq5xw3uFRvKqIMFuPhymRssMrcZxVoCn9aVMMUjFcOGVhjOzK5Qv3fHxdGDpGkfyquq9hRaUpdbwf7fnZG7FVzfoCrsrCh/Va0ZM8N2TiwyeXVPCJu9vyNe9R2cSMRnH4c/c9tLXw/M+Ho/sHtTfLAVZfG2azWhJDOdqxV5BQ/X73bzyp1ZgryrE8S2/t68tTNihl80X2ljUk0bAi0+hDbkybtCoBwi6f8OTM3O+4ZtAmr8Wk0xFXkx5Nzc6DnEoDuv1u5LgwAhPd44z1uRersToR+AfcNd0gFF0lJpl2ptovCp8+6Z3PAgOQfvMR1isI2u7hNU2cNoq+VH03qGVJZ52LEKQSpdryviBI4n2YodgKCks5IP9XR354pqHmuq5IlL19QPOWeBcsbEn7ZhVOW+aGiphr2OaL5ohvpiyBmv//rDyAR5HiMH/bikIXptHV7jr680bdgx+I/HitCpggVdG2SpQdepe+pQauTwZwjakAEtNQV/RE+D2SbIZAT5VQ3lVqhv6ToQJRgw1r3Mq3HqIPW6CWlHUP4FVa4hnwdOZi45yMk4gd9/D7qDWtI30p+tUWsNqK2kXPS40BgnG8Qp+2+iJI0dntLWGp1e9gA1U+RKILjz90/XICg6qlI+aHuGoCe1R05Zs4DO1ycW1iW9SKrA6Yrn1KbVDShmZrg3tSb54fDw36xCSS3MtatKIGEacN68UmrWA1mfNnoMKYZ/SrAWwwkjBxvtxn3OVC+4OWaQ2ZiYODIgdr4hSG8bw9X5mGGxomr4pBBG8LOJeXEDbARkjmG8TTqKeD3AdCNJeEcV2rtf6U+cH7g6VtOO+Bs48HarmqO9cU+L9xnawQSutnYo9Ue4biywm4bA1XC4YfS6NYUzuyF6Z6LrUhjTkMX/nXRxNb7HJCPdKpNoW0e9p8B88Fu2auGoLMgQu6vX1RovXQlpfZxGAS+hk+OvPoSMAEBp/EzisJylswvPudaKQjMHvCjaZrlrH5WeiU2fw4qt/2IOvD3mSAFjkkPNIlYK4FHF8Q5y6531Ix0fvSY+WhgFj5ZhPHfvxo9j7tsNm/labpFGoMaR60mL8kGwEw3EkZyDX8HcJCpCYZi/zElP2h6Cr9RTXMZl8Nm+pyUN2JVL2XENTDr2IIaRdk6LPs1nS3gJ0ACgir8GAeUqlc9kzwsJxxlkkyRGRvayzPTJgN2+ZLvOAiIklowjQnoV51ewJCdFUbQpw3WfdIHUI2x4NQXwP90bwPnuvCzaiepaJ8w5smbYM98BEi86tacDuxQU9dWW5pa1tdfQjmHA8CUxQ01mnq30YJFJ4LmagXl0xbjx8l/BU23mdAqKs94ViUJBs2VbXwQqYmXcI179wLbmJs6tpCcP8cDPTFYgFhb4IgpmpAoUEpHTjappMExrxOclIGzcj8WHImEpkf0qymPzgd9NcyozQRX0lOLGIf/PBKjFyKdOKwJ8C2WPqSWalNqVcpoLYQXkDIRM/No0vOu8XtA8YYsRjQFyxmzgjwy9ibF7vWObTPvAg7FgEFik74s8Nj+1MGrCFPP8+wf9CvSjlCCOThV/DFKmD3NjnMTQdQ80nuFsGFBLfXTEh7CCAcLcastJ1Ux8AZxKeQUIr3s+gwd0Ohjp97gJ78RwplILX6kNfZ3SJE9iwLjVkDl+y7mhEy/KEEydD7k815hF+EvlTGCIWr8vEEigQi9B3gq0YM+ykLDdrGU+p0iNnCQh0o30tzY/kD9J0DS/jKBvau3uHM7XcW0bRDjQi3FfA7zTNqxfsXQ53f7GIsiyb12PDBPv3nP+1nXyPAREsHBgeBaJqWN8WMnylab4s2UrAU6U0GOMnWWOr8pl7zbvkxY0duTX82iFcZIX28fLDCPJzjjDQNeQCF0AvWavmZ0QJHebHTccOr0i/SuYvtA5tY3UDCODGNwkZ4Rv6+H/Tg0uttWMPQmMExIX3KcoCNSUpFWGiv8fJp7kqyWek8AJYSUQk0JC2lIwoE13Jo3eHWeQMN2i+I114Lw7AZpZXOSGuhAQCLYWwVkK24YF+mKlLRM3sNu3AbyOPMTBRzLZ8e5J/cj+lbTLDf7/s4XTFR9mN3Yk45FAJySNh+53Hf98ihJGiQxJ6d4qEjDPeg6qV3aMCH4ZL8gn5If8/QlHDd7JPwHkrzAMNX+XV58F6OcvV4XE93nm0pZxKMkSrHzmMjgj1ao1/o7wszH74p3Q2f91JSge7+O+TlAuboXCGS/HYY8azixI4GvUXv44HaQxU3yCWy8/IRz6UKZ54D4m0PdZlB9rwwURosVMUnvXh0HNWLfNYRaTCRO70VXRSM1bwtdNf+MaQ+kldFKsnJ0hj2BPyZrYNnU1kNYBwtlZJjxrkwrD3JATP6GfWNIflptNRc55QeGMyYu8uU1XtelSxhZWwrSA8WCLkHveOYa6/HKjCkFKSDDbIE08tUIvxgpwxio3+HPk5jDJrN1iv4gwzVA/7pMpk8yQ5d89p1TW1tDdKm6COccUG+DNxXydttOZlTBaBdhInl8FJaUSMxVdY6u2pZe0Alc7S6nCCCDx0gCl3WGfsHpfb8AId2O0FlxgK70yOPDrPj3oloBUatiANx/+3TLIwrP7/P/vJPY9f4zCX2VYjO7lIchvwUEc9pW45ZGx8WjXPyNcTxQB/+d36AgCKTJ1XNS2zk3TV66cgHTLmDWH8nOkNvDIurWEUsWbyISGYfV5mPpAyadlWA1npXvMDM7pr+z0JbXX/PEHTCYX+swDsxpY3A9jEJNukfZsVN7fz4GPNKy3AMjNydauQuRq7aoMm4qYUtl28DchSexgE8nSLAocv+U+yhwJyiv8rkBxsa41vuYqrn/hUZ4pIcm3lAngwn6DcR+0yb8El4CckzXucWwjzGcZKffydw+k6S3dIXzjd+JCV7W2G2F/gVQYjvjlrAsV505ipJjbMD/uXWPOV/zfspY1t8IIcC4De8qD3S3s4RupME6qxZaJ+gXYFCN24l+glwCfP2qKbjJgu5f0AEtdN+Mbj7ELK7boxwbuF4j85q9GwMU55xmmSVTd9vexN6NNNY4p3nI7PxLWT0kI7ZVcNPnhsKPf4z7v9BTi0XTevaF0szLgHXetItZ1m69sl87fUotdCDN1jxAFO9Nd6kSMNQ1NMPkr4sUIqdX/bUdlKTRQPI7IC4hm3y7BkedvV+wIOeOtJDR9w6wTCzBtzlbeceyOc3cptLzhaOti1QFuYbS7TJOK5BDR6gWuDbSaGtC7apif4csVn+6SwBDKKNh1Pb3OwEMvIHWUkxJnaBBv5dsTp7+0bguTUrXT4NTELp2g4tXBqOd3BzuKpcoxUyFMvWJkn+T9NFN0W8qguJuDV5w8U06JTW5346gE/hMHYFUbRJ5GVXm904BoP6fhU0a1mf5AAd3yLd1o4SMnMzL6jSxdFx6/SlGWUStol9xX9B2VeEOGXR2sQUXdlZG6WuyFaqXRhelzN3AQr/e/bLToMmJpfE8/sVUwuIC25qNEHwWQNvLKRsAbhKf+gMqA20inOxSzEZcYpQC132r4EKRlRWF1GZ/e0z1/rkiaGm30h6DHNpUMgA56sv3jX5QM15OYmFR3Hg/lidj/PVGicIlBHfAe2K1oQ28Al4KZvEjsPxZLO4xqCzP5sPRhIxkboBxdMerT6R5rZjVRHtntbKI3ts8twdrO4cIvN2xJXkAgqyvfi9vjKA6ZZbQNuF+ALmMD8tsGxEF1HLo5CN2Yni7G1fqqlojxqtW6DX18PjjfgeurtbqQKUvtxZikrE6zDsMCG4QuFImNqIDnUTL62OKAYHU3xSgAmrEkO7FGE8/M13lhtqk6AzAVPzRyMg2HsPKDlzSGY+K1qUee9lzJzbHPfCORDhn3Ay3Zbwi2JS7k9k+8Ixbg9OeIDRUCt1qiJ+G+CqzUtTZ/1ko8ZXzMrs4Vbm2ZLuWTLuOBB1s7IgkiwRLI6ZEtTzw/U01jTYirxmQjXTlt1PklVZB8hzSCBt+QSBABFkXJkQZDDWtlGR7Q1P+PlqXRoFEJRrfFvbrQIBhk89ZrQ6V1DGgTsOlvhMOAV2Mo0Bw3LK7B+SgqEwyOT2ctnx9LgZEjFmY2znA+sKUB0ub3LMwu4R4Br3qW8bM/ZUTargHX4bviKoEk9MrzsUd3uLlnSNAHu2Vi6EXFIwnfMmCSTfycIpPLH3SHqhni17o7YHodC2jFVecE5HCom38TOswLjvABA45Iu+5p/e5346Z0Slt7qSgQGlFLKs9nSAV/EvQhjdwx1Rt6a3fC/qZihC9c6Wd3xG/G5BmXwiMaEU1+H2V4rXRCRNLBqH5Bi/yb6DAlQq0wm11nLj8v5Ba7tvw2MO89M1qN/IfngGc/du+DooODZg4wj94DYTsebjspQJ2DMFuoB4wnzPWCwsHvc9FgiMD3PM9O1o4YyBGsenvbyXjbumSRYr9ItUVPHkfxOCR2ubiB9eOChgnFTMppcv07jDq3+THqqn7iRaGs3bAcmDZH/ZZX60/b2hytv3Dmabq5Ye7Bc4N4nKnsgJCX85Ux6/OKFr/6X4DkLqKNkeL4gdk+koZAzL0xEqlrxeWhwjCl2qMKmxUoHlK/PIQQi3BzRzBtFGt/V7/2AEacxjL7RReXcmINiMIutdCGj/lMUoZLCbE4eYL04QfMs9KO+cNh0ln/vk5B4Iw1ewXGhAaXfO4sdJQt3UOFe1JRAbvr4tVUKKPVw1g+Z9LPxVLvuiNcvkmbr0XMC1mLseXeL9dNXyR/jDO4R+se6eLR6ug66xfBQv+Vb4B1Kq+zYWN3ho19c417ubnz02b8kb5RreYVwevvKJp6QbpdO3YHDUinj4R5TmpMNr14/o9VQzu5ecHRODkz4ZZtyHw6/67knXbpBDB9Ih7qahaRkjgiUGqYQ5rHQltk9Rh/ODRmlts6JyU0V2MN3PJlQ/lMGo0xnK5T26/Lje/+DPeQhotaQJ1yCYzbeXMo78PdUKif32gcWa9wEdDk+HHVPRyVjgRCXxlC2aLC6VU2SaGrCOeKU98OFlKGtycmFjkvVBfux37rucmCFJSnOcUuDrIgmH3LbeNJ7ijncZZgXA/DMcBowQfHGeDg00B0U2t70qIpTcPzwYfX+BmZHnNVIC1efTihbP2rxbowMi/EOLUqloy1cVSqcpM6n9913Xh9SnZ+Xpapngdf1Pw2k7n3+me79PDczsjqsQ+I/sJBrG6U9QQwAyAH9jaot+eKk0IjbrGEIjZA870m+D4copMagWr7NFOX1jgH7jJTLPGWrFZ0u1CRHsiZ2zpdf+ZXiUmxONn8TyAiIZCS94gZOT+OkEg8qp9CAAYt9jzKffKZBLgPoQ12KgrXq8L/fg0RzSVcUYnELffNuKUQEyp3JveDiF8sXi0TWkcwypbTSn2NfKICw83XhzsKKUkrpflb2wbYePT7aErT+lsAimsBOWejMmvu9PwRX+DS8s6KrNgwyikb8OoseGwFuXvroYvEmMdrtgzujv+Nmoqs9NDeazUNHQyp/+Gos5G2nT3RWqNyg6hML8YEYYlhXjEofWL6VyUkResNgoJ3LBtZ90YTnIsEJWYkoN0cE90rQLlzJgw95narPMNeZ0NJnm+gmBtHlqmgm4LBfQYcE7OJie0vSMX3cwNqiSQRNJAwi60rOSkIXHFb1Pf6mu86do37/vR0c842ZvaE8FA0T1Ro21pxIydcdKaTkBnYjgCUH9cGMD0oEgV/7R7zNUM3pbKBrrjwsAUfZj9TEI7fgXB0b+ulkEQ/xE+0o2mXq+gvF9jElRY5K8zJYDn8/pLszInMx53ktgcA+D5TAB8RYqiXoMLmg+WsnPGp7SFWtjsvqcHiSUOWs9bu+q3Bas2kPoSg6BJC0M8LF2QlHSnRfFZpX9UnkxR6AEYlEcb8E1R57jJaOEtnmBZxYQrURJFm/t+ZGq6Qb/hhDwPGYIKoJfVWaTxvdKQTZG5PtRtdin9t0cqhMCS1vPjH8bfJs7Kq8zk9YsYZ4qWXcoqshJXoEsxI0ISL29tC3Cfjs6cci8A6RYn4XQJUdsaGkxzig2EI8VocR4mGdnxJvX6lKPjw3V42V0O2H64WZLGUliZZYs0VYfvRszugV3fZqTpmrtJ7HDMMj9RQRwydGGv0qmNAMY1oBRDfJmfs7XlYuTGNcJZFR0sbqvoBSScCO9ETzH/Pa1w1jhPZbIMX59Zcu/8IypHiHiaeUJI6fuw2WK/SOpufkFkN33X22T5q52EFNyoTCM4VWx4uMO/oC7EZyELQxxx1+7pyTBK6F/jllN37fEO3sum4CqdrvmaJNCaGl6ZPAmk8sa1hpjYeaGiTQLkHnEQcsNIZyS0xzNRVu3BEzGgMnhYnov/CXiS/9HIMaHUhizazSpKuPjG6Pr1LywH57jgaytMpRVoQC/PoDHZeaXeE+QKsvH5Us2sCTaw7mGtsFrgj8Dp5aOJVyr+J5Or0JMI5TEBhYgSJ6nF6Lg0M5DGWgLZ2kbFpVhgH7Z7bjdT7TvtGEHPi2mz8MHWgxbbnsg1srldlwRyrxUaxEDB+5PjKAaWScTxNB8Rpe9guRVxLQ+z9hI8lNftlLzo+qRphFeDv3OU09Ik4ZAYkT3UviNNeXMVCq9+nD0g1XL9JGbBzouKZjedDR7lH3TNdF/zBEJzXVikjwnhFmLMRvi7j0vJRh0N7OhAdXIXF8xdYmbA/bWwrDpDdSMLUBKyJL52vGQptIHM9a8EWrH8qGvK1Q3LD15h6+R28X+294qcn0hZYBU8/bFMbVdZ4NS7RC4uExgtUdLMX6l5x1GbZNYKLpDyjPk+2i2TeDx3b9StN6mXzTeJuLemmYYSKZ3BOxNthkZXh85q85B3GYWPC8EbQLiblova45imONQ3qdQwF+jfn3id9Au21L+wrbZA9jro78zPJEk13thoR8s5aN69C00mBA5QmbT4y7YV6gjVwJnpwkGaMzIQfi4HUX4FymXAWmX7dxfW6l+Hb6R3bmhpfvBQg9oHyWE+sRJaQIs8+SmuHlW6OQEmFGMAun3gDABa6ENWClpgDplL+DqDHfsXaZ0sjJ1/Bzci2MdTFef0MoV25oo8OXgL2/FhsT57AioDJE5/rxkwf3A4AGuR4oQUWZ9QMknwCXiLJtZ0AgVZaRGuenLVAcfj4woS9YCt+mVtyKY/MIRMeApHoSGt4GprcQLwv2l5GXmynle3E2miUo+fbmb2jj9zNczw10E7YZzN213/uCGxVpFTATJk97LKOdZP45jMkKI6g1wjlBDR4RDH9CVBm7/7Ok49dR3HC+pe4B8PwIk/47HadrnQ5mS6F4/r+ES4zsjGzpkbXlt7cbgFnHkKIqSjRk5RXbPoEXrxWI5H+JCCBEHyMbdWfmZJvZ+9fuBAVBjx7F/0jpkGbbRPeprcrKOUMtYR7MrxwcUQW4gMfidLk3IaQpzI151csnzRNZfzGUHmFGzF7kqptF1XELH4hpRejI+/ShUMQPXLyqv3XK1OfBY+zBR/iQZV4SJRCrU6IOJOGRRC9HZWwXmg6WobxojgERZV1rxfw9Ia2eB2VYdfIaNmbbvBK8maP1hgi+G7vRRLBCp5AKxo2lgfkBHgRtcV+F73ePCBo18aJvczh2kGbAwzfMq+U1ctRxrfs4FqRFBzmwQkl4Gcf3BNRn872qehjWkYZ2mAhcO/2WRvxJlmaZKwdrM0VhO27Bd3WKjdo6uCQmrlZHxtsOK/pRWI0+mOtP/TkMbmTJS7ujDrKWN/7Y3HNBTdE5kbFS3CWb/1pj4DCukHAjTV+aDDiH7ew6sUCfeYx2jBmJpH/Ryj9iWP0eQlGDFwtOoQijrSF1uCFSTL31+KS3PY+QEccqTcOarzAjX1r4I7LGjnVbnlBuy+BvUsvPpe6C9svqu5/R9aFRycHix5AL2I3quJc+HeIjpbnqqbPpF9qfCvbbtwWKPbX1K2VGQxad/+VxXfrUkM5ecFsXxVZhDL0qIFnoGUm+cFdAuSGfZUQDCoULET34B61AIlLwsM2OkrtVMYVSX70GuhiqrCCprUW8wgNKxTM38Zwf4+glkYJMENgpF1IBLLOxo+Sx89k1D0OLrOpBjeuqqFnI7ftBF30k8p4l8cUnYBPtZSfayNuLjn4Tx0po+nDUrY357F7GUBSbccoKRVYUzBjzyQhi/Uen3ujqM+qFDFuDSbNaE1Md+7K1h0WU+mnvcYLYCm4fFLftWCrzllEDSJInBqAZhL0I6NiAF4Js+OwKji59jHOeuy1dImZKh7BLCDn8EnLea+zhkOIwe+TR0UkWI3FpGE+cKXNslSPy1EC2fpPNj0dvei99l+Yu6TUvsdNxi3vPjPSjBb9fCaG1tll5rHno9kjNl+9CNpRc+k/nrhfOzEIj6e5JYJmOzTWrn2jMHLjmz5acCQKwx3SQGADS+qWE4iF9lX4iAAXLnITHFcENZpOSTaftXbHJNOj9mYdh2KsDHauWcJBmOqvMwNDdQ2bq/+GCqPs9peAMShtDmkGrj2G/iTJjaL2r/1Pvoorl6VRWGw8Eb8PzXEx29cfDdBmvOM5zzvCQ/5DTkIWarVTRCRImxznrkqSsSJcT+EE4dpXcxzlRsSaHwqxyeZzFB8AzM+Xx0fB9AN3cchLLe+dhO8BbVc6KTOeXdIhMGKIrsYRjIAdoc7XWpi3Qz1J4dxqChPk9vgPz2W2n0mm26pRWVHDAF51d0RKWurAvs36jGg1mt3ImZLFzk/dnZrtiIOwsGmYgXmzYRcgHg7ya7pHqWLgU7zqjW0VjmuhPzQY8MKJv2DiprUXE13a0sEl3yvaVr4H6t0Ut70/rHz1aei7KLlZErtQVjRv5NATV50sOsx8uzxxiIoR1taw3seef23lENm6jbVslnj6/z6JBxDF7sbYKe1AyeE4EliNipvdFolMLzxUy3iHvqRK9AkCBOdLLWAxFQo2v0tA4TwlqAnlTuW2dbxUOaJLl9w6t2bwiDALXmOQt5D/tQXLDtCXPHV/LlTSnO8oIvJOANhgTtDDx+2N9G9g5B3jcc3gDD+9sEl53GCYh8lY7w8Db9RRxwmDPtVhLW4h7aIRaqCW78VClyxOyoL/1kryTzXxaACtyACUMYVr0svq/zsy/k9fMmAVH3+NklXISLJEfIJ4KY3hPaX7QViiVnCStzVCf2hbL7O0bNbM294zs//nFpAAO/160Po1iLxvjM0QF8+ORHcs4ghfH+aPxGRLxFDwmtiyCk6U2L6qQ1Mw0coynZ5xkQzHunPvbXK6e6oV+TNxhaRaWH6yjmGo7X9F221/a+Y7zhBY7QjGB/IRtHXCC9fHgG3YQZDyaWQ6nLzJXXmsOUiJO4lz4qb3nVIZD8vwC5EbeAcPjWXoj1Ntd8LJYki+lFu4obQjUV9oykJciuvoXsLte4adOcdn4rLcFtL1cc7j6461XPxAedz4K3a63ea2CN3+1hb+fMscUv4pt73FkDg4MCw3xwDRX1PcpwXXuMQjzpYdzG9nfDWPbQ5ExO/vgzjxc3MKUC05OfifW9V2HBJ555MpoJ9kZADsOHjvSTL63QJlXtEtVVEJYk/LhEFllqrkJy65SpFq6MoXhP+4bkRQO77S8zcoKkzcDPgdFXS6ct60dz5zY0YpBmeFpQaFcwNsRCdDVIbIAHMQpasiL5EbW7H5OjZDd0UMwOjWziGyVJ0gCiRJJFtL6LtZ9CHj4fWjbP+WNnHe7Ffru0WjvF8jOLq4ugKN/7iABp+6Ri49FyxVnszvYslaLFMCWAJ2He5IBErA/QGeoxh8V1ErCMvj60ZhKnnWQEVXrBuV5F4YHCvZaoeC0oGbhJfxDkdndsPpLbAKaoOdGKE6jaW3q0YvFPEAiUgEKjoer1pczNU6T/eowvBrAke+l+Gz8hypOBxM6PE9VY/3benyeF/9MysdgB57VtKqOcfEySSHz4NIXvVX0Mare5FX3di30utzztsQnDej6M22VFUMmLpXQNqJf97iKkJFDEVF42yFRD7GPkqAbDl6Nd+FpTgH41vYzKrSY9IdO87Mdr/Ri8GaEKaSetqzT40MakePeWfV86nncTWVNGBi0Pk/t4+PAV3Bv7agRb6O8lYerM8A/AqDzvlbVBXUKjWZZ/c4XKZN2hOGy8ChDc/KJL4E8nmZBtFLln0McdZegDU7AWuEoEZZCa6LtoT4RD5eFzOmb6BEa5FFKh9vHZfTw8ZVsw0JHGYKR/orpvAfbC4WxQ0ayTpbzbPZzh1FZca9B+n0EDMcQ6iVKXAA5ehkmTPl1eiKdYGGUtvZRTYYYNB8xDcJuvq84TbArRN0qvRVDQ7HaNwoVBsv8wb0osfBVSSNyPw2qB5NPlf6M1XVAwXiyRiOH5XKZPOEKpvXvyIeuDoSfuEceKmT/Vgkjb/VuiO+4r088FPbK2b0NHGLLwskp0wibTgnkrAwlec5oiJLAVOx8pHW0xYv4gIqHgDuA5FM5H4EL2/PSMZe9+VAFCmnRo87pQrdA3YGxgNGcKyOlWoWmW0eaE2tEqUVRSNbEFSluFeEo4Frx4cP2Hk1f521uQl/HgoU4b3ADgOTn6r0+18INRE5yYpeWcHQcgZDDwgeN1yzEfPd23aWg2T9zUqtcmYGa0fVdzGyKsQj8h7GCiAO3gujoYO9BK0D9pi0qBxtrF6dzPlTW5QMTMouF1ZVxb3feZthfx6VIXxAyO2MhiO8r90LwKLG8iy4Kusu6aVrRk/C17LKL52IETJUW6Zc6Xll67YBfuy6WqThwllE2APfg/mjoa6dJpE/8r9BGfTCYb2PXYZgB8tW+mpu/FxOKVHdPjA4nzr2KrcqTv9qLXpQjzoPhXRNhRmhBJ6PJmRP+/CvOS6JVC/sCnxXg+t2sAl+xffR8vGmHTCEj1BzpkcExiPFyUV1/mJmPFnxWnluI1gBIYHXyGP6c4Mxkzm8SMcBOM0tyGkejSK0a6wCbLJkYTXl3thxtn3DvfVGASCw+msBKRGHDAFDC4+PhTVOr73mnRoNO59SwlXk9nIgGXTqUiIXq6RoL34a2/k0jGgn26s36pfW0HHhLY7tn8vdNtZ+VLlfV46j+3yDmaXHglIqCD7ABSEGQWR36ZoRnHN0XBXppblgEFSjmP63e4rOTmKgbbK0LkNF1T+Ef06SrdCvL4pqxyZzRgFrbGAohJKJYSyHVCAGIQOgid7fiISfkvr2DmhUeeYSgBHYEIBNSFmYyLau4+doT1AzwPT+6Y+dtKrbCFXi/383Z37iSpAc9zLPYL999Hcv7m225KLgUM19ipoUzDWbgF+SG3UiA8IzjopuBsO44yztf5cr6asuWcFUiC+o3UL+YHc8Oe09AYWS2TJstowQYlMAXIl8pAzotWA3E7vF0eqHSF+me13qAYXj6lhF9VT99FbL0jg/WmZ7Y52tgPIK/mUr0ISx8N0eus8Eq+KmgvmstZrzsQS5QX5g21ySyzCML0/rLCNbE29Io/RtgdOgJ+dY6FBKlCZVeaGFeaC17PLG0xj5zJohqZzVyhRbDlwk7ZnFJcFWeTqwnF6F+zy9if0wVjrDghIQ7h5kvc3qLN+7xip4EZIVd/hyd49iJyz2aSObJsLOkFYNvsikt1R3y/Q1fPJSduRm+T9oriKw3ia35eM4dSaWB4YiMqGk70JqCquaFrEVGpFAPtojM1kthO2ilOxuEuhwp1W1lz4oIyhbFXFE8NE/tIFHvvZEsfweWPPdBAti6whKy/MlaFCS3+1LquvoTpL7y+sdxR5nF2kFcXsb673pXE5vFR08ubBTN3KAnQH9bQ4w6L719v6mYq7yujlL+OwlYmJPUowctiOmIFlFaZBCuT/cAYi6oW0eCTK0l8McAa9+cLL/4G5d7ioOB+MkJwfmJ+/Ikl6pQG2oLuvki7sJ5Hge9+IWtJbm9e9pC+Dy8KyetZpBBACJtoKRZnPa2/wjfz0K862l10nBii5Gvc54aeXk3GJf5f2o1UgMskO4mN6UB28Gc1+feLwKEFD37JgcPE3qLrAHp2wSxJ712mRBn/7e6FUWLrJEBZBkHZTMMt20wlG8XTUQOF6ZCMSy4B77Id/5OuIz0YymqMYyX/htDSziok4/jbcV7dODH1hD6UWtdNTL9ck2incUF2lq7wDbr45kdMl+DcMyo/vYtNeujW4H0agttd1I5A5Bckq6zLOv/9E2LPqkCNlp8ZhIJt/iMmCpJCE8DVt3/zpn4YGYXvCjR1PlOvPJXmEdmPzcgRNXPd8a9f14mafkPNRmj89xashOTQU/4jSGWOp1trrPH5CQue6AYK8uIOiTUKljemMC5MQ7NPyJKNvINV7CgRupFcSZPIA0HQQDtB0iV0w+HXnrnH/mWD5EuFMmm6OwpK4uUy2mAI5ek3btXu6mDlL/rHSp4oKfJxupXUPdDqzrY/mHmpBBgw+16k8HapCxTPPQRQSQFLQNdp/H9Y/si/JErwaHcPWgJ9wowvVOi6xyAEh03yYyrNfwYllq+FgHJ9O8LH/cELVqG79CtQ3uIxe8zLtFpdPczP6EYZK/1q9EAfiYoL79O3RYlfar1Hn8GPRfRUJdMphCNdTWKb9mrnT4BhCgixxMkWng7cED+e+tpBXSGr5AYtApZVebYrFCRCkqmul8PZ4V0rIaW6YvdxTLeda1sxuQNlo4X71h23NQOR+Y6uiw57aajHeUotxjJTJ24g29VrpYjJwJfoq1J/qBVAg3iyQwAOPxiClvkdZn2v4Dac9P6Z5u9eeXvNdZRPwX4p8xu3XXLrgp+hD64hqqiXX6SS0Ji2q7ssC2Iudn3ciidCLY1K3RVhFHIBTKahiJnQD3PcUzZCPZ+3FilfKcO/Rk4eAAhuPywvN6SVLvnKROD/AGgPkIdMRsI/jKuGfTPJRBNT+IlMjx83YQFT0BvaVbHt1hu3iYGinQQLGjbtosVXIsSK8ccNbPo0rs96AKX1BaNkgMKHE2uQ47Lz0ltLCdI5RIJ6jwKRjN20CRQ3J3HOx6Hi0pYTB3kb7yua/MGKdH69s9EecsPcQI1iFrDDz0bEweomkbw8IUANOWL70o8htZcmahMVTeeFS+ZoCTK6PacnSE4BfgRlrbcPb8rV3Bq03Y7uRHv5XL7juFL4dXbjx3jERDHKOHRGSLB5/StZdXBp43gmTRj0vwnSds4y0aq72mJ/Z9zxxVntCbYfbDi2nBsxpzFHf2CbR2RtS0cXKQ8n8Fm6Z5BCf+bmzazaOFbm96ifrg30BJOgNw8wrTW9xCUx7v25kGSD8E0H+78CQQP11286+ZoSgEy03u23TuHm1+esBHzO5XtK4f52qh/WO7K3RGOXM1+YwcWE7gPinCKUihqdky3Qc3DFDp7jTjiCfxo+KXThyHbbNkqVUnUqbupvvIoHTYbyxZHwArDRVdzRFoBBBpeTQq8E7vJUyi0BqpOxpJ34X0apK513O8R00gKdis2E87tVAB142spBthuTJZuoMOkywRF9iFBliuwvCblPIPo3WK7yF+fpm20mVWt4hXtdD5ZfMcYUPqqjRqCgYKbjY54vvagOyenvFuJMpH7YT/278sH822kqU1Uj1QPRsH+Ukrj7vk93Aa3G3sff4Ctn97lE39Au3g+1SJJ5Pp3aZr5tMN6ke9kgYRdIOTYp1SVPK+vFb7levs5r8r/hVFZcrOEs/hADsfx/oSHd111bR9/9eGMp2/EvZJWt08pOtea5P5GBs+6xkRSe24p+TP58Bovi6bezoTAUPc7WAqm3j0VfsW1kpfR1xSPsNA24v6MqgJyMI860TSkUdt9EfYj5k2j//UuqdFaUUfC6It/Al3vKmJKCxlRYQgNGXSBw0xxxxbF5abPFiIOj4E2lYDsAWvoJHnmOUn0y6GCCohAjxPdyxiCc2r9kKNE7dZs80R/Hz8MfwYX5iMxnDP47+PyMBFJK+2lC9u8nbsyGpvqJZnBP6v31xUfg5K6ZJMOm6vYyJuJ5OfUiQvWJW20oZmgpA/J+FMEqCSNjyDiVJTR38fuQsuN678H2VocIX49tLI6KGgZNZR7Dsh1YR5iPENsfCbU5NTJ30rwP0oDBI0yN4OEhajIoUcfLyEn1oUGRPe93k/x+VLMXY/fCWOEGHlm6uDWDUUO4R0sE7sFl5hI2POSRYiao36Ne7vmlUCN8uSvVjUSJGf3bYD8JBgA8xdGm+t0RAYRbukat5Ka6J+qDV1XgPCzXEpQlJuBdnRVjUed1OA6A3f70H45IQImmTWkZSNQs5x7EAsMlHMh6lpEXQGanJH9Yb4HkXINoPE1p9GhDjDA1fO3X1rxJGfPwCmw26Uxk5dBvFPgqIF45upCFlBqkHKThnYOrWJl/1qlRzn2OQJbCZtRvGlm5N2QRvrO+9XDVMQO6Rvcjhe0IloS6OooBmkcEYOA/ukEmSj6uU1uD9gi1KlFJ4acl3LoP/u43ctP1YYApXFjrpfepbNNTpzr2iK5jLzVb8ERWqXRsJCjPiv89CK/9gLQSfVYASRiY3vvPEksI9TGRdD5CekhVTjficcRolSwxDS99sNZzWG5Alor0c2m5s/V2BiaRtbvo+PtfEIc1aw5nKw+2d+yycJBniZXeV+1TagJLh4eORQzu04bLTHUA2qQUFc+QBFeoRYu8PZZ/rEyqybtRuO8ZeXNBO7o/lfh19E0iLq216T+BXjT5wRGs8gkl5QsvI4e2oF8OXNRsH7qkOl419LK03xWxvkrF4f09jKYr2/zEl5SJJOqaj0juwYEiLBhq88vdbd1tJbrmYyO39HjS83fUjlXAmbn2HexLBtazOz1NjEWU5/WT1Fo0W9Tn6Kjp3SnWPqh/koouN7R8PCjxe47OIBE1NF/m4Cu7btfdQ8NiUeazd3eNsUQgN5YQyzGr9UQWxbVcdqpwGBq85cOHeV/IbvHr7Zz0dveGwpuwxxVkjlK4Yztwl+yIMa8Q6YMyb3FGGPfcsjYCUCdNLUgdCiVR6PRLelkfV9lg+bLnYFod/7R+xYphGMCHgAtRWwnFrdcmzh6GSQULIquMhY9/ltq7gukNf99L4ZHp2BRYTHDSqcdGcKv8bC/GTP3v9j6t6jkNc2Z1L1F3a2RRE8IPESKiNsyvKIhqxnfKzMQRaUyqjBg+RFP1nbeVtuD8PEoTTu8xnvFEEPX3UAeM6KRcBeoEgEeNXnd1cZylJ/HtnmuXcwgvpHZYLdhjO/7beJoVSTDK8ddqcpHN+o58wXHMORl8oooEldCcZecsW+wzVFh6gc3JlfmWC28t5bv1yLbpzUryJSJMhjI1APNf74TiMcHlz5xePUVnu3FDIsviOl/8HCE+XJHRf6GQ3V08bOgdwoKVlmpqKkfDVaApPZ0+Iy0RvlchUE2n4DADSfpyRhhKm05HUp7vN4K42pawWw0r1Z3NtL7YQD5EBTg1rGYQn53y1lZuqTpY7IC6IMxDGUJCuS8Tou//1ALsmHfa5ViuRBxjMVZ0NSKCwH+5LQX4s21csxiGA2jL8tgC3rSVEYDsmcMYOoyT/u0zf1HjdYVbw0MtJCkI56fpIg/BReNtua1SOaGyWWxyrYzdhRPChZDHg+zdVyhzlQAB7msLjCV63abhFGpsBg1eldxMdoI4dNvorkaz00DT8ii9SpCDD38xgzBMCsJWMgJUbB5x9qW5KrkV+hQVA6/3wLuBUYpzqE6O1IcyyxLZxXVOsSQ0jGzRt0s+sQZmiar4rYPEAKdiE/JZWhmxl1OyCoaP7sKybmruK9RZZ0Gop4zsN9TOOikQZd7ykpf4x23RCLf6p5KenQf9qnKiLui1JVCYDljn5eLGURUl1bKis7Zw+S7gkagLdp/SPOtsejITVJbtnMLuDnq1iOEZLbtYh2Jmwryo5gKT6Qr3I2JGvrlgbIS0fBEQPhIXF/aaAVF8VQCTu0V7WebBmKTxP4tf9YWBtC1qVje1r0w1SoQHeAnxVPiR2NaVIO1V3AWP+TJOBKVSKU0AGbl3JobRUg7Sz2Sc/2TiQRRIYp3ZxbKj9xYAPaauzG9PolA8/xbeGsP6jFG9TJ8d7vAf409HAKihsI67QsDvNUrK5DhPozIkwlWJq6EmhBYQFSqk2htPFa4akplbwMQzsVO6SO6DK12+oVm9NgdWRr1S1a65jRrP2z95i3F0ey2gQsfglKljPGW9HqGhuuowy3J4DZ2Irqa72rLNemqImIWhnJ1q8It/Xl+tq+a7tcKeWGCQHhwsjOXPrW/XnK2qUZcB8TiKI7sAzKNZkAi9N36UHzJZr8Wc+EqXBFNc8LUVQue+WW1I6rM2e827KzPr3uGCVQlJ662LJCXFjq4t8ob7MEZc2o9cbDgsv1nd69EkHSmN8VMvbRfNVWgNngJSHDJZejtbdlFGordpndp4Tg+6yybeESskekS96+r0a6ofXC4Mg//q8opk+QuF41ji7eJYHhBwFQlpHiF2bNk6Rd2juAS+AHezdA3Bhxh9tFEk42yCf2BXLqnG4cuU8R4ZA8KUeMGnsNmqc3fsJnHIE8SzAn17aG8Zkjxxvni7FA3PjyRkwxgP+puOZFqoanQ5WjGpfZl9tJTcDoB4GxiCjXL5zObiGISZ4PXpdx4ziHUkigyP+ytqSCGWhu8FI9ETjIEHGh/HQ1s8xNCg90vZcWN/+JQO+27f+FYbgmaS2FjZ0XqyFiLlbGhpLR8tjBTOdWehT/lCUWdS6rGiPW65Gz/PALsDF82OvCw4/dA0unFAR5k2m8V01dn33jiMFar0BueaRCSMAQiViHuXjEikND8jtA5Q/0dZ8Ms5QWs2yeHCWjyokDUQXrA3NoE2aliHaEuli9udCfXf8eD0MaGNFU1laA8oIcOWqxE+JVnCvwztqzDToXp2I8DGxaJIs8NFXb0Cjm1AkYQiJXnduSErSdpJxN1nXtFwyJsWGKC4R32e6veSIO5smne77NhUyeZaujoIl12rIcZXuwxq92tNSD20FmIOHxdVaX97VWzgnTG08mppuRnDRN5nDFlTWGL0ywImY/3p4Vibel4bNE+m7En2LQ3dt/FrWUPkNVjDugRaYj/nC369GvgBFkT0j4oE9SKWhk9dckGQZaCyGCXi9TbqdQVtsGEPEt9i/RMFeZ9dP0q4neBaB8OsmngNHRCqcF7pzTM38dHLNW2WCFh6NagNWPiMAMAQxbi1i4AP8LS3iWtIjLaP1aa5a6a4N4SeAHhsDIgaEzrLwykQUxP1T23WqtSuYQ9ghLnc9HM8C2cO54F4ZENtUoxI5cyapaQ4a6z3xCoy0mG6apNw5xVQPJltZ37muP3i7lWsObGn0OtHFqg1QZ2Sb4g6CtAP5x0Wwa4pSDmLCeDS19ge+wF41/1Xh0Mwfm+5qGgq+bBrTd6KLoTKaqa+DW6zyM2wcYX2X0Pl5QIfxHO9qE6CW1kqW3PRkp9n/0I9ggScwwuimB8Rih247kFbrFGCmHRDHqNAuErPC/wcthZbLaJ9W22qoa75WZX1gslAhE62Ws1ZDHF5UNuziwOOO0NOkOHlC9c5wm7gVUO6TLMYT1MqnzXiSMQLIcnTDGU/y9/VExh0pu09LSVLhmwzgt+sibv/qiEktkemT2FwMICpNpi0Luk8Ib1Mw6MGzfPpanHvrPPJUAsJ3CK3YuQbazpB9t75hpMIV214iTZxp1LFeLCqE4MPG5Y8MESNc3ZCNaHCvokK1zSCqOu2cNn9JiPwp7OoB7yLlgGNAauDMlQNnhJtDkvzlp+Haq4vA3IBvdKathJfuKdBO8qpQn8cT7WgzbYL4N86R8Q8UeKa097ofZkvE3eTsLB0a2qb0dg+N3AmxPDWMK0p3gQq70jvj7BaCqkINVgvWsIh9taqvFdHsGPA1fzwHfrEwyhIRc0FsDJ/q2V2oAz0pGjBRML9diXZ4Bca6DtCSr3rNpNwOD0sqyAoThJfCfCatZ8JvywE5I53f2CZ2BT9koUguQuKtPjlaezzCdzURsPyjDYwa8JAm4qOuGpxv1ET4RdbHsIcbB8UwfReO/7sIJb4b/ghKt7V20AK0KjZ4bgvBPujHMsuJY97cvCbEag2mwb3Ny/RWwO+R4J/4WeAMQPTAV7OL4rj4MN80jr0PbNPHKUusYGAAE0h7qvRa+VrUTpL/FQ7PIk4mRqvKcvKRZdr+KYOkrl3pEclVL5ZPXT4bH+LfR0yJVw4Z1ySyYRcnOZ+000EdEFp1L70g6/gbdJz08sbf827doJKk4QQ8OIeVS1fcgdFwctTuhNwJFakZVEmrju1alA1dIVADjt8fLiCHBuphd4AohgXiiODPgFdTN0QLQvHewiYuVwsLIWkTAux7x94LG+zOsmX4fTUVNcf5dgmrvlofB2Lv/qD+6uU1bo/EcXg32yyqFJDvkY7v8j+5aO2iW8yEVd0xtC3QPJZXq/JDFPq9QmGZu9iqzAbir80ojqtsoyB5juRFFCv2bRX4S3RYQIvJjl8izP6uchAdLtSAnk4nfzRl13xd37q7wRVKLYDnDuDxNd7bd5ll174mtzxmdXtV1QVpCHKPOkDuR20wGJuOsdd2Hf/b9ODxVbdqxgkladIplZAde2oqYzgwXsJDMNaT3o/uS2tgAxtpbH8IZ1nIh2ih1AXgI1YoGZSwulAqdveJx+saKy2akvAl4ZjRDeWkZu2NE6jZpdAOh0ABNsl0kjXt3gbq0IdIxLhMIWgyue8jISZy/MDtIiSEzGnbwlLe8Ckf8+q7lcHBJVLXoIRz5tLiSor7xXfcMsaBfEcP3w61371jm/YpKnRFaC0ZH5dBd9ZGITp2n9kkDooNF6vGcBy+tS50I7OcL4lnsU7cEAlD1YRfnsbX33CAUjLuZjlLmsCFaGiMfIuh42nbp+WdjuFxfOYNsYKSKSiqBI8Nhvgg7R11xOC1xLTudO5Y7uYi+EckhdSh1vvsoZg/6EVJRP64R0ZW5+iKpaYBdZXO0/Xe0UK5g4gHNYFzNQHyYwTdA9zRQbr2Ad3ponInRoil9+F4rLjauYW2ebalta3YaZDJmb0ImLTeLKCylNmlG1cnRJPbusg5J6iT/JKk0jPB4mx/67klAhQK2BJPv1FYmN/eSWQr/rhqjpU5wW0v5WX1+Vv/GyzIaPKKS5xBhJlztVjIAkrSOEsh4COMy8i//4NardRRjYpjFAZanjx67WCkOaZyUUJlInmeQNM1Ti143GCNQUXWnak+InZ4UALn66W+oMuP5+yyLFYHZqj7/HBp9t7IBBYqI1dZVEQeD09DUCxXICbjwr4aPg4My5Ol/bi+fUFPrRXxL9X+rKd4YtVVVNIGH5K6CqTIYajgo6aTSog9sdxzfPy12SgNKmNKy0P0XX3L39c8OEkLqz/17Yrr+yNEkm4ckLrz8eZSgpA21KAFMVKwd90JXUUb5y1kAXBScfo/zEFziMFQHYPhJ08OyZ/U4RZgPJnG/knI5qGPg9WXN4P7e4sslbKeKWw/zOrDiKNL++1RwnepiVt9MfxYX08ZsSwmedAi+N+f0bk0SXlU04d4sf9XAEo0HN0QK1+NVZ/Nw/90lPBMKtVOpifhgEGB2QWRzEKej2MmMo1Kg2yoBA1QS4WJJeR5lGJELQbJi4Hl9VLSXWFshEWdzCtenThbMVszRhr+tEn1MBZ6gsichx38gb3YYNACfwjG8nkvIciaLGTKtLCaUVEvEJt+/9pb8RZif6Uj1kMP/CGaiHnQnetmPvP997H/7ESiMu/mhbYIHW219ugVvFqSKL4HhFDtk5wJRDEkgRw/ZUOsTs326Rqn7JlAmeJ5pCnyHmFrdog/esurfKjjiMsEleAsxRKGGtsk88tyPKBot1M23CR0CSvNt28tOwrlzaQwvZNyhKve94rGkDtvB5rwPrWlZMZvpntcxcU3QzNdCGB5PRWKhcFmZsydvuWlxb6e9Y/7+qhvm+Kctn4PLWHLyZfY8ZSxNobqLRM4vwPhaHcQWpAIvM4xz6ilshccqrVYA71bIGlGfiaQVgJAE6M2jbrNqK+fZlbX8InNrUo4zH52suxVkPgTeNfuQUGGx8D6YSDP5AVb0Wu6MwOcDQh3vn8XZFZDBew3/LyHnD1TmJb1s+32snzTRxdvQ1k+lct96MTDH7I5B07FG2y4MVYY2p3eoL88CuMPSf9hq8LA9XqidytZLx8A+xQvgpOYzEfzqZPzBrqwQUpCZ9mtAY+Qu3ijfea8cJI4PbmqESGxs88wMiO0zm1ZGg2PpGHL1VxnGWRWVqvgjAvVlk0nYM2M2fFfzAPsuRhFIJgaWt0LHwow8oAGgaQqO1Lkzy43Ym4hm9hv/wraW04EM94VXrXGHUp9PqJ7bFdBKoNk+qwHCowaSlx+kL5/z62AQ+S6lHBtxYuaeqb+g/S0VmkbuQxCsotGtjPBZsXaDv5hIZa6TNZ7FKJMQKv6BSxHcD37BXQ7JG1mKyCoaEWgQ8A7ofeshB3OloPibARmIAnt8UQLIDeNR5GNjdknc4IU0+NdTbSEjQMhBbP4+LyIcEUB+WXAm695F1BGBZaM8W84cq5fFnDC2X7S9xCJEoEz++Vl5VPmVyc9Hjb6AIyUBWC/Tyv4yAtim+mdbpcvFFeILXWKeVdspbYFei1GeC+i+F2mtNADmXuVnZ/gkkekcZ/DAmKcwFabtPl2A/RNG8tARJw9/JmOZ1LoWlGows1H1pNTetO+pqAl31j8vg7bQy8ByROSaw8aqo0csfm6D8+XKxa9n3ntGS1GzBITAPzfZSyuMXpsH8+omQfWC6WQKXZWuubRnjVI/jZ4dy83Rmv7M75eKgqrda+D2ojlwP+eEbwTyx8JVisSxu+pFGy5eQSi4lQ4DNm0aECpW7aKZq8DZKq75/VTDntPx9aD+nXXnotg4L86JlKR6HtjCmTDjVq1Cn0e0z5JWqvFaGkF6QSnUiuAs8ufsRKLGX3efglmIvYBPEqtzHqugj5q/QcRteNCJLr25JgSCyeegRC6jZFMfKNPnWOR61rv1uyjhZfLf3jorr0X2se03x448BSIu076MN90H4ecp1X1hI69+ZEpPdQ7Q4QaAC0YeEVLt3l4R2m+g8nyzSlTL6+XCfeDxwZvH7kIkhn+HUqHw1aCPZRbAiEuVxiLczcuwpduiUEeitA5CFMf3EB5mpvNunWSwKCEW8vz6b9+POB1RaD6/eoilR3AEeIfpWIdgfxxy2Gri8GD+/X3C/0DnnZPZTcuYmDDq7yvanqtMftmSVlhQFh2WeY58GUn8+8feFVnI0DsnOpaeM0tVf08zMhObqwRUh/dm3X4K9BTHNGe3wsez+UIGfsJvttqp6mlwFTELBEG5eLDHjlH0q5z2K4MZ/9GMpuBoYZz4iXOxFp22IYviRWF1sXIBatQcjwDzGHN9SIuOrb5H8IJ3fvLoWWU+FqT7pZl+eXqm9tAYV4pgcBOm5H3yY39ihtXKblGbfCRiFdRgtTi5QWiSVL5TtmLLCStK6g3B1DX/WSyzy17gD5DnH8+Mc/nKwxm6SZGaaAnN1GuMN+DrEKzUwmT2HXfrGAzs6/fH2D4475sI+JeZpo8n6J527sZi78rF/+EX/IFgtHJBah2BSajVrPPrbOnp0cqESAHma4D+fwUOkp83DD/oFUslStcHVoAoV6t/3pVHjfckv9NjQIVSVM4t21Xsxk0PqK7FXZ2CC2OWQGnkIJngM0ysKBrmAhOKe5CG0kwk2smCKyoWHbRGPYNrvyCPaldSp2EQydv7JjrCUlrupfkfKt1ab1aoZDIsUBBVFzgvgI3Eiz7qVKdH47waGVnEcwt6B5VHFVY65VTeXKGBTKFtH7x5aHt4GAmMI7P8bUhuSvpAkffNGN/QbYCDz3piUxgC3cmNHKg7exejdBDf0FXD6AuogzxHA5v0regBcksFMFlgScCgjDAZcY645BYeDeSaQGoGOqQa3d5H8nJhK1VzlLDI2EwqCaBgjP1fo0KkQvz+0xN+DItmft20zXyFh1B8arpGFTg/9cSH0IJ0zxqB6/5cSewXbwcU7+8378NVmCtqxGjN/lzuH6On1MCTev2CKGqYlO91ZsWGb/dL/TZdYWww/SczSILMHbgCGSyfn38hWK4lyvht8fArq+SDlZRB7zrr0Lfp+7gokTIxOgCuYfnhRLeO2Np6Ohkp/+HsqBsU6pDHJ9RyD9xI5zu3wHTs5ZqZgS2Y4fNjw94me78lHfsZqtc+11cGM4BK8ymOWXpe/k1ke2iUL8lktZJVTZujIrQwa811aAqx/hGSd3JPd8xPSvzUnPUssiC58EwhFv4LZUcM68Uk1oRKEG8B8vRW73I4uwNhkqVFccQUHjufuKT3n3izvfox6lba33vskd31xlvfyUSwVSqf3x8upu/HcAIvpzGQcK6vs06HSDswro0N9XtnpDJf/UgwxazOxAQ3c1HTyzJAm7PnkPp29Wh4axzxxLlZhZto/ErLz5njDYRoGi65lChQGzCD/8XYCVuLp5Ig1+o2sKbh6AU+s21TmiWGczT+zPimq+vyz7NdfNx7/QnMVtFX6qpXmM9WZl0hSD9kRfqEbGKJBM66kMAcqRCDMqzFXSr6HddHX7gofjTnICTna5p2t2ZcCJL6CjN0TjjmUGbWW55FrM37P0kzjnyLEYNDxn0fHXltD5zg7s7BK1/PlejHf4OSVnkw/z6s83utDcTJsBZivJyQego0GTnONwzGuO3qHWSju4GS2xQ/ZcE/K/BqhSaSbXuCnGmetPJ1gn9OrF6XiO9+AmpfLAJfFzfrChGPPuEKxff6DwlrKSe+Yo1fKuGCji0xUMLT25dp9Ng5oQoAoG4Bfk+H/7jy7cJygEDxZoxPaXIefn+5ahz06mXEbJNjRQT2+2zFs4y/CGZ9NMj0ppFLFOUjhICH6wafFkvXpAMcw5oGfvkNoSRcCrHJIQrxJpmsX8LPoEbigjnR8tpWuzqEsedPuPpYDpiqfIw7CZvNWJiIKx+ePCsJwRa+5h/WsWFU7Jqm1Y+vUXwy3d2Vlj77KykowDnq1MvyUJSmh2BAtCqnLog2tV7aWWas6ils76bNf78zfvjHNEZ/0HdxCNcAkkj5TZq1L2Q+TQupTbfGIsye7DtvD3/VU17Bp1YvfaQnCjZwJDqf9x4n9LyWuYMJEcup2wK01kebjgB+aubLPaY03NA0nErk/wTHs7viyM21IwhJD8fCysKmTmZrhlmr/rYiMjM4460ydVtresoX2F2oDFkG4klnJfpUWNsc4J1bV6Ghh8DR2K+46QVk3sOgI2uauSXTQtttzEyTiXaGAAakllQVBuoVqj+GcMIiT2cirHPAwvoIcQ+0HEplDmv1SUm3Cn04MgQ0HQZtKiuWsHRjEKJx19zqiiGYMKm8m7JLJ7PbxD1+/pR7K4hSs5p2IKY3JXugmqPHhBX7yopoiDscG+XQjSmXObuHUXMIumXxg7stWNamZW8J32BiyMaz+L/5GNcx+pq5D7+4VUk0iauoL+TKHo5wdCVlOyvZPZbZUvG+qq6rHYkVkgp4lhJL2WRyEgm7qYbxrpc4m4jhFtp6dGYO1q8r5p64BlsXUo5S5cuYH8boMpiOlkzL6Ud0RxN7ubbCxDR6ickzTdf4C9FH7MfOnsk9uFuhkAs/jwxhP9OwUXEUJIg2we01LmF1YsQY0QC3In4BSVWXGwALHnK7LCiYJmF07dNjhYKSMD6yzPzQZXmR/Ws6FzAI5srUjYmjIRrfNeaO6nvpJ7aE08GXeDWfROdh7BJtbojn3WozSV0yEhqea9cqW96TCCy4f7RQCagNUCdd0PNLeBPhTJUnZvobYOgtBKMogEobN4JBD+cj4E2SDEYOmbvlO2UPea22EDNWXwEenHMqe6A8yhQiKUNF8eou2/aIZJRDd3svKwiJYP9MeEiJnKWKkL80oo9wWGjh4Fep3W1vN2F+jZTI7+Y89ITeyBEePvzCXqHWuNSZKEzjfdEUyvcWQtA+FSVZMew4uvCbCzpMUL8ssKo+8+FogFvrpDirUMS1lAUL3Uw78Uv3z9RHHn/SKF8/SsrW4Qa0iRFVRT1twJ49S4mil2/lg0Ij0OmcQcmQjq/iIerWREdB1Ne9NCETeuvfCTCSHg7eYijVCwRzWyYJ6ugpivYeWZ9wka00N9QIEoBKEYSmkscp2G8KIfb+VIeEHDuD9yLLPc3Qr1Of+cw760vRIzB4AHCf3amoC9L3pybdEQDFDdVPFHwfK7sDyUyPJoqoLSvlC7gHIyEkqWBrr5S8g1P4cGDQdgqsIayLKkyVHjgS2MudiyYgzwt8QLsmuFNSnONeAUJu0hCbkD8zKt0eTmfGbG8K+sjW4WHwxCIxP25dt3CzIFDo4/xXj5NUZ9dY4x7IHp8ERhe/gS06F9g1BQRD4OpuaRPFF2uvhZVgdxbkvg8ejsjh2V1MmlULiEHTyBI77xBiFODwtMXgaW85YQSnMK6U6TpnRUf8jdKnHTc87QmFoGbCc5bTF0FynLKp/I0gOFRyPYmhgT3jnRfUvOYZHab+eJSq49xkYh5NRv5/4k52h3ZSDMhYYftPWvzFpmsRQXVikiSZmdnM5i8tt3ZXA9UgOFMTjRXVqhrpm2S5qcWin9WutDRQuhBjE/oi48x5Y2zm3gOqDpQ9pHCpkeyRq4wKUk756/h9m4m5ggpJy5574NmYgiMKDMFlDd6HV6iVTGQLFnkVXpPiirne9qYjUivl4KSypsAYW/dC+stQQ0HkuuU44AVk0THDOj5C1hgpuiNqg+rrvEp5aRalWEyitG9Q7quZNdj7/NVJaBWiOmlYylB6Hs9tFwTaHc49F6prkElV5UcsVZRaCF6dCzkzsjEu1ZAaP6FB1pDxAlKWJ895MuDwsk0i+0fw8d1njQZFK/zq0Zue7KvR6ljBXjXczsn9N9HYCM4dxvlkOM5GEqUhLNJDdwhO2JkKjNS31wCmOeQJzDym0UqFF3EhZSuYERR2OOmdqbmDcXqoHPbPEtqvn4EU0v6woMAXVyGKfkI2fNGG7r21EjcxionO0KlMPewBcN6uedsk7ev9mo7OFKG9sxaHZPnOUPh98v0govQA/TbjpV9Ay9aZm2wuoflVGPLQJDk+LjJTb/DziB2kZ0RJTNzC6CEIk+zsURFfhugcaZunGvRPIY4VI9U28gzIos9TggoWp6e1jN1yGDCTAlf4EcVQMF4zULx4lWC4fRX03u8WOOCNRXpoWzlQFhWIrmlHguxswlfWAAPVtoXumOlEEYw6Xyw99sM23ogCnD/6v1MhUIWk/23AyUd8ykICDZGShY0fUTztmZRbObjbwLj9UuwOOhNNez80wHZMQWPVpcBnkTmEkY+mSIjSVIuH8Xuoh4SLpZKGlDJRqzVOMwdO5Qf4bGuRTpyKwAqt/kbVNdp8uFoQ2VifD0yjS0zry/5Qqj/AHQvX5GW7T4WHPa/0mv71H+RcjGhVTwOODOsqghCZhxKd1bLwISHhHQ7G+qwljV7x2n5uarALcU+c5YBgERkRR+KNM20ph1TW8CH965QBII084VOWjagf43AxWTthY6TKEyyFQhiDPE6HpGz+FaXkrfDC/AdksPTTagjzpsRAmjm4R7DZbnuwmqPKP1+GpZgiJEV3PbJyt6C+D63oJnFjctxC+w6J4xnlX1B1Ns1pyNAZapB9tc+hvmVw5hIKBuxjMgTdtWVEYg1SM1SixQ+0aVDC3i0M4kaBfu+dZEa4UFZ0807Url6m9KkkmZP1JPga9cWYYuB0gzDUAGu6j6docBU1mrkWWKueemSO3TAYNvL9su9APaSiDnhHrtBGS5G9WwscNft8x2m9eBXhEh81HspxIW95xzAYhwMwUd32dFEbeBMUaT+61kuR45ZCGUjNUFbP1B3xX7w1yV14m/qp7gE9qFfdLO/I4QmTgG2tNjgNefUMWZO0fVmP9yXzS0HoVUzQxy0U+8NjEwKBVhCkwSr2M1CeUOh9CE993hdOb4Bg4KAnJ98zYuRiFAG1EXxA0RPf4blZNnHdnhvmN4vCuOgczDtBKOAC1b4lNxzAOLh5DLs5IApCOTo+m3JFviXFez0dO7NdkWFqKUetTPCdtCJuo//ASuE4MMuBSS1dGIZdpKNqKgtmJqfKdyu71TIWIeQlAdVn0NFmqBgBPdbts2nVUF0ak/DOClgStYWRvRQgifTWPK55ny/tyV1dsqaT1EtflapPn9uD1jU69ePWTgvkeeQB6BcS2hgPnDW/NVOvVtXakZ8BFNpwJ16bpdyyMwW9M4PVHSlQ1OvQrJnjwxH+uh/pgtDUjIcLc9u1X9D7liVtQ0snMlIIjrLR7gJEJopViJrx2bvUazNqgTRPyCqUtbv7NFt96TDuqaVYas8JmXtfbOpScg4ZyCSnXJq7wLZrAh9zwXGnu+YiHYMAbZlcxREyzjgkY9zz+q0KYXP7dOIFAXCJI4xgWvLXeCDqOv6DR8YszqmtnmqEr7Vag3hio/81FZ3auw0u976m5XlPvvwBjD7eZw1oZRgEgv3Zg9J471aRayeinAOL1ercXP5d3v4VeUI21bSG9qssrS7/IgcSkqzHJtlxgD3jDgTgURRAPaAhoWfRMmHgXMaNktsaNlkAaB+494UnHBrVMREkNdAzYqjQumNkYB8yEh39r+AMj30CA93FxVrrhuCWtozYQXT7uxt4LKVJ78f86oj05j7jeGgXtabKIk7w6OFt+R1PZTDd3/CV3gTZ8DcBXpi9tOHb441BnY2Cy9faR1BOI4xK0HWYpHYN2rJcBeJpi5SykQryLESfXAudbXCHT4ckpy3XrRRz4ngCV2REV7U2TZ5EvTfwUd8M54VwQQq8CzkziZPLMpPyqqI/8pP9BmLdniTuHWQNu3pV5cKf+AMLX5xNJwMMsFlbz5G+0WjhtKBgwVhl24UP6Z1VIIsBvE3A8Npr9dRxASifie3t4rkqJ0HG8ofxp+kRWhnRwAdq9pOpPbrfrWBPIpP/l6gbMD0cyGIxtOyfo584UqvMQh6sCa0zH1sWRWXdKNN5L8mS/vdn1MVWba0Y2zfyI0+rDaPW/S941ViWkeYVSAwvZAXBWTleqmbCZZC42ienyo89sSbSDxy9/1XyGIADHCYGC3QQSWSSbzZOEmTROW9c1DMiS6g6vJ8jspRv5MHWbJoW+Xt6+weICMDsOnUoAQerE0zeFvYesPQfDMnwt2ZC5bWmiEyL21WmOYFsmjI1eMCw7bDkI4l5eEEWo9fCXEAzLlUBZwRxE5xcuREj1F+qZhRxPx6SCykQsFYExma0pNVrADvfrJySbGFHT+qMJSz8dmCEuyKuOXRnUvcJmPmPRQiMBGGzwXmmygxvBx0e+yZiy0w1sxbWNRuse54yRMvvIeOYnCt0KllCUYQinZbZYx+VlNmxy/7rGK9qevio3T8Gphu5D3BstSF6EXF71GhP+Bg2XQ9/r4DFs9ZPa8JTs6bxIl/Y6vNaYnEmYitlSigYAJik/E6knoXcVsgJmhlxtVXEwfOrTlq6N923ZQn1oGEf/D+XZ0Q+KdB1AS/DxssYq53N6hPxZ0ntCPfUcPWL/zN+3sKWbdTL+pU/cFakDNDY/hIkr+Kg9O/KcB3YmMIiXU/5K83CcuVIaWqU/tCsLaZ04ycHODq1wcFSk+vd04MqB5clW3pfydS2fRa+Xkwv0arD8I0cCeZ3ul1jghGDniileAbyJL+9Cqrks+ipcs/PsFbQs+Uodg6oaqiqDGMFMrM2I0aWZjRPRZjAk5Z3XLZxLkHf6bKoLiT26XVhAhZJgaRRHg0riYcy+hOtat7/X5Ykum4+Z8vas0JXMOhEnvsJhcCmTeQDrLBA2+KPvDVqJgSnvDWDN1e7vKIJNchlfKJNEAUXjhd630zJyE3/t8lsy3uAPIIaEFBI60WExe13nRDOFVzE0T39P+v3vg5ip1WtSk0ixgzQTAJszDCVMR/Hx4AGhTKUP/gcYZtOQ2n0xzFbtsE3Dd9lHU+s9ZtraTt4q2nmAizT+MA42dqhWR5+X8k/LzoAX7O96C0CoMCj4CeatQdfR41+1t9ebRlQcVWBDDqOa5bevC6EniB6YFvef2MzOElx+HidiAoFaUeKjz66LFSlNK2T9nq1uYKxuktjfFhUFnp0F9JmztYdD49hI3f1CmQ16r6znzecw6RxMCwJ/i9b4x3G1xo5ZxA45IjRchjieeWUd2+o6QRp5N7jFdi8qhvk9VuRWHXENNH3p6E/ItiF0DFop8bEYDnJGqgdddRwAhiG6+UVphAnDwhmJ8NTyoQ6Xn9qCEN644U3ICGvMMvZQBrnmpQve7qKwZzebzG6ainzEjZ1uRMy6holvbHg2mxKISJdnr1lNGLjVyCWAh1QJLCSX1waj2pgbYHpcdtrJLBTtOKNzu6NLkx8oN4Rb/Uvc0At1NxCnlVrr6GMye5MSke3eCguLpA2AqxUZyMa9Sa9VuBDDAWGYr0ZMuQ9KRamlFrDrUs32gwYVkUHTuT4pmvamtiOdvCbsSOC9PTQMedCFQr5r97soNlzCgn9M1TIZpD7eLlHh0eZmMssiwvCXnUXv0E17yvPKDuakTR1Rd52MPiKQuQ9PkTPRAOLFvtUe+8awREeXg7C8zp8kJ4BeZCMG3kSVxSbvhUgQoQvwb8vWiGZtoL4YsiZpkbwfibZUu1h4OnVw930c+0EIo8Q8OHZQp5Z5YZ8We7jmo32d0/SoARBWfSpp44RUF4w0789PEaAv3zsgxBqzfpLSKH71NbKhiGngctXSMiwG7PZkd5wlt3tYS8Z+DYQX0szGQaP8ma3nMhtAJDBSbQJZvvmHQgXVlEBz8tITydraIfxdr0fPzYKx6A7oZNmqAKIup+fVuDXZjURGXVgoya2p9cx4iQMrFKuh7aJi1ABQefgaAdk8icneMWQNGls1fpzml99W8lp0r0BPxO7NpBRb8Oh1gf0mx6YPTTiYDx0nUpscfpXv54BF8jIjNCcE6A8ht42pSfXYz59yX9SxyYEBsr4br8QCnuEc2WyKEAD+2aeDBDTwJcrGlG5ZmhPvjFxf//HEja62bYGVa7IpVLZ4fBpbYyy8At2c1jVhTltfrOyqqnae+PKqkYur9Lc84GkgyhGgfR98EyX/DoGWT/DJMnk2CFaw1riKSW/UmOPVYcL94yiLJxVLMQWvFXJAE9mlox3yvaP2GkkakrrwhSSZ127PSYagJTZWOCozXRaj7o9FpC9nLUxv+2aqhDI+7kXLIKmlrJCK2PhBGCsfAveuhdrApwsrISBb6IVLSzEMwWcDqn+ST7V74RSFf+vpmm1KvPhT2dqUQ6VqlDMoTeKdlCrcUhQqMtnoZLqvMgJofSaP+thn0T6909utefhaPVwpQ8i3x2eAc4xpm6v5HY47CGcSsu84XZQ7pKewHh0Z8+P9sAufEWmresnli4NG5UJgKtSeXZ8AU65XrRrPuN83a5Lb+t7TF4LM0fCJOjuyKMLa/FqOurj+n87xQyF+bCE91ioxYBEJ/zcL5I9P/nN0xPSwznRdesS7WbqO7GKV0J92KiUuNCU/PdSCHUTuz8CNmN5iC9AuC22ouAIYb3e2u2f8G7JZF+Q6LyASqfHDpURLFfMKe1Go7Q/Z8CzsLGTsD7+LY4xC50ESl5jAmEKvgp0x5nu3Hc7nets+ZbjGC2xa0I954seepvWHmWQryTy0vnG8QFLI74l12W1+479Yk34BRSdokUj6cDo17GLjJFHIxtFbtnLvLc9UePRtpA9FlPocK+56eZNfMH4DciPUw7YKFvD2PbWjENwBqwWUPUEjbEoXbeyfG0P6MQ56d4VBRvA0uhGJ2vt6oj+0vEJGbW9CFJ3EYkYBC2KbpRor+g9Jo5Lb0hmZqplT/Viv04grSSNQPEmS66RVyD5Vp4T1OdK3MsrsoeIlKGLyRtY7520QZOasOESLUhjteu5gYnZ+k5yrG0Am9dogVxjPKq6gzjQm6WGIPAnpNkOcmpp1OhRzz492zK35qx7VNMpTZxWSGx9GoEDAAQuv/EWF2C4X52qMZcuOL9+4j7UEbdh4mUj6aM0/l29btVf9McWhc2+de7/9uw2+pR6+jMtYMYyNyIXq0MlazgHhqvgm+srJ4xINK7L2paWdTC70BYLyCzv3loi/jQNHhii8vmPmAexFtuefaWYQdLd+ryMfkJZpEYzB0wckBnGJZITAuACi5DoZuR6WToy5r/bukFW5TyVx7iaWNaRDAeB3fjFOql3f16XVDTVRzBfYxG4t3TfHslAijr8I7M81hNVk67BMV79iDXsBMZdIAfXUY18YQDQYg4YNVD5MfIS/jehgWI4KztsNWxOoT3m4qutYZfi7/39WENVYNbwT/4h7bNh/gGBzr0RliYZjOhyUER3qaJSzfV9FZqdNHocDsemYc1UwuC6RSoLxakEtuYa2WJTLTykVhRvReUqtjEW6rOq31l9KRgvgm3o5P0tOc7gw5IDidQ4zA/QxO2BJhG38AT+M0iYmOg4G2zeTLMdOo38zJk0fdM/IkyPDi6T12yv+rbqvvZORtYQMmKxwCVdbCyaSy9IpnTLUws8RAfeMKBwqrl7by2L0vVOcxXDUaYggGXCH2iWpHj+kOwB5fOc6b2s+kceDyNxTAHJh7t5LZe5bFDfyv+Hbtcz2balptTzXMguJCdfW9pUbdCrfWyl2obMPTp/W3RCIWG/aYCFKvYTS+3GkU3flCUkmpCEkQvEOdpMwybUNIRuTG4gp9QEnWLxcgk2jUhFyRpWJzs9lq5cmuPiphIeXBREYeaUAHqoHazwJ0KehVm/PuVlCJ1KGTasXhqW/zvwnrBYlHrv7sIIZ1WEHltQMeMZCq4Aj5yuPwlh3/FdzgLk/Vg7EmYbD8YPfzRrCst5taFW1hjTyyrrdQi+IdfrD14CM+BBmqc/y2ii6dt7dFZV6SwJCVMdfnxug3JBJgu5DHwXyEqOZQ6jAQsg1x6tcEFOBoqKbHmERvwNs4o+d5J0gQkoCg5/iZmolvkyfTM3WIU/96U0HRfAGeLr9eaYVPeHVViOUm1YzPDe11GBIf/s3styYNnHdSqSsFuhJqSrkSt9dcpYUn+aIlijjhev2cO1kINs4cKNYHo2nemjUg+ExPPovzKlds8nj0RoL6di8jMpRw+fKK0B72HxdUnuSG6jO8dOezFDvPlNFL0gAdKiuCWnX2t2OwAlGr5fxDhcpw5+9kUIU+zM/Dv6h09Ca//JXV8XNiHALPlTH3Eg3z+7C6Y8oOM4IxQBzoBNsH3LYtrmyiATTMBMLDirk0PB0ptTrqZG+R3RHW7jqyq11NZ9SfKEu9in9+6YME7djZZdeykvrwF73Zc1cUxGun1q2QBMd55vJ0LMLdcY7vmtDnFWZDIoCeSXZZ4WsOl5/vDshHoUJm1VeEQKUd83jFZfl6kdN2CS3u7AAPscqjdWTgpWs/n6Q8JdLQ6vetCFLv1xzNLZpPZu3gRZ8sYWxiKXMJu3Dh423X+nU2BrnpePQJJFlpHnHuSmeYgH6xl54W+uHXw/rw0TyAtQSCsBpVBfyQPg4DBJaPkTKrY81Nc5XTUahS1zvjkgQ8cqvYfezEUTApFQgKeEKN4RCvQ5AyOsv3fdtKs9reiAvYWK3vXgjs5l00POAf8KL6viTpNqT11jPseX+Eh2R0/D4f7rH8iduJVLRgIhYw/PQUXy8kzA7hjjBQxeI3joud7ZdjlWz3azTo8tJaFMTMFRCcLztB3hNSS4jxZQi2oS8pMigtcM2sXGcLhMJSnk20mVY/R6AwNOZVmVC5hRwU24mFSyePP7kOpCn3CO+Za2oI/MXhadm5niLYg1midh70XLLK8+Gbusi8nKsGHL3XUpXoNxoNtV7TLQfi33IAxORqZRRWJKZ1/4kvhzZ43VXwSKrFAl3Fpdd3NGkCymzjRXCEWT/Z7QiNs9/dckza7o+uzkOrPZe62Nq/d5WNgi5bCFHcp2Sv2HznCC1u0lZsWhO0BBWpRwUGlRiUNx43Z26GheqQ46j7FtXVOaFOKmDjQy0D2Q7lamUYhBVweTuHlPRiec1/vJc7dZs4Tm1urtugrw6gBc9iVTvAOqbAP8oSkw+wI/fZToSdsRH1rF0TE3ltidJ+Akd7xuqgHD+pc0XCHc2oOAjLGgdR3dd/cZ1E64SDenEn/YEYSYQiLKizYvwOJp/++hEj6h4xYU3l2p72/7BxrrAkpi0UNwe9mBrkE5RSEFfIxtUU7o3V+WAO55gNVjsB3jvnGdNPJLxbh5DdLfZm1MRDAUn9oDaK45q07q1CURzmRhXGOBtqNcqEt4Ofp0iFrD9IGKuokaqX3EakrSXGEGJ3SglZ5tAwuMuD1rh3UhroMti/zbIwkvyKxLWM8EpI+KnWmS7ap04dh4RqRKLeRxRZox2hckbNwr/Ve4Dr/77nLLXOFiIWCZWyduoM+AeYaJUxHw6KN5nF3PrRB7NqluNJa089tTVIHHBxDjIoJ/mLz9Ap1kPzJLgAgyj1VZlyKeWfP4ftF7kCXpYFwcrnvIl/FMQSyq238eGajJW9oHvxqxWQ2cKChlAX85kPx5cLN9Ia/6MJOadk5jPNCHLibtO0aUIUaE0nEFN4eJbGHp9zpoiNxeIQHMyRGp8uFoTs3yaJUGJVXCIRA4Ig76STaGLXxI6LXlhepx+X6XFxeb6wfjb3EXVfW5GJ6AOLLHt4BWB2F9GRZpZlAPEQt2fjt7TAju+Raz8ZtcLxNphV5MMJZ/ipB9zORNEDnqbs/imof2j+g3o2VhXG18HSnNJ1U48dUW6cOpPnOsvt6t6izxl4L3qDNbqlBn+FcPf75Mu6pWgB85VsDqcUWsqIS5mAgytK71wZhlkSOcWjcMZVaHi0wK+7n0xIX+p7dJu5RsLwpjHO976A480OnKmDO/9cJu5BjN2Xht09i/OGwxXmR+Xx9QHXRWBsEl35Zrey64UP6lKML2OH2MAu9Nrl492D/YKCU1RAgh1CG9/E1hJchD0W+etLpprNG2bptskNhe2bUZTMhjOCx0HiFHrN9gYe5A2H5FdM3hA+4l2mc6JqwyFJaaNzBXy3jX8YpXP4IKRc0SAaFRZdoHRlHD17e259Oubam9dFA1vg3H4PwVF21j6Jd66q1BBDsclhFVF31Yfm3ciVQuICFWGcokeFnomnqbUn0n1wMD8LDCLMzetrdGaNtVH8D5TmJTxTCLpxE1wQQGQp2ZDfTfBjXSODzzGTMOvSBQ6qyeOH5Ksyq5gptW2XVmqtcnF8WoqsWPmQGRuuFZ1xYdh57imQFmh36ycdVAEpMf02yxCsl2BZErN1iyXk+q35rQRpCBN7Y33g7xKmTBSk11Hlxyfk/3I9mZw9/m+o5CiGWKBbHGqJPYRPUnrGI7V+JoqFZOXBb5+WwE1TqZpELGG/7iKYslUShzfeTbdKUgzC2FPciAzUpwKR/DBaa6a/mIH6v5ftvfS9uMqbPDc9rkem9er56w09oy2RnO8WC6AD6O1HMnkfmWNsIPEHvAn17wWMwGs7wky5gjhVfFqXUjqScrEW5k5+kfCf3R/rjctrJbsIHMUi+pP9+eSMhx74BqsRGtpy0JLRnx+DmyVv3+5HjKy9aeX9clswIXdvZ5MTtEMAGvfLJETydA7EH1sj2uSNslc4FmIqQzA03h7cK73wm+vh6BEqBJ9iPREMyZzM/wdoV4KPlECkNUd4D9RvR9tghKHuBE6cr0XWu/MXIrDJEvSWTRBIIqwo4LXDgxzisvoRlgBeICm+qPUIWT90WgBCRQO8FRRl9+KxAExnvxsiHbhSB+BBcpxAXMYdHNQ1CCIVCnFUepbWIkqCmuJzXByUbfPePzCSVrqD30lYU5ewmvk+B786IVKmfZQSS71VGvyW/vtdEjg5yVRdfdQsZbzTATwAZuMGlifImrrPL+Oo0XUokSMqjV2lI+K56VCIuexVXWIePaF4tvVMnyoZIO1gaYMMfHn8/LkdxKzwyv9WH+/378Lk65VJUt/UQPQHC04MsONC3OpRknEkaAO4H9lgeySNiKk/WUx1G9yRw2QMgJT415CardiJulLf3ajn2DxrdD6cwX0GdK100xjwZmtDQx+IvPf+p1QQX4sOOY0BZ/ijwFKccDiRt7MC7/9aAO3tpe57HWtNd+rlyqCZMKtuAUlfUyopcccC2jeUcI5xfMoUvZcRvYUGgfGPBXzB7ZqZ22horF2tq8lYZOr9Ee5kPJc8MEZ8g4jETU7lus+lpgUNMZj8QEIJl4r83FlCzo02lUqjtVYYEZLOGBp1CZWgV+uwtr+sYeO8phwFRqAos+C8TZfAgTBJPm9EMndYKLZw5PjkjehqktilzNxyro26eKoIhNOnoEoAcXNwvufV4UhXK/DMqQcYZAlB4rPesVOAJpBsNBiDxvi5BKoQxH9bo8S75HCrVLKigCY+4adOFKkTHqRWZJVCIaCxD0Woe51CERMpFpZ6ni8svP87L8jQaxSFVYdtFvg0/UtTCMOE7Ej6+eV6SPBwUHy2cZqg4ZzDrN62xXCuH2sd2/QV28CK+shGLog4IlmOR2bezNeL8vNW7inxAAGJcw+MvyjFRFMwn1kyM7FSiClbNzfufHXA+KbPrzPyQS67C8OskogwPwpue2XmvwMkhYsI1gjt6C+S5Uu4BNnexfeNgB6RU2Fmpbu9x34+rwYsZeA+GjCLgEX1jHbIerXpCxxFGvNL31dUY9ONzE9KoUR0ZTa4BrbOmei8KtDcmt5S+72yc+oGn3Ht7QxbJqjwBDhL5wWNafnXi/9BBRDBKCuPs7fJkBy4CcS+yoKetNuktUPZVbcNEu/eJwHntfoSb5Vfen7kLbZLvgMugVuUcHmoH7qe+7+x7OEgsftS3XnwAf0M6XItxdEjUFuNylGLXQO7hlps/NXE71aEG6D1km+j49ELgtGGIzTatjK8bxL7YCNbfMbSRj/ldaXNxTQoe2kDQb6MtL651u0A8ACVP197M9vanEiK8FCiFXKhx9HRY3K0elS5SupLRqVyxG+i3zc6uRL4pVRyAogK7T3DBQsGWIztJv+5KXks6z+zOY9u1V3KNp7QkmEcq0aQfxX9kYUF8/2hqlLbJN3YlMk399oq+4EvmPkr8xzU6LnElnjj1dEQ02GnRZ7brnzk9HClrBaJd5YtfHW3KdbAHYhPADfYNxyYpZTiHRdPgd+0XaRuZZ0LsCFDKHKgqyy9yH1pr4EIVg2bW2ovYCFKxEJ7nqBnHI0LLtXaGclbTHTNBUbIij81UJjjGZ/gn8hKiLyxIXVGRCXp3xg3ig66UatA1bP1ICYqJd78sPxS77hz1ezfEpN4kWFKd9uKHXWnRF6hy5Zg8clAwP/Ozl8YqoxP9XkWKp+ULh1dpOFYMp2xZOMtG+gb32ItV/HNhpMDASm/vTJjZPPGACADtCJr63uslaI9jlALZY3LgaCL/R1UOBwFHmkADhhN/NxRVrHC5lr23C4MFqSS22zqCQsMihvVjBj+y+Pehq7lKQZnfNevRj8LW9fKgsR3FLGvoFrl3UzcrFX/wustpvmGPZ3RaXLcnQzFzifan4ydDEOG3itk7GN8G9aL4+peZbsvUs9XKywhOqMf4r0astHagx7SgDJIRQtByGHDo7rBldb1SpVdTzSnCKKgvKx9xX6uAKIIwRztXGbsHC2yF5pCyrwjPhk12mSys4OGg5ZUNkIAUDhlMC5rIr6KAl0jiqTzmBkJxvq3wnl7s0xOszUEPhmSAVf5gLMIe0yhxZSohax9RQOxcnfIalpvazl5uWg3PYO/BV0QsdzZEv0vBg+j5AN/dgOyDKLGsTH6DXu5Pq7w4NVPKXq0sStI6l2GWWdLRLTd4SCI+NU7VXL4ovNMI9+T0JnmTSPGcblY0bvm5Q0c7gXQD5JRXpwIiS+frULK3HvBFQWMtVtaocBozKc10ayVUQSJegR6rJwUGvnLbmtaxJZMVKTGtxvHs0S9O9GPmoVD/fqXRKqxsjFJ2cWHSYxtWDJlaJ+rygNG0xa0akpNxb5fhDuJv/cOLnQ8rRqbV1T58bODXa2FFKLX+Mt2k5cIbs/LLWdskNRHOcuXd9CnPoonkPKfGTLaVQFmYI9nv9JimKMPMwjgLM06bO7G6pQ6dspFZYtvTIKWCocOubFbRgQOQr27GpNEXqoE4XoRgDxKqvx6zm5/EP1/jWHvzNQqcVge2EyUpV2l012kZyNHPoWd7Dg4Y/384fsuobyaAXE/sWWi5Lk2NGEFXVccTa83AIWzao1Iz+uTRXJts4UVlvrBwVOGdwj9kn6054pwJ+nk2HsG70MQ/pKZHwK5e58x88MCb9xrLPlVVePKmcVys1OCXXtgLqzdxcCWKOtklu1QWfClx/LxAcJvkVS4TPNt0F4i2rAcAXKPQ++8gu4+VZtvTCW4qsHEvlMJTd9R/Dk9Qfuip0ZK6yrtFywWYsbjSvB32ccX8zmeikjbMEjWSJkgbiiDdi/SYQzMJQKj292GtAJV93gFS7Dv/cbcrSgd7kq29DQZG9fj9f6S7VdvJaYqb0fFRk/GrwpHfJLl8JwCoaby4Hiv3wfHCb5XWQ2Dn1hijCPNQF+nLNT133DNInEyS064I2QwC6ylxH6Mfxxg6ZnyhE/PeWjfhRRm0vdy9UkdTUdV3jbw2v6HvlaKx1lsUB4YdIgSXajDbAypBHp++xCcIwxFkrxqKaIaL3FeKLOp0sBUO9ogb1WufS6YCRHp1ahL4v9nN1lbpNHexGbt0jK0ds8jaFdWxikqDH8kLHRR59aaioN5ynXvSvhVPZEqHrnZosViXmdnLxuh5R/ji9AYZfVGJv8KnoJJz0IH8tp6Zsgn+isNQ2lSu/KR/01CGGYV7O9BG2qd/hz+Ng+Guhb4mfiEmcw5RBFnuKTbDclOSlHsU65HtFulZk/cTK71L4YeCkySbZjA4bnrV4fOg3G3mszVjLIDbyhxilEv/vJ7nEXlLDRi7m7gEiM/87gtuDpJezFvcDBUsJZqJDFYSOUyaX6NuJyq8aad3hXekiXh6yDuN1Hc7X0qakZtURJyJ2L+cvmo3kXblOHTdd8SVlZHDwYbCHfleP5Mj2cethez3zlYJuQIFZCgom+34e6o1VdrzEzjJZL+1Pp6Dnolgjp0axwMUT2mKFOd7mv64dMReSaSvkVU+xa1NOlj8UoxV9RC1DumCu51K+CW1zH0JesS83VfY/PPB91W/135EEU8rPxbWyny14Z3E8N+QSSGrxIRaz2zv0A5W1S7GzWYCBw8SKJcO0qCzaJgFLGuGF7AhSWMoVDxFhmAa+uACSwWy5K+sN2UAzG60kOFHSTY/XjxDwobJzyuoeaj0MFHgr5TgqZSZIvF6d9LyQKN5P0/D62U0eE4LCvXSViJZ9zUtGeSdyXc0zV//m68QyDThU802P9gNMtzCRIwUo5bl6D6c7Qgjw8Zrzkxg5nH4cw+yE2GFcIHdFediTOfWa/wZO6NZTqxf7mDW/Om0/4TuxVqLWdSis2l3pO6gt4iVD4i63JH8JaCHcA4oqjvvuGyalxgN7/F7+kVIMSc2+cIPL3rg/le+hw+Zv2JCQocs7OSXyFH3M+dzPRsHHL+9p5qB7rhNZMUGEvid/0QeWDh/LEgoPAiKYON6qJ6y4jX9O1NYfmazzm9rf1LmObqkK4Ig34jwH+h+euT0bjWgmtUW8MPScra7HhJf1m1ilEpIw3KW994GvDgsMPho/VlUW5/5RZyrjP6XxZhxYa25x+UVt2OB8mlYzSgE10lyKIpIneMjK7pG83uT2iFLxpBNDrTyfixrvNoZay3duTDTzZUkp392tLk6GNM4/jmQA2lJdOlo3QY6EaZ4ykYQMbuZTB4CoQ70A1kTnAIWeU6Sc0UNYWYyo5+xXtlN4a+oLJW4AezgkjF8fJfcK0/GOO3m/S26+Lq++m5rt/wK58oMh3GKONINhxgJFWB1iVgvmDiIU5faciHUpvOK/bnZWmVUhMlALfNJwDQyhxlYZHg/75D89SoG6YNHPXzabA+aVCYaxtIAvlO8HJr0QrC+gRNtGEfALlMdSSfqkBLX2LwVqH4B514/MZoc7KaSYN7Too8+TjO4E5tt48Vj0gf6ymKaVjDZtFHxgXCYHoVfpAatYonzzZj6C7kxsEkTGwFidgQbDQS4pcJdwmBzbQLO80KPEunWt9dJgSSRmssodXvZXktBc9MAD3p+viFxCPITL5EeSyMe2FCk+rRlgYu6cWeUCEA2iz73p3XNwYl9KX5KVhh34i77maYsrSdnsGvB9fIl+J2Y1+OqypiS3+qznc+fJBdCxjdp+frgummNyDoQUJq9XcP9gGE7Xw0HyiI+r5M7sj3qctREtJZizQwySOFAq+8HlwrfdSsOGAzVAL2gZ29/u9O7X7fuNMm2Bknv3ZEFC/qLutf6koFDJRv5y5oZS2DUkYYYhX0VS2q7TX5+bmiwQn9pGazqasGSSiGHJKOtEBlwTDMKcK89FVaJjs5h+LU6DWlOFZNaxkg2m2KkGRYsdfH+5dYAN7caRf6oJrrLMI3T2tk4JEsmIRzEusTcD+KeNU9573bdghqvcY/lWUqz6wpUwic/gnzwWdcQifK3jSkDDXb7Rse1TQt0R+1mxRd9JhUY9EXS1F4705eTlR5lyX3Z3b7/8cXe4sKzYg8CH/mLxdcGcoCOayvl2UnHZeS8XnM5f6UwNtYra2wzzZFzitShKhPpWxwII82mgNFO3oWMGNk3F5LH/RZoNegDbko/NVplw4ZtEw9bXrcZw2OjTi86pX4DvRmrcz57Kp7ZE2U+wpCH3JGLNQ2vXQu2PxDCmeX/Q/O2m7CGTyhchY2h9i4mnlfJ7mqhv3d/3OckWD+5zRA+Shn4arqFccSyVgxfcw5uf/rHZvAOFHhxO8P/yUL9fJdqrgi41F+a3+5ZdjCyZx+jYn4K7OPgfNk0J+qZBUC5mpJdeo5xDDOfFKhzVIcGziYo7L1vOh72knU0g6yWQ2N8WYGP6UAt5TP5FXVkyiP+h9haO3ErzwZvH7basIblwZN9NhBtQytJ9DbHDFlNiCquFJQAiw2GM43rbz/3f/G+4CL2sbtRqxyNHmjgNqntmPaencGg1Mr8cx3FH1WITczvxIvuPPv9BOR5Dks7eTnchwoc8u9SINSfY/XLwyUYN/PVDh3E9fIB0Fs5yByuHSFvYTOVIOFQdEwpe/7u7M4PgzX4r/1gHpPbla8RAZuFwrlfoW+cy/8vSi08RUf9UqKG2h8t/u7aNDCSfnTDT4oYyTwP4HoLpfYaZ/C2YYoACbmCmYSHEN6QeMAbnKiGs4yST3BnZKTPpY63JLROO9asW96wHHeiPSqgaAOdJDmRO4ml6po3vJxhCG9OgCq4fV3/MMGkdocIl3DcqaUWFu+vWIl9gsM+As9etbo6RTOQ1oFHCRI6TVU5Vrf/VvUWkLyjxOwvQ31KkEOcCOG5rHxgr8rWVKgv7Cx46/RazCli1tYfH4iVyTF3oK5v50rvVWPwmrhRCY5Yju5bDwS5TJBPqbXRyHFV2QMWpmAR8yi4CJCMqowmlnytX66xTpi+R9FW/uz3kulmwSywhjbitBPCBlhOhBmPihGkeFTYsKEX0GLQV4pZ3+Fw9b/2NwWnHTEwVjHH91C9VAuYyyZlf0UDnRM4S6msKcoC2xdpEQclplxDAwmAEWHz67gQeOEK0wc2uF4aLZw3hk/O4sY5dApRpMneUARYZrKtBOvqWVKjpLVrrrJLIgzoxP6hZG8LDAob9zioQKmPvLuh9B/rPqbsSjm7J+5ktzXxALlyRBPfToxDRa6DcCHJaKT2TTe299L+8ZN+l0U2/fKtdOfybANF31a3R6kAhKMgMufU2BaDLufe63ZVN6aUXuPmPr6mJBKhsf7cTb04jc45w2h1rtFD73K0QWV2a97G+LdH6LtICPEcvKcNfa0aPwAR5CK36JzV1K7vOlYaBHmaVQz4VOZDBRc03PbsZ6legpJYYzYDOX1nOtL3tM3SsKZKXu7aPu6NMsi55kgPXlZeKs3Ki4siE6a2xcnZOn86xw/2IxN2LMqGOTixhX73Hb/uej8tBflLqWcg3+n54zf4zpii/j1IlwZlEXHVYjSgrv3XPQyawpNY11csK+z0Q1xUKan81SWR3nXEL6WGGvAkrBCoSiF2qwnX4M3Xa07AF6B5c6YqBIdyLgSp1ksvBkXeeqrQEq279ovHbyL6iMp8Z/Eryyk+GmvkTjQxAseky0PgBED9Rl1oZ5t1A35je4U7NcMe3Sqg+Vvk+6/PfJVu//repCtqFAZuL88Pkt1wq0XdF4xzlbDhMO0RSmHXbPmKtc81hcljxkGSVm2wHJ6q8GzSH8i4zqx6qlOjwngkm72VPOKm+cWUeJYfdZuKfu6dVjeZ5KgrcvGlB/IpEhdxN7JMCe659n1t0HksJBmPnk7nRlr3YIVXgfTcibmIS0MVQf6yAG2Syl9U41YZ9iruJa3VwsLVNUWtvkH1lX7HqcXnjJHbHOY04L51FYr0n2sIxCwZwY2DKSUxWZWnxn1tTD0aQKoHR+gh3avUnvAA46VcJnu1SAuk3AKzZkuTozNbpnKuxVpfRsZz11zFPJtZrIaHo2Lw5YI9ADk0gpP2E7Epcf0RNcDVKGHrlp3LKk0JPEvJtiQHZ5kmdwius6AWwmsseEMojaAqmkwbEhJSTGSt3qyKF/na1SRJbu8mlHMkpj3VtPV1cMFLGr+ODe43LKupvpkvDMj2kKgYDEKAvNReY5SaV1SD7Tg8utsCFRZevwjtRQEQoDvHJJ8hGxxHPVW4EtJBudvJeQV851RwwhAniihw7OISdmOxal0WszUzUdgEOQzMTpy7VMpF11KmFHcTVPs0Eu0hb/O/AfYUcnwTQ92VUlabvaUgBtdPu/AvwpW6ffkW9AcfpaivncNbtYSqvot1Mu14fl/XGq/PVLTNirA9Z4vgPFu/4wp1g7s5/mcG5gjYDUT3hugykfprciL7u31VAJAiNXv34kZItym59AX8JBJrT3S/RXrmSzL0n7UZcvpgXMPqmHSzWKJffKCZ2HWDb0FgY6Ty9LpPtWQkPwok8yQk32KDlpZkFHMQB4cT8LZ7FkczvzTZVPpNzT7qly36XnpLzkxakz1DP1qrYr1sKEfe/s/UNelS8eamfhxTX6+oMDzPD62nVQqIfUM+99NvNAo3NnNyk5pZy+/uR0UnCboKoy+NbRFO0PacE00XUsHGf02d8yLvS5mG79vMX/mrvfD2tSSn7RhEwq0aDfO5jlUfVsM4n9lLbh+/qs0XACmRa+CCJA8Tb/mbpZ8SFgjCWUv5GaK+OWPX6ftQrKBODhhY/d/uS76lo63cblf1TpQT30P0tfnbZJ8+B4xKXN/gC74mMtdrrw+5bmzM+epoAyZDW9VjnXUAgCtCb64SF1bWCQnAmSH41/rdQ5QM8vHsIBDHU13nb4Z+w7JTPauCRTibFmVw0jnyEDJEQ+QWUpDrMSd/FXIGZf2A8OQLTgJzYaKaUt0XnQPLhCRV1CZpnjW7XVxkBxeU/sDWPiZ+0WtNghVt3FZHJPJx8+r4E8EBlAwDi5GUTNiWUSjbRBA847d6OF1dQEgeoocD6MAsVdumxuWGCOsFDZiR7+eMvsph5QryrrLko0oHotpsz3ZwpHagrO1AsExWq68gOD2dZ64JghYJexDWOvV+AzTrLNcSTqVk019yIuBAwiR96DHsKLw8J81EqPlcnPlcOrsAmh5jS0J940u44wo9x4ljr6eWve7Dmu9kEW/HzvurVBLbkJO7FYnoXf5fwZiX1AM+ns6yQfk/lX5ROw8UjguSWWscCXzAtdtI2PYNI+aexpA0q473ylHq3mtXPtHJ8qXfy3FRgAllR6eCTG8vTRaOx81JKj5gy7qKfp0VsZE2/vBlF3Zpq/uI9nMo/M92Tt2IpYTQnMZCz57LXmq+P5JkXMPqJfbbXrHgqs2Novva3RbZMkFulFyLb5icSzuzk12SpfruV1c943Qs0NgOT9HxZZAOmZvCoFL2Cg+FZtYdbyZoQejEDuxr+xa/gpM4bMflTEtum6pooN+/TEAQJfLb5R64wnCooJN2kvWcqnkG0sIiS4gUUmWhN/Xh2pqbwe0ZIMbruNskrqEhvlHdEax48soKtAwLI+fdXAa73t5r0/xq5Z0tr0nAKqxlI7DYTW3qzRg6464IKA+x+xvKE4/zp7zx+1hPB1nn4v+BJ/bdBgu5sD59qA3Y7wT0qmYvLAd5AGeTyk5XWeU9/qg+HEM5oQ4Zu/iDu3v6PHOouJzQ0flgUd/Fo5p/V7Wr1X9ZqqLPt6EMaRrRs6aI2fvkwqH2831Eo0CW6MrKwSFIFZXNB33Odns+LiieSUclBMt4rZVRJLPCjZZJ0N8ZBBDfsjhi0kZWJ3K5rVIphTRttmR5RGjNAm8vfjq2wLs86nIp4/C/a6JN0WY6HuIKbX5bdkXV4n/KrZWuzhzjydnBUz50hW52GZjWtfjDD9ix7pwXMFiFs4IiDF15NrTM+bmwCOPKDTz6M6bHBl4qoCgnqgcBKPkZAcuyQxW81NV/yZwef5QfI5XkNzd20dtq+V8UX/w581AfJISTwutGzfx5bpolA8KhhLsBbAkUzYvFgs/kOJqKMsAYIJBknc2fRjl3TM9zWYIDihvKOqfxWHaOOnYKMl80U+tanI+0HlXHdsewQ99FmFdeEEDE7lsMSnTm21mgc6iks5os/0QTcC9/SX8NcD1M2yIJXqio6hvbVb3cVmc+K+RBcjTb4uO7YUlZb/Y4oNvKK82PiNQuiKj2dZOTgJjPKPt7dAXRRFhBlBGYQ2etkHvSoteIWdHdB0vZrMnEJMb5lH1wcuvOS398ia93RwYEIC1vA4b15TwuP7Vzlr9Gymh6t1MTks2VG37nLNF0usbCU+Nrb/TS5PPZ9jDlfQGVpOATRLzzgBxQtMBDm9Zb79tejkNz8pwRMv03Xnq5ArWC743THZKNobFnX4gn5B9NZ/o8M4jpT8rxQp9BhLVnG7owLOvDtnEZ2/LmB4ulTp7D7raccfJs/R+7Uo+stJUc1ngRK1ZSNIGsMi92TLQPnbmlvIrVrLyp/0cK9jAmdpaAtD/10hvc9S89j907rblr0Cr12Ujy0MvQtNEiMReL6pU9MNdbk4CpVaF6sSob72nRoUeaVVXkIm8K1dQWWkkbLtHOLtcWi5I1qIXoGIL//UHE3No7lK+4WTC9Ys9trbys75viGIciJAJfVDXpT2j34XJSsG3qv9x+OMNqvI2+1eK7Y1BPMd37BUmwycCMetwLBsVp+0rQUwH8tvIPs4g7KlgMWhsRlZJQ++NGFZtBX+tFeTDJe5JX0aTi3xIbmX96FvkqliAm2VpDPOiOtLrVPYb9TUB1ojFZW7r8wqHo/yXdMNeWn1vG6XPqj+A/6mP4f4tiEFOTnGunBKH2dWAl6NXYZiE3+7DWwhG56s2rC2kx/L+DAmC6mdv5YWt+ZTpZjoubfP4kFk6zAqlxq5204cuCEBfzVKNc28nsJ01eCB2cs2JLetbTE32EvdoGGDuVDWrWkgHj4OvAoE+JFArHCS36NAlNczqX7ZmVzBThhOy/X7Ghz/qKA3sY4NkCEu+Vx2DZn2IQ5qHdrJuTPAj30sKXEAcl3XvP7TdMF+ZSQFaUeGAEY5osj6xx2emUSG86r7XoHLd4B//g+RR8OOJ0G/jtqYR1BbiYsQ3Zcap8WRJLPjN7uxBoZsAnHLjgw66xVjr0SL+2NRrEmYDxC6Zv0SrGL69jUxLMQgGlkDd4RBaouBvvDvxpjWKYi2eHkL0Nc2ZsWr7LVLLVsaEO61TQcjFlLEjEp69k2RD8yOMD/Tht6wOCab5pAEDiN/ZFeubsBkrQfW5rjft3q2nvjwAFDBakzDGWCrlXgEY1At0OgcSfks+YUnXsW+LeLX7atVJLzAchmjLzM34yo7+aUf8qfvEtTgBpl6i62U6EJWzRfKHlNVOOk4froAflv3eLiYTE593uXEhasertJ6ThNhY7FQNjACGoeO6VcEhJ+hH3GFJsCBhXA48kJ2u0mBSKH86VtBERTL16aTY99DGmRww3Qjq4znriN7AAotjmC4y+VLagSCACZ/1gHNawmoLlavw14R4O/LK5rc3sFJSOgkt9l/yM7OxNcvsQvoIYS+avEjIdn7H6IcUCxm537r2F7pQCGnaEqKnJJ3AYnNy46Rm2g6lmFN0Pa8L6NBjZItliicYrqzvstmvvNqLXopGjhWxjG+aj1bBDjEXj/2nLX3Jl6N0oMDqRGvGr+UyBRSney4MpQY8cI8cHm/5ogDC+SHytVpZwANCHUvut5Gsdw+WD0OJsidc0rVEO9KQRnOebxVguZ5/VDPoA4Onn0avOskc6tUlsFHxRt0IvW+8RDim8ojTq0CR3N/oXziSa7HxcHR62U0AeUfpB9Ufv/KZfx+urpTQSHHf+7b00nrrNs9omDOWQvEz3vYTTUJAFdPK7LDBB8rl1d2ugMtD4Mhj0bOL85HhWc45v9jZympCXhd4DzK9bWHMqCOP4jkvPhmvdmvvv4mY98Ry2RzBfVHWueAhB4qcBM9TJZUwf5M1TiOOcrz3Pw1m8pBqxbYXKLeJNH9VRuMCsQJtXid2ebjLaxs0sIdTF65MuFyLnmc8PnbJVaNarWxkdhxim0mhdI1ECiJkeLuhMxX9popEn+5l4udUWVrlnHER50viOxI0Ol2QxRRS9jTiQhA114U89jXogAsVBB8wDkLpDT26rwk/hMl2lt5J9BxHDsoQ/vGcJM/Rx1AN9o8Jp6VfjkAtWVU2Gat1g0iNRZ3VcJOkmz0FL9XnmlxSji6abpFnoGT3sctzB9tYESZQ+saKhhA2ameUL9TZYMNk3Jq94Juep/DVFgsGivT/mE2ASFeQO+gGFTFucKqh2bMLuSJf3cXBqfqZIsdylfjug1po1vOug4t62F1PgokG0ig6r/FWl977q9mcXoWK1N47ft0+Mkq+fFt2qqbsEdH58fCCseNKJRO48KJCA3Ny0NQ7/079wQ6MdKTgz9tTnG00+bdxA68Nbh0fBWM0xs+jihjpi6CQybofJRb6owRmJc/S4Jbtb4N0/gNf8q/VImOD8GISLRrp7MDzzv3EE791rtEG3ebkpfnonx1xJneA9F1hETA7ddY1FG+aMTmnUY+JJ6o0eCG4kgeVq1MXRGRERdfhIZNiq0e6AjZGMInRNY3agXdBZt5sldR0O97Yyu7fbttprUQDQVoBBr9mc8P9VbzlP+yzR3+gUFr97N2vFP0QSZv8cDHu9NI5m3EnSZcEoGLMC5dyMsvwAzcGAsD0azEjPHuZNRMvserj5jAB/OOaQmxio7kZfP2dl1aapAIYXxCrG7KDfxhGORvYRIOrfi/vuuSdMfqwcyJkYfaG9VoeXAaK8vwlOEpNof4/gGu79Sjb0m58nNJ+tl5OTL0WDNZD8ypXagZzqlhDzhLsudrMmY7ZJmjwVy0fLYeqb0K7OSGvEkHDa4gkFPUCR1ilXHxH5JI7A93aOmHj3eMCIVnLhQpW//3K/nME5KTEo2v+m1BZKH/CrYTGczbDCN1evIfgEeoUuMyhppSZHADp6+4DMm7ZzNCHQ3qDEHyS1/KnVr2yZ2Ws+Kc/QBNaJBIFCMjSPtMLUKF9VEznqUYPaCKsam8xRCIZlOJ99wEAshQL96AAcBzjMuVZGlQy/KBnx7hWmRBLs9T+723iBYGZc791fAAoMGfTPci9eDU7KQGyw/ljDX+JnGq9pxTH245woHq9/enCD+nZ8qvZDHYmUv9+9jFejqltV8x9jm6UNe+FwTTgAxOV7+QbyZFdO0m/x0sq7trIIr396IOlAhAq0ki8c/W/Rkao5TuWIQItL8s8HJW37nFCl9smIOEiXSDfOZZUOUlst0xIyfBEMdqKBDoGhhmSxwbz+KJBUfyOOq/UrqPrdBnClFjDhNfZvadE+wwRH8sWKnoZ/4/eNNeHQGUTigXm3yeJ+KxWET4BXlPv8gKYQ7YIh+eKejoaPIrB3/9UDBGNzLWaVsKjX+viDyhbN5CHZsaFv6SbsapMZ8lLGxECPUKHuS35UL1hl8d2FKQ4GhbvNlxmXptgTKk8S4jG2JOEcCQfDoJnIoewdUOI0L729zIJ9bvsSDqxibQbQycnITyUkbC43tu9xbrRw7qT+/19JYWYjfThir+U9wb0BUQp1alT0n9VhsrW2F2uCAvHUf8qW/6FUC5wbwNJzE/sGoTZ2TgkO42/5u32dQqQwMsZlX2YJW+51ntPHzt2CJU5oAGPPaX67OIwwhvn33H8bhb6l6cW94VyPETSWi+hVjq1xTzaJvvbQ2eVt+zjK2izOZN0I5z3cyET4mmw7GGWXewiwBCTpYJzG1b4Wud34C2PKbQhtYaLHOEEJn7ogeipmbBxhcwLVvbk39sk+dNheDkAbcwX6jQxWmI2iRVTI8Hdm/8l3vsKbPgQ+SNkHVE8CRvJ3LQuycnpL7W9y/+XzG2XxGmuVVhHT1mUorUrz8rRrFYYKH5i9vOFVo/35ha6rPpDRJ5yRRFmj7nlPsAFT/IUQIcl2W/E/Dfk2Mj+jVlgCDCxDjb785tRHLlJX67bkm7eLPlne4GLrJpYy1uQ+pqPy0tigNqTD+x74RNdUybL7WBIB+P6NkzFO3qk+oiNxrLOV0QpEBZbYERdaBAsqP1/6j5joEgIlmM06m1DmrepJ3CVpgfGVKGTiULsbt6ZbgmRdy8CsEVQ4OhqD3h8lXzJNvXwpegtzyVTPlXEqPexB3hLDIgMrdxNb742XdxZBL2F7BWOqMXpxLOGWsh3k2lB0wLzdraqaeDxlwdNamBlUfZUCL2cg6D8hGYuyKvHXPFdvsXfzVxLdxBs+mmynvkcitEexROz/drrcmO0zL8adkw9utUiR0WzA1oY9TG7zRb7tKLQtDnn0NXNVEg3ZICL/suHhy7sbr0/Hic4spic3NhR7lmGDxGD/eAFu/WuONIepWxzCc0pZYBOoX/98ZhwH98cdh0UNoMuyuJ2Wqsmn8jhDlXVt5N47L06oz70E4PXW4mxvrDBArGSbleFbEZn5zh5hYHkNoIrwH6Z8o5vdk3SHTUxgUuKa9lD3lquOEppv8cj4xzcLlOXHpwc+BE2qnyGOwCKcxAyapXtCVIg89KQp7XY3AKEUW1JkeLTmwsqEugQ+hSFltxg+SzUKNokCo9Gx5hRts6DWYOnOxIU0nZnDqXmQ/ce1wn6pXLzvR9EZL2CxzXg66w5zSSUGkSB4/8Xc9ToF/evezMMufZeOav6+negXUjeQ7X8v+O/nZXnB7gc6YiZU+2vQeB/cmtkYhzBqjQiMtJZm29x2e6w8Wlfx81wisWh5ONocIOKXjKwtpam+YzE0CrN/H/cIjQbp42cCxJ+4gUrIQ7AQV4DR0Za7WoZXT2ZxOYJNenbplgKdwX6+iPve8IB9ccbubqf8MVta8w2mgKZwFHMn0RCzQUPkKUTyxk8L5oWWehVuYZ0h/XvryZDNvxuTipFmq15aX0hxb63zUraoEAKaM5z2qsFoydXBVKl7kC6uZe9Ku6DZgNzDbKRpXvNYB42O7enXcyrD2Z3MiLaLIY7C/h9+XzUckv2hCt53HEUkpgPbXEM/l54hLWQ/TwMYrjMQya1w7+zWkxqNjIEjd0X2ZfzHBG7JBsUPHoShp+QwZNXKeTp/IhCm5ToSr9SWpivMVDJQDj/qpDvpMtTav7Hvl64OOuU4t2EGGhNXnuhvyIumF+Pt8JHmCvbjIWXd+N64gWmCdu8/elel9rIUHssP3yaUeqtaxn3RJiky8DTlOOeB+cmtDdu0+hJXfLh4o3rn9YvNnG7QOFqP2bvpnbzOVt+vQKpBuNMHBos6dpYsKxkzld3mj0rPY3u/prMTr0tjKNAdpXRoxuIUQuPsogG0heEQZZdm4ScaZ8paV2bEWRMmiCVv2971ioO9UFJ+i1ZzN3uF/+6/R8daanlLt6nFyouDl5GNXT2YvyTGUr79tGrlx8LyNx0uL6wOz9CsqQUke9Fp9Elb9oxwiLbAYhTjXQ/j30fgkwV2PNb3ucrV3/zyhKr0kCoXiX10FtZBBa+wPAgYeVtkoWHueo8ldAi5rHUoasrL0xvAuTwuFocIzMZXjbkbZuoPVpCAiDTl1d9S4x2wcTxdagin4LaXazB17RQDOgE6sQvz+G64yfKrONxZ1H56jpnQTUvBycdnrfd/MbXMSH4gm7+tXJqv+9wnit0ez3BN0vxFI6nKnKAP+/X4rmQHB5PB+jZfw7LbeCFpEjU6dQEJIt0On0pMAAQ9WQWOoHWsHGNtR4OipWoYXEt4w11MgXlTGhKlpCOntDzAdjf1tgNpwwp+2lVvzOb1yWX159JZKBh1KPPQ7neKeSLefzj0JO15+ttnWoOd80x5fNc8XaY14bS4AJgyDuPkiyDZeaKq4ly7qrHRrX43SLgaWT7HQWIBst/hz+1stEZ7MQrRUh4n0bI5ebKc4NWOCRsPVEOASb5ZkER3v8TSaCJXEopbchyNigqpJCY0cT25tTFbtf0TaKx0i128s/QD7I7wWrB4US4t8FCR2u70rKKj9CZw9Iyxbw1UMZo6EAMQ7bt8L/VBXD5HJVBH9FWQiJsBIVK4ULnxcD+kPBBQjO7DKspssAaNaXSZEKKue4AQM3vSeNoTXKNXPeK3Dxsz4tulE06qYgke5AQVjdnGt3EKImQSZbNDA83UKrZ+pyJU+6viCHTEi2+gdVT9UBZMNSJ7i30ni+m9RzRZXKKzzp6JrqWbCapPhs+aoHP6mDWIsmrz5FDNw2Zf7QJ7mKkTc4ac/h1k9UKod+vFePTdmn2LE4uEMAMqN0Lkk8MbMS93045rqYXA2bR1BiasZhk8a2S0E1GlLIyb++eDs3F/Wfsy31qixV+g1S5VNpyzoVd1ci6FmuBhmP/gmqGDBssgqExeHmEUvJA1zsCD5L8RSQmR3CxITCyp25hTLSjDJiYYo7bw6rANRWY87eLCqaDLDq0FN5Ow0ZNdwvwragfunU4yBuu+QmzTJyDUuea5GtBqDnjOQGGCIc3rdu9v4oVuBZ80OmGXGTpr+NpF0G2YHJ6AZHaijRFGa9fIOsb1wJXyALWRfkfWrkSF/7vFxzjXbFpgTPzIIqDvKdwkqM7ApspMTIVr7uMriryOPOdMYGD8rU4z1nZE1X7JRlPcCO/vMlHCsazFBb5ao5TJ7fMCjIiEWRsTncAUVS2hbU6KGKlxwgRROsS9mq7cCN8g26iwB7sjFMQz/hoyRgwWu9uwx2zudNvpPA2JbjGSZpET+J6w2jcRXrF/ZwHvgqFEuL8zXXbDe+cXXEQDKrwW6aKWjxYbf4wekecGUlJ451iD+lCutXQm0Ffn/h0jDFjIu8wK+MNqRO9KaZh1RAJzxwjwZgfSDDLQ/xdoi5MKL3kLH+NO9kwJvg+WduQGitPZEL5FlVfKLkqHujdpAk7lG/aAhKpofYpGrD2miInKDLpz1rwJKwhJrq8UF+fAfg8WgBNjwff818KwzA2CP8MScfQWTWwgM4WbkpOyUZYwzipbPEwllI3z7+tZyXE9sNMTc6oc6X4ObXQzaiCSR0s80WSy8LBgkdiR9yKn7uAMi2HxQgKJ0HWxYpg7y2J1lkz5OStdianSrmblBBdzPPyGqhP9eHmQiux9IRqVdLl64s7Z+ppp5kRQwdb/BfxdqJ/P/VwzU/d6KDPVXnRZst40hV6gJ5JuV4kmwenXw0dx9NYICvycrhZhmJ7CtSMx7wbUGx/p07HhuKOEU/JIs4+diRqJoq8a1BgLjLt3/TSVwTTQxL3XVcPh79dx9pk/O20G7Max1gwYybIPr5aY5CnduhvcYDaPwMrVWv6D0QoZDgH6iGcizT6dzT19JL1jDuHbf0vl4EysPiftaDIQ0sLwbRLSycfU6p9D8BsileyFMpg7QJLtFH3KjO8037MpP/wtldLDG0h/c1n+Yr6Hv4hG40x2llrQtS82GC6WUcY2uPa44tOptT7zZfr+z+92G/v9iYacmztkePCOU61zvBNI+nS7yuY4izkJS+fqpyYfDeWCs+mWNoRSuFceaHhDr0405+rCYmJeCl0Mnaur5wxa6cGDSyOc7hXWKmMrYoQOYLe33wl4wtx7khAG55tf1+lCvlTan4rRuFcQ/zxfwjVl+YwNcmyAMo5AQir6vVaxLVxqEgw/wz3IXxjMyzNgBtUh8C3XsN1j7iB9xeoSewKWAAkF3Wb3GDKKjVUs5hAwgcWceOviuxvURbYcceN2cVGGpKHnQMrPnYNc/WLTVvJuHHEvtajmBVzHy+yd4q4wopJr9KQus2orJjnio3foZM7CUo7d0jOvL2q5rp0qCwjXIEP4gedajTbCI8xBeVjEaomDYj+vRYrfQ5sQzbNXbPhxc6i18VApQQr0LvJSmmbxZDLykEEC4Z7n0C7PZzW5ykJH9BwpfSXyXrYA0Sl72kyYasckZdAMa9zkTtZg++jaoweTeyWQOO8+ULBfzFdsXR4778tU6St8yOAyrQfw/59N6xN1hBSaF9BVM+Q17tHZNOZGYu30w/48rmf/62zk5lJHEW4VZgItFAnmrZ3GymWIolb//Z462yIH55Y9vqgHqM8A8tFeLK5L5tfH14zcC6AbXB8/zwlXFDJ946UdIjJZTFv4LmimkJt98nb+ctIiYtuleB98Df3lD9SOciU3rxoOnWz4auKtHTeZggQ7uOg2Gi8TU0H5Z7+c4HCvjE4tJ5NAmIgWeH/5eCdFaD37Flt4/zQCahgju9/bnwYUz2/5Gy5ql/7OPJF5if+bwQcRJNiC1V+oCwMTsyShj77rIzS6/cfkmteCbd3r7wsZzcYfwwxr09/NPQx60o9w2zs+DjUty8oVKi+Igk9Xk4KC+njHD8EWHiW/Wb85bvYTQdKqJOvCTl1hxAdo8U/AlOQf5sVTbf7X5t3WSLMu6fMWHTWGI5Wh/txDQqqKyx/DzEcQuLHUnQCPVtl6RkKlRgvXCklh2ivKWEr0+PF8xfOPcjUj46HGyvze8K4H19YjA3f/+g0YtLGg/YyHEYEljlL/oTa8AV8KwuWwEilYfCl73rcjBR7bmKSb5qLPnSked96iJszkeDF1lhRFQuUqWQrzFR8Vrw+tKHXUVnYyTA7z7mkLoJXgkNI2BdXHrN3jRamTKbVSQ7G9KDqU6mmqCg9d4yQbsMI3u220l5aydxpdV0SFEWnNcaqpMZ9+OJtk4iMdYdYyQBSI6osshncJ/zqh5UHyLMz1bItj4JJ4zG8Xm+KLqeARAPhJ3jwFAr+SiMRm+jWP7v6POtDcsp2XzlHRuMf8BwkTBFrUtEzy1Qlj7VMZ9eVIAYdTO05qEa2FwSWHyp0G/y3S9CGEqW9Xogt/MwGy0EUWoUBbZDmmApMCAOVlaUAU/5TEN/Ug+0JKx70haXz9as33DmjfDXJb51d2nFfI5L6KpBnlUGgaMGvm2Iai1EeqAHdPXUZoUIT/II3Jen7e9wIZlrDXhogJQQjiqdQf8LwKmRWMD0Q6T7w6WC8YAyq3bnq1RXeLUZqp9paDQmCIqpbSxf+vT2Zjf/B1oem2RapjT38LkZYZvTda6/mbRlJPUZNupMi2D+0n9XS/oqGKRJLv6cWqxLckJz0V2+uTbQuWzzvjEgtvEFuPbijXFVBDJea6ikLVU6bcRUg2lfMi38r7YjFZW+3P+QaN3rmQtK6hW1qr2X0T3InH3nlsIf+vsN7gyqYrT4+n57H618VulMTXKSwOyaP+ij6mckqyP8QIniWmiXgJLgvsso8kIHk2tVxxsGfBY35iaxKWxRUb2CuM4PaKtb0g5KrhxEMOQYTGdaJlAk+ikfJXgy+poNJry9U3uIQ/WvzBE1UUMAqk/tJXb88TxIR8RywWpkqEySEDhuFQbJNQj6uJaHrfvjsY2WzkSFje8xVEwesxHTBLdWJJC070lKNqPN152foth9P1tMtD8OQ2vPyypBHBcZQR18X+hcO6n+AcKdxN18ZYU0F71QgPyL2YXc/bKrj2VLyhhaXLwlDeb3y47iL1ZvV0VJIyZXYA64ffFAxYNEbuWdlxckB3eprwgo+4I1iWQGoXU9IuVG7Vnch2bbbonVdixVs8UHGu2qRNYAe+rKOghbjIfigd1Quycdo+u01c3jQv/aD9vmnTEBKkjbNeWGvPkPsacRfbFDW4HvlXrZSgvENgeJI8EWe6a2K31IjyyfzuedqyG41sDVOUo/EUi/1yCiUpPXpVgB+cVRgBbXtAVDVxVpcjVUgNyuBLg2xn/P3DNwNrsPTlVsFbDQIp+raXNxJy2CTp3Lm1Nea1dl9o3SXQKQdkMl1TSJIT2KeuvrzubTZ0tpc1ct2Z3PMnWyiLXv8Et4Cb1NFtoi3LKR+5Qm5Xp0WPZBahSHDON81aFASFImWezrpPt0UAgbKYSMDbaYHFnsvVpllw1bvIVcWPsBRhK/NJlpcQw8l0iNhD4wPLfbTRNiOS2kUhHWKDz52ShVZpm6ZwGkako/7YeZHxGTYl0ibLfWdQ725nwn0QN3IToNcJ9qbtGFaMEg2LCmorodpRctIvmrwk1v/2yr6/vIllj2G8nGICByXVYXhishBtzNeEBl9YZaTMeuFPRlLH233sYKrPP6rP/uD/zSvw0CxiE7SO1o78WRpNgh/8lqHF/Tm7vQg9nmH0t+FqFtxJqzwcp6c1Q0hEX8R4xGk2pUJuBc7PpUmckeZpvE3wi8w1V0yw6Ox+AuR88ZRMrvVkYy5P/poWxNPMWxKBiT6cflfM1Q2lZUMoZomZ5YEhPlOwxNF2w8QwMdwc935y1iywdS+WRucR8t4NGu+z1U8viMWwj6Pvtvi5YeYf34yooApOO+zzzqHUq9m7tq1YY+7bxMBOEB1Au6hfRp0E9JHLfdDXTjNlDbzG5wV2htlPQCfhjSwA1peLWwRPx60Q/H9RnZt3xlVYiN/ECRH0x/XPkeLmRGLphjTcIPnnw+PKAs4ZNesLmkQNqytDcFVdT+k19cvx+E+UTMgXCVPMNKbs5o8PPlLv6nkC/h+9mvNf/yUV92tvcMM32nWVlKignIxHU/bOP2OeEgagtXSsmsGWFxT4rBDHJX9CnYPWns/082woW+S06Q7Vq1pCTzlFPltJJwxbCVVz+TqqbOfJAbAkMFRYeoYQHJa7Fuaudey80ci7q1yHnEbRl6GZOylfRsLMa/U99JRtAn7GEIllLIhgE3z9C4rQg4MAxCXYCbeI0IB3LPRXRwdEZ95a3aYMYegJXgSf/sY0EbYeMu/qNsZ1bbciMbob/x8uj/5v7ZvY8mpdXjSM3Rkxb1BW4hx/El/KmAsbZkOBGn13KpVpd6CG+jy3TnltB7gmGQaKqqUFQEX02ZNxtQEL1m/TnxPoLuJ6Af3AGhk0+rRcCZ/SSX9zQ9ydReUT0aYIsZ+AEdzaaHF6gWmS3CPNvRClGB8T9DU7SyNYlzT+3MwDCQre1+KlJwhJrLHIi6l+yuQMe0MONanG9uo9t01d7MQ/KbvGXFPs1pQ6VRtpkleQiSmw8uSpxZ8hlKYT3ftP1bmxL/3qRGdyoQMo6MCUy+mbA+OujOMlKoGYGZmy4DkSNhKZ0b5N0scbwIzcNeP1SG7Uk9e+RYtV/NdOWvumorgaCBEWxDoR8jgnGi/mMUVOdfTGtGYWnW/aFJuLL9Mh/GsTK0T81IGXcwEnChF2FIrARDVLykvvwkWJO4DLvCoIpi8UpbHPpKFMNKDozt7+7fAAchAFvzvsNhHetUsSoxSDyQPZOLLBeIBdBwsrDbAsiJ71oC3IiFZLkqUgm74qJL40nHruKRcs+8r1b110ncsPQmbmzFrbCA7i8YLiUjcHH3nPrXAivYJDjhirfa7L196XC00fHbo1tHBJLzT4LobfYSgyBTZ5W+uN7d/Vd1GhI8Wt6KL+hlSXj9Ks3P6JRcgaKBtipMiKeJTgKSdDx1SJml5AW+YEwOPiZjC0KNrprUzqJw7iJB/mpl2RRjivGuonghHYv7K8g8B9bkcWRzWMjD99ekks22sIasCMYiTwJ6E1cBehzahWPPOqXcigynpqOn6c0aL/bt36FRTMt3c5j3s4QK/KSp0guEdcODsqmLQ0v26UkQAIgBgrdqODlCjMICCUSff4CZ1dyizox+Xys9wsdszWyLoZCCHt4i5Gme2eCeAbfKkE7k7BYeSNoerxyKxPuWj770xbTzxfid54DxHzdzgktfzDJXWX7iU1HSgLZRaAmfThUyL/Ny1E97uQDfNbMdXNdtIn8+wm9jhAADOQI7gaKm8FhoSfFqBxz/YOjR+BWL4Se9ChNnCZODDEabwbB1BlyD5FzwUnXfZqhgaCVNoMJ794gyMjbN2pwc6m+fWgb0wysWd7ayQE0oodPmORaKab49Kxy88AQidXQL0GVqEYjxv9e409g3a74Rk5kZ1ylQOfTUfwh0liOq6KgUMTvbzDF3DCzS1kLsprA8pgdNPySWcS6bxapsztRkQ2qyFjnUv9uSF/GJmQ7/aACXxpE2Lb8JSwariUJhuLk+3CWXzYFDe8jZm1K1fsfWviCHyvVs+SVp9B++dmOK5k4BS5HcxYscDJd3YLsXwsZjGHsxM2VqcpMJVlvpwDyeaPw51oSvvjldpkXvWqW/OZTtVAyTIlmzNU+SCznWFiur0VQmWRjbZbrB+3nMmiqYNnkgBjxoR2SDMbyKUp3YWiMAcVW+QGWtYzmOztII/XyUNEf03bSrG6bVpaUb7zDNXuisiKyv/Fz95D7b9ME9UjMQjoR//cHC0Ptyv4dnVakQXojezNC4IpIKrosLbLQryBmZniEWRz+T8xLBs5qbGjcTf0Kme8tXLk4zMJTm0upR559MpdPUKI5vaH9W6GEfRBt7QIa/M6oen12zdtE1Vuvf7tV2HGdN2P2qOq7nZDymIeQSoB4wlZrS7ioZ7jOVyuXKXQyDgkBZu8WG3YGb0qBFLlfrrzUm6nHQbPHLGJrjrOrxjKm+WV8b4p9hg+ruFm+Wi7W206aNg/Kr4VVwQEs5KZabMo5421d6i4kavd0PtiY6ulqiru6uU5e21TGtfvNZy8LFaSL1yKbFDDOf/H41tjrPDmg5HbrkK+NDU2jviRLO4KHuZtaC33tc9JkM/CIjg86o7PBzMiBhRHZv0iaiEeM5TOyb9fjUoEdTJ2AQdd+rsW6ethfn5EmHgzVH+nk6VwdhHizBzBXKzFPA1AJ/r0rp6NtYFOuuyucGMoBHrSiHeh0NN1c3NGUz+eIPMqrHJNwtxRn2D9GW1PzCvc882O1nyL+77wPtKH+HUqEZmPz7FU+cDoGuco3w1kyTE52NahBEvBs6+hmqTBT0x5ra30mW/4dGR8neJZjA0FVi4aX11cxrlWdS+6/g7KlGpT9aoy9RTWloHnLTHSiVpgrXSOFqxqVwKrpDyO9QsJbL3ezqkRQ+eoep8ymNDWIdVCTZR6pqJgNREvWR8XJdTlQd5tB/dy2ibsneb9YuicMhzwEUd5fkJPEHsXJXs0RP7IhJKm0xCeCA1GHkNzr+k75fmGIdk1dZLsQXfRywCQxD0JrBpOhMGz7H0HZet/5YiPS18OZYJTkj7qSo5ecKum0dq2alRMOFRVrsKChPUXVCGOnlbCJM8yHwfU3LvITkKUxkHkzthdLUKIQz/dmK/HAIz5zbOQ9Q1PxLt2BLSJ7lwFKYxCD1JYGUNDBcjwO5g070BmuwFCt//5hgoXgMWymwGahyCnWHYwya+B9inDu5ONQsRx7mUxez8h8RHKqPlaZSkexuIylCSWORCtpxkLmvsaHzdpkwb2rAV6RFybUtcIw2FShTzkMD8/JomopwRwTOgg1LMPu/76aLEqXof8VgX/mbCXoUO7cqVq1eROV+H0ImLXW99m//xoT9f0A3y9bEKh0KsaAg6FJ8UyhMB4/k+X5XvgsiBanxQR28x4jmLrtjcUKBwJMDdgS+O5i8yYDioQAA7gtyKv5AQqtaljpJ+261Jv5VeRr/dfKuOYCmgZUVl+/rbv7Qy8cf0ZQAh/BQSnVLk8E5xkbI9kZhJAJHTSIicgTeNJnK724gmrP/+8C2TtHu2mM4a/ekFoc1hjoqRGadEfVtcGmOLTn2r053R7uRIZMS6QEYZ0rORor3E2jI3SkqWkTPz2IfmYUKWtiG0tz5NsjInj9p+qSUbIUrld6JkLpCPClMc9J9qiqNzQKsHA4fDSc2be/XKcNlk7GrvTuSc0lZhaHXrMWn/XaDHTBL51X0D+sTxCJrTDwnY69NWmmBSvMNcsr+OONIuWzhGgMwUKR8rZqwIIbediqCWtSL9UU8FuuStDj9vOTMvUJHVkpr0NFQhdpqJp+bqh/1hlIAan5KCXqWEQyTjfFw3B9RbO0oW/X6l30/UUcBdSS5muDcPVjF27Rzy/+TZPB6tABsbvLPyOSmJlmYuw1iVv/gdnxWl+r4wdU+q7KBM38i9gNaQjnJmPnkvaoZuRLJ2nRWJwzj5Kr0aHnGp9rKyxtJ7cIahLoB1SHfd8PCXtJ5XdYExc3cTHKwVf4l60mWUcD45IIk4A5XqdeFVGfkeoxjxJhWARpfuFR9omyaQETnXcg2f2CSSFR3uUU0OLQrSjD/W8DPZST5/08UzruHj5hCYnZ8HuPojt/dLUYK6r/qdtJW41ihP4SAmlPg0ZL6QzzU/4pgTB40ebrCpXDKHUI4hv/bDNBytXxRLlT244j6v1g4dD0hByPzgTHJt6CaHlV0jqe6JDu8Pc35JQk5/tF3gpq8X9qDH28wE1acwHfB68GJ4G5/p3mtBTe4sytcq93bgp+VLa7xae29X2lpkfTwbeMBq6bJoi1iG/sufyPPpQtnHmOBGG4c0mOtsakZzm9NeR6Wod3WcnN93p4vLcDeKiwY8ZLRBnXxKKunCAytm51mwJqzwLiDKZlwfiwpXFMs7E0mnXs50Ay66zvft4RuRsa1lK/X0MSvIO9ATQhsmgQR51+MbrH4jyCGqftmGj/1a3jPdTYM2ZWnS87omlquBQd7BXqsXKqQFl0DnWbto8ARdd4m6MpGZkLhT3N6tWi2sSDWLyiwlLqtK7U5FIycGO8gwIQxTh9D6KLzYBjapjLi7bzW0bYHLlyOoID5K44uoEyDPIOqaLrjc9D4wvOFNMQP7zdvtw1aQlaRnoLwfxySjX4iVwqG2SW/yS0FhGTXYG53r26f8m6udyLtDrGPeiiUPtaFIW+11shPbRhl3dhFYk17UMzA2hjcsPWsZero7BA4A1MSvZ2gbe5dbsEN/FC2d9ogdDtQ3Zc2MsBFLo0DVkjTAgZoZr/2lqxH0ORU2XRV8A1E+PvH2EhDDhSZshZ/mhAHgwbUUNAa26jinY5ydltHT8CE7viJjDKaB3sOk346nEk3WMFE7rPF3eXkxe/iOCpzyjCsFaaBQ/zxzTAXzKuQPJLhSuUKjc5m+6IvATZ7A9rbgW16r95FD+NTACWwtyJC0cCjbYj3SU2Y/XXOp29FRhqs3Ywq6clg0LYIgNEMcYUQbCEvHcez/fOrCtupiDf2VTzHmDnEfAZytDi/LeYkEOxDyS79b8j6zhQ0YiubFhdQgCVz65bcd8p3/TZ1YdsnMH0ClXY+lhDSwKAF15Au7BlWiXSbQ4dbSvILYKlHWrG8NJ2LYD4xQCXWAji7LeBeAt5SZv4IKZKVpaqkoBd2+hRBoGUf6wO7r7FneLCHnc7u7wAJqrKwE30bEZCCizJ7ZlhAKpbLWB+OtP/lCSu4AmXC9gcY6C1HtbwkSgVEi/Z32D+vFC0OGU9zhCWULn4KtNDAISh4PWHuG3ricvgFUKx2ZIIiKXUChH/gSKtvvK1s7ghwG4PV505KBCGznrTGiuml55o3tJq6oLLhXFjPzC0IKc3oKIkgouOWBpLTeG2JAu/UOJxw09GzC4m6kMQLOCLZImK8ZV4a1XIRyUbyNlXz8Q8Dt40J5OKSYLpqNfnbIWs8ig4WFt3dGMJcASFA4eCI7BKWsAs05gbCVOo+K6OKS36CiL4CED+4TQ+/Vg9X/PvZUDAiSUIUT4j5/aJuLdF3EQprew67vrWHhltnR72xnXYtVPLILFTbTcspcTACrHepOBQYYhueZz2Er9yeDL92URboBR5AUDTImH4r9vLhBiNL+F3BP2K7XbSgVfRATpOHi3sQ7zCW9uJYuGvg7VZEfxyJElgwV1hPWPn9iedFQJZu0u/ejWk72/+dzakiz5FJGpooOetweMLvu/REoUguWVJspL/haLgroG1Z1VJizpVPd9/ZiOpNOesdkhs3U6o3DpQyv3H8tju8XSd4ZEj1sOPsWTAqlYdpG0RsWHHvzw3kkwRaCMB+oeN3qzpNhaG6eADdKp9VWfTPAfmCcZHJxBsVfa8rrAKonvPZ40/+TaLrVUIZRN7U2+/ygMD/jY+q6n+KyHL/zuSBeYyplfhdLi0II+YlDeNGTYXUWcQp/WuNEWRKkmrDxJ9XGGvyhRDwtwoUiOCHc320SnkHbRNtLuhfdso1OwOvrBecg/Vi9Ri0WNZuW8uYb8EKhoYCr21RQVvLZWbcdA0AQYg+YrxabU7hEi5eVYRt83Ex37bH/sPRicRvS3UGRINakmKNzrZtfKMqhPUb9yc/9Ado87Mq0WKMRp6ku2ac12My/YmNcb3kGwj3uBrKlzr47aBZ1s1zZ4dQo+nscrEv267rtLC2Z12z5zOrvADmkuWN4T4Tv4lKzKjD1F5vm/UHdvwWNvK23KRWEwiRZ3WFwOQixBCwtMKH3KeFft6Xjqk1mTqMlZ6HjfQcI65CbDadvRRSLayGFuFmyTrYJ0rbH1eU9Ka09yrJbiqwI+Ubv5fcYcIdZQh2hjnPcI4QSH24gMydHkjkeNreC3/DczvcQk+8zl4rxsCHKc2lOqq1c8iLoRNABZRbqLh9U0VAidVqpJBBt9gneUSnM66TjfdDCnJOYFpLPt0U0gntdW3dyjJ6mpRS25po/q0M6uVvQOeagZz8wgLmuKr39kYtGE67lpnWCVqKB2PrmKO5jMzLZR8JqkToXZDaCHxVeZqM4LKIyRNrhOBlOSMr3q3dj2dCTOy3cmLAUwv0G6Fd5DYRDel0AAsLYJsxrE2qkW40Zo/ecsKAbS2bNZj/Xg+7xRkPtqp8BoHa1ofKv74Q2JWOyDsyErXKleUx9iFwAKR7YxJ/YPFLhqddneMC2UPlLUa36xHMWCa7Mk/8EjUZqiftOkFcMrw++M8CM5RfEH75li3rih2L8YvKZE2aa9doBq8vvikDlVIpk8d+me5FovpRFcmjSODJsp4cDVqwNp5C1BdcXeM/yHj15uY7odqX6X2yfmAbZXQKPCZ4BfD2GIDImFg4ON2baDLZaA7BtFSwDqrbhfeMtai2YqP82Es/fv0Ka+Nl/N9fTaGh3jfa2fKzIl9PpJLIwMzOA8gKeoRcoSw1KdY2gkPqnKuupbtBg5560wVADMEqC3WYZ3KezSnPP461AmaH7xqU0kPzegopGuz6+yw5sk1F07a8G65VFtZ9yMn0GrJfFxY6GJuozRRZzST/DO/VZlBLaHbGc0SoYJMlWNGlXKGLsYoGkae6ftvJ2mTEQ0ufOufFG1xsA2R1pfeX984PY46osjFVrlYaHzxdGf+Ykmlm856mEleOLCLocxuq2AUtTRHDmGlINDhOXIgIQjm/Kde/KDqHkn8iYoN0FD8KAM0a+szxnljs/h7KcVUFdNJsLpZpUVhewwoH9hQvz5GpD7Fz+LRF0JtB42wENSIOboC8Cu3Ep2WePX1wojsf6VYGoHaPQCQJ6y5r8B5AuiPO615GJ0AHE/800TpXqP1eM3F108cCF0uibZD54rQrI88tSRMiL37y6LoF4kmzzt7OcPP0xBycmoKZhXXyhQ5zphObcyqaibd4EKf0LE74XYYSKmkyqHhpbFE2ojrIKNfV/jNLOv/vZrVcoPXf3dlvExosoNM/In87fJnqRJH/mPRTha8X4378jBKzHOhse8bkw7bu3qoxmny/Jx318GngcJGE6VhGrfYwc0NmNVlCMNhwoV6o6rv2kRv4D/K2kIfo5j6+iV0vpo83fi3IIIXhcFfAB3aeep+XNkK5yyMDvFSj9xMA5juVaI1fbfkb2eRMcr8sEUaaqS6x1Ob10XQhWUt0J2rSdG3VCEBP6VYMZIRWnkcGycr/evfvsV8GL5T7bP7E98N82FuJ7toRqXrD+Gi77cJ7zR1vKHhWw3Cs1Cd0XD5s+lcVWvSPMw/NsgtbV0saM8CW+t/PC1rLrRNvKbs3ovecuCWxo+2fR8POv273Z5TO0QHBF77XkAMwmRe5thSeH8F6LtuwLhWp6dvj6UO/+GJkt7UPbkUnMda0oB20QkHOCtLJ6GGE6/V+4EuywvejmwGb1z6l6OdGnwleNxkNmckHErKj9QSLvRCsAby+0R8ncP0D1X+tqQbaC6WRl2+07aTQuZjqjyyvUalsFrPSEvzYsefaWFLplk/T4y12KjOfwCi6ToKP8CJD4ZkSMjKcFfDzm/xdUzfYiZpxm4jmMYf8+X8iKY9lqcndDAAJAWVG9eHTW0XGtty9ztyU141aa8b+MuabG6Xdx80m4x1gXjXB7MeOCxU6opibbu8WM3szrNjIFbmTXaAgr/f6PmwUxr1z2BUJD1QH59gC2Jeo7e2Q75VzYAUO0uHCXpt7IS/BF+s3AmK6UkkrXAkSfWm1I+/RBG3Rjczg4Xl5Oq48HM103p54vsOsp0obGAPn1SLRwEwfZFG5Aj9aVLdjGojOChytug1uagyVo+TAHz2+P51s+f3UJ3UDNtdre/wepdQ6W+psFOw3CV6c60/R64snB2QUXmKnt9a8RWrV7UUHN+7mUeJFAXj1wTaubVKj7gXzi4t+dah4rHjIcuVSAKtxqCaspEU7j484G66IwvOdihu7PYYzPcG/n9Ga7DlvQQKfF19LmCFuKkiIjqwvnXwvQ5QZ7nYZ4fFgYXDrpA1rhrhw3/13//8z0PcAoL/Pj0HJqn8Q7g4FDub+c/HBFMXChPQ8v0i/H2wiq5r8IShr1lBo2cGBnIUhKY3axt8XYXi1U7OZgAHSQlEpUyCjRvwQiamNpQuM+CE+Mm8Fnhyv+0shR/9pKghxdpAimlel/GM5PKFxsuilnRc4AETfTYWlwABIYYKDeIu2PSrOID7yPdLu2TQd7nz6hUssd9JKECSSqj9wSc8NEfaLQF1/tFEDW25zWupxXEgVkawKhFm0xPfhFX5ap3tEtceql3ADcSRV4LJy3ZcYTRqlCh7YT9CCgdA8Nv5koUs3RDeV71MFt5lYJsEVJneqyVxHScC2EbzvHeQIX870iZtPmlCT/8uNoB1L2bQf9s79YbPjGeAW+ZYY/GnEhuil3AsMpfsiIsCM0ufk+0VfF0UeBp0GJTBbeoYwN99GVenyGi5F0NOOlvKAhx7oi90+b3cPUdm0acS2ei0K8F/NRc0nh0FNS99BQ5oBnsXuk7JDYqco2QXsD80EP7USGZPX7/dg8t00KfRemCEe55QG8MYK3t1lNHPhKv0KkG05TNGiqHnGdOF7qrhVzNDG1XIV9P7iVvMod6E0bqpVVrF7utQQGdFXAJs05HkbNVol6IyGze05+er7RPtAmJbiX6L9kHju0Ii2ldgAwfURpIZrF6SoJBXVPDERD4OPz22Xqw9ahx25nDTYIYSbqntMwI+FR+opZWiiY9kOWngUCu1ruKflJpVhoZNk4mmbrLArzYpXzrWnRF2ObNYj2XcsMYMiqswyXiwgwDAfYCXoEcvkLc/HWyyXrimF1K8fhd+WxyCcHrnAW8Qwx3PS6S+F7dos+mnIKjULzGBqze/KZhHj0reQ6jlXcvrsE3scz2dRldM3FRhbvtIs6R8Ca9keHzxofwKr8UWiBwjI/rp2uxcbejdIm0eiLFj/tQ3Av4jPbCCUJznBGV0UArIP8zA09lAiz4Ai6mx8O4J9iHl+epBdHA0VVT/K5sYyQWmnXv2sT7fJlkKaqRbfC8Q+5KFPjzLmzrzG+exk4rNPgU+dAJSPE0TWq5Xrqk0ExiKloy2tIR56msNq2Ol9KhYbHJIlCEPJtmWRl8nuJ88u62mTs6o7nvTyTv8ko5Xf+QXJdC9ZbsYLypa61Dy6wtrm/mMFV/jwY5Q8PUyJR+zkph2UxOs5DqUJfYg2ZC6JhLBUGC3QHvLmsZ12RRCKQRPFRtE82MnkaONSO5HvKdqfQpFQyZ8XYqnqkBfzw1Qsg0SOB4k+CUCgo30YrRhpOk+2wSaRYT3sy29lhG+M8RBd56W0EMFKIvGXowM7n+JyIb5P8nddw2yf8/gyqUmGuCn0Wm/zeaA8AWhWFMJcmnl01pP9pGoSr8Xc4As5wIzeLQca8ibuRKcUTM4Kyp3lpA2DkHS6swNuvE3FHlFHSkg4ykcRHNnj2LVrgDHeaqxIX/sLZZI1u+56CDWkDXuTohs8B5QL2ybjR5YWmggOlhL7yTW45TlS69Ph2HEygtjmNUCnRs5zlV2meGKHQl0ouTOhl51S3mR79eaG9X577rPUrxcb+/UQNd+5lINBsa310RCKRujvJ59qFY9JnpLlTYyz4ow1qM8034J6gAYgy9Pb5iB/VlQmK2u8TajBlBsutiyEJMcZuUodJsZjYpkexO8dTvGbP17Gm6dsxc8yirAib4jeN91A5EEIl4BNKvPb/iN/QFezrLHOu8+1/EpMtCWw22BBQKoXHdPWN88Dbv7vUiGXzp4Un9vHlmijPOwmEDpHGmlqXhmjrLcfiekmTUGYmQmCMmUYSaVJkir+9XjVQwirIc1PZStar5XeYEerNHhxEUEUQzqdOXWVOkSBirA0YFLlbn5rfTCy7OeCb41kqVkgtYCg4g8e054DW05dc8CdPqjX3HTbgC9UTPO61kZjZ8o89mSThLvaaH6iM0p1gBRnJPWwd049U8Czzw4iwy9dffDgHKoV75+A3hONgzLWcA9bXym6KIDJ021KJqvyW+jzopvAlAqwm0C3e1g5nHhVbHi9itPopVpNQxtsI5EkfzqM/zYJkWOwAhNJYsQ0pTk/enwNJt3JtEai5IWUcBvKV6B6FzZyLtY3EwxQN0vaEHElyP08GNdH4J8jcwGIA6rqIuI1P/Ig+83fRBgobYH3nwUIEsTImweGaGHTqz69Fj3lAnOY6whCPule4KXf/cznPK9/mozk0FLpnhfgAdPIz+wlo1rrPBct7fnkfOSMQ52Z8A70K3LlFWxYycefdCyQWj/mIOUaKiMsblOuamUebqSv1xZqv8s8FLEoTItjfFQeuCUZvVHfWnF/hhuJhcAV4ZUkYFVhxloFfU2x405UqyYFfZnzmSgqOz4BSJCPD4uC6xcmqUgy0isLN64km1Vy8b/6kNciGKvnw+kZPG9hv6ADmZDQbCkcvmp+syhLHaTDA+xzpipxA+vEBl9dAfYI1AIAcFSSjeLVmilXGJlwcSwwC+Epb8RjEIdnmirTW5QGd5tiUhBZhhhHWd25DseUGqA3ZbcnXYL34wEagTQx+HcurM0ZhBpD55yipZAyW4Qp6/LY6hkJhKvmBtqkBIkwPB/RCeVpdPfENpEzrZ2x1jkgOP1WpIHsohuPgEf2l9OEKRU2Rbl297OUgyVYa/GeSKxgLDkdaI2VGa+Jhn6YK2RJ3TvSFkN7s5KFrXdrLZUQsvMszEm/Hux8O8mDLG3yqxStY5HfXphCRQjWBdu8aruGZBYX0rVJ5b+BqeCHoxXwACfbXTHO9rhm1bDokB39oDU7OVHH91Bdprq5dZWmmEpn/2DK4wpGnfSBZKrnx+VnHNniiD61ILpFsYTm3LGXNu8jDmzfc0GGXf918dGQ20QJOeEVaEzvtzR4/K5rtGNFt+4cRAmwqX2UQWN1T69tdhNQzovW4P7Bn9hc/Df4qeVdHI66A1XsxxIIa/f0FeJil4Ta20EghaQ8byYcg8Yiv5au8XUd69qvNSCgPplmqDrrFJbxhJIRxrUflv4uke3JF9b4TRC1A/OBH46vjc4xRVPQucAttti4SoUtw8ElNWvp+Hxbkb+0P4jsBIc03mv5bxswp5t3WQHny0Xjto4BQkZzodZzLDGBuQeZ3NBZ9Tt5OQr9DuN7wOaeVuG6uoq6O7v8COL11dFwGji3STf4zWKO437Y3v36zWeC9+Z4oFVOLCNiiSpCDcrCuM2qvlrTFcGWOduWTdw6XpjJFffFhs2siJBnoLRjq5EJ9LWosZCWOTohZ2rZNifua7l8kmXpPZA48Ec0vJB4S71ZdscDdDdJtWX9JqF9I9FasXVZUr42NPNLqQkPwYoKrd71OvDjxuGuIDh0GdNdcn1HuRSzahq2JNzhQVAUi20izEsyPGDWtaF1XkNiGTolErqWANYS7nMpBmfFNi1fO0gYzr5pfNrkPxoWE1DEjPA34j0ix2m2SxMqatVPvQkioc5hyuJfh+gdRRJlOAasYaOOEW/26uQc/kcVCgI15Y3w7XJ0zULfl/x20Kd4/f8HKy+sjTxvid4eCMHhM5Fppk23Ngc/csDSZq6UB1c97LKA1ma6N276s9riAEz+LA8lVaxokqcEqvVyPqcVjnIh5rpXUPwzZC3LNL/HAmG9kCc+HOQiKqbHOCshUGBJrdVyrV2/OSbrFYvCECn0p97g937Fkva3jkxjrm4bQ+CB8XIDw4TQcjrmw794NJix3fr2rOdkebBZ70jO+wG5pNVU4evaoFroxntpHkuM4DJezBbrnJYngvwxSwiL7e4k5lQKWZO7maTZEMjMv3cDdtHG5J7r97XGgqHMo7tX6Las73bh5tXlv2/6oY7Ent6BGLY30vwZgGkjS64DifACf7hDYY1kjaNiY7fuNBqQcf22Raw5K47J/bedzxNidhocdsRgoByJT4ztOGZu5UIeI8nu9rMylWV/CFj8gI0AF/y9ov1Nvm0mT9g2a0ZNxgeJgXTqKuSSEP9WVV34YrRJWU6IiNDf1T5YsbLZn/RleQmyH7sEiVCOHquRnvCh1cPYUBTpnc80IYxTX5q7KUwUFjamLuQA4Kz3IutBsYkjCg1hLV82KQNvUjwH1rQLzxdmXLKVEbin8BhdxUeI+2HPX2lfDtK0LQYMD2/sAWShLMloOVTbq0pCpTXFVCaTNejGSCB6CASK+dUwMV29HdW7IMoXCL8EU6tQc6W8/dLbGdO/ZZys1Z7hVQLk/VhN/tOuboLa6XOOIykhSkxxdzttGWwGUzT9xyUf6BndVM2lPeXMkTnNLj03kKR5dO1FdOjSuDgCTtFt3LUwKRg1FJIgjayZQAWlu9lxxFvDJlzFtVUHNSbO4sq54HIMQkdCi1EP/mgwN4uyausyl7PBa9WyAtkh/P5u5fcssefkl4quZEQRrMaiHFPbW/g0GIWhEMy3qkBgXoC+ZylwH+cu+Sk+27bXcp002l3ETciH1yoxdU6+QshmtIXtzcFv+zGVDahi5M6fqP8G0meHqihSVH1i4z8vLEdB8lgViBAS77EnAJEIODldxctqIbrOKv0R9p+VRO0XopYVT84AxXgBGgJ8WuZY5K3psoszuImjud1+5lVAGiteO97jZQkf49A9isMWgnUNBiaeLXyKA/LHJX88tLQ3dq+2p7BKrJnqAW4MAtAjAx96N6JjdInlrY9KJonOWyjvWY61Cy/obPvhxYoVfrivxEmCBDhhnsySqRyX7LJTs19dtZ2A/ZEFPFkBtCb9eUzXyWpM/M8zkXxjSqjWFTn7BLRmmhqabWipT/+y8aCj4r2pvqf1D+PD05RyGp/1u+Lp2uhTIDdhARgeRA+ctZ3Mpvb5X6Sys0N6x+8vM681ujWGhDeKOt4grH+UxuzC2Ra6WD9epdfKkMrhn7PAnk8ki1xmdZ6cZkW/qO1ElkQtceXnI75xdgoia4Pvyue4+BPYNJ8YztBiKWvNmruMkG9w76VAY5zn1zQfeo7ztki3BmCQ/c3NPVRKPywXTkzd7yvH3K5snuWblp9YMBdGXHgHixUuq4wuG189x5045wLtPq5wUoFZwENx7Q8Sd3chIBcC0IRNAP35oHtOv5rDGQRh16xf+ODWGph/UgC+pg1SNBHrcB/w0SnJ+pvhLyt1R7/A7vr4hMYhsTezAGmhe6S/kPjDwBv1i5Uk1Azk6YwIIjlybwokB55AU+4/M1yFI0Pfvbqzm4uuovvMqcfbbHS2wk1sYrjGiewa+Lb4S6p2/fQuFddgNcGiwAzH2Y44F34R9btLvu3FAxYYPwXFUlXJ6t34iqWdy6f0HLshlTkduDUzkEd7+lB01ecjXw9U7feuGKg+9SrG/9uA16Vuf03Dl+IATWxMU0do3jZQHBazmskGcIPx5mheRpv7r9+HTUqTGE2Yd8xWYYHVzhJyjlUKSyZnwyksp2fNybF3aBecO05jDcvX5ExrYx+VMRa9GZ+bFDOROPIzF/OMUPel88sJQknsubQApeImD8LqJjW0d9VZbEKH49xDvy66lx01OxqHS+nv0RNlF2wHuHDA6VTPPc3Zy811O2UZJQtg+hLSy1u3Oqf6dzy+5iP63RJsou1lipUhr3AW4EZ4s13DSIFTWc7xZHvANZTTMdOGFn025o1mefDqmuD2R4z2RALDfMxzs+Aghg1ILXAr7f59A7YXB7yOhLlIPH3cX/wGHBM0rm0yniyO96nUSBpRBmJonXKFllWVdj7QNRFnQePWYzLRvavdoRHvP8HZIPTMcrfTGYLD4tZ1KBgFqktdHsV4itUqFatpz+MXGibIvY1B9yeVQ5O4iPqQyWxi852gujEPnSzDHFTBgBzznnXjQ92mVQ3FZK2NV8C8pcTLo3cS1zYWoe8rIiwdgs0cFoj+jcSSBRMuNF2+0quPtStDAUKHpAPRt08L23OV2q9lrvFnFWV8MpD5zuCbhM672dfCxJOU6ROHtK8d6g6mk+MAPqKLbAoP60ny2vxDJNs0HNo01+DQzXo9fRdmVSUXdTpc9lnIuIi9zLGszgrkcMVLd2MyKgT+L3tpf0wuhwpjSgkGW+w+V6lmWMPjrlrn6eRJdJeWTyvK2hvtggOYH2JfaMVtlnsVJh7evIPo3YTN0LoN75ItKSaulRRqqODmXnPFiPQRhKYK4V0ZfivDMRs7UIKhz0SSt7WfxayS+JzEeonq2BxrpZjXCjPgYCwgn38d4f4gqb8N8CgLgE5IixWydn2x81EEu72Y1tYibtBKQHa7KUUYaSb1JGqw3YH0rZpkMPIgpsdgXvOHNj08JvyzBn1yEVfXZsbbmwEKZaHKOIWtprMWKVG/OZ3YGLb3UJIc2ZSMUjzH5X4ElDMODAq9SVgEev4K5CA3E+G3sWtOMBNvcBJussZPvBpgrUpcuiCSrTm9mdOyI9x4fI3JNI4abbh4HsUceFUyOMTx/N+DzMUgn7akf713l8IFK4e9RQ3QjqwqpJX99BvXBqxOqGYgRjF7URMLlKzBuiljxd/bzgq+PAEEjnxjhUTJexwX3sUXowVB4SIB3phZ1GeZt9t7l/1Qg1aMgC1IeUCR5xYj4sTKcHE2Bh/n+qT2rK+MTWw0JDy7Hslmj2gvSRPQYvwBIuOQ0IFoX6PxQktgqc+u69Xx1yPFOch11Ef0dMN7E4nd61/PQdh0mwaaP3HLmxIpPumyqiW6zGmAVyJlh0fsZvmRPSznKfJpKg192O4GyepFFqr+jUnLZZHYUCrpQaNRt4fEUyBN/oBFZH3aQhyTqJ/hNUppr9iRZ1Rn1TpSEbsftNZG4s5aeyveiyYxxTWI5jY6INIO5e6x4gPE1au15b7AFSX/6S9zoWiKbK6lmoU8gr7PZZpqeSbqBzyQCaT1I21nLQDRQ4c8rRkhvdp7n4wInSZo1DpOZxuAPhTbtcvyVO2pWlBymUbDzpJ6gWuUnAX/o2bCJ8dXJM8TPbdOhCXifzm6yuChii1GNns+5t3gH8Sn3NGZleZxOXWz4Wlo5KfBa6rrK5Ue9uhflcC781+NmKD9kcw8NnW1CzS2iqHgZQOJkCK/yT/uhrn5QGa5xK3CpN6PUCDVJm4vNyNwjstpV/mckDKvJcas7PaZ7kHasqJllpyz2o1wQDZEdvpHBBJMdsvdmJI0A91U8Q7Z7E1Gc/dD/xlohvASqD0EtQLwVGfPgPA6KZC6jKY6K3RvCBx9gGBdWh/bLdedeklSr7eh2ACKwsx8gS1+URVwg5ONMgKENd2NNSVQeAbzN97XetROKTAR01fk1WWP43Skp9lQ4zuE5GHdPorbtIgqH9eFu0Vk4Qy8ujhOfJZAe8+R6Mq/NtSyg+chvUchIOSlgzHCSxGEDCIgH9u3Dxc1Jrtb66EVJs8skEUKcsQv08UGeS7lDY7Tb0AQMCWSPNalk0mVQQwFP0KT+B9JTx8leMCcTZu0m/bW8Gv/8UFap9JbLOAqt2+b2rCnyxQBJZGcFNi/U8cjMuBmOF8x9n7A/2dQkqaDTc545zgbbQp99of5gNGQelU315HC4I369arZjWVKbkpJHjWQSFXsBDffu/MBp37rLw3/VvxZWuNuR13fSgK0CgXGn5cMg+eMvOeCICUyA+toETMzbYquuN5WgdzfgVPEhc72uJPW7ec9VT2rxqx8JscwgYE8aK9Oiuzgj81S23D5BCaudZ52GSE6filud6q8yJXZgoYNA9Qhi93C+9nM+T5wmH/CCWQBN+RQxiVfOFMP85IxovwkQXCgV6+l/P0zzJm3FLxuu90cWlvc4h6LqIiQdIjdneWVX19ldMI1qD4oZTWfV973kqJACCNG2VOcmEkbPzBgaHhi5znxK5NM2Sw1vJoLCOoDbKf1nhe3itQUBRmBEHbwBjiExFfbWPbGBJ/W9rB4peXZU/d6+YORVBLtunZurH/GbLRyluEC3o9W72sphGHxeiS0/1IkR9c7HlMCGMy0ZgjqQtVLyGV9P347dKK/nI8GS4yoB5ZweZW6DoNbSSL3nGivAOAf73Szqf1gsHi0/MGN4nM0XLsmHAzgexfoLJhz8LG4txyEMXO4ewIpPdFhz/zlpBl93Bh8Qnbn7lY7VcVuNhL6NauCsZZbhZuQImo3sQLjuL6eonMd3OPWhyY2p5c3eiN7i3V6Uoy+Qce3bzVLWvzL+dc/hyEhZhbobP2AhX+x7vUlScKyOM1/deLcU+YuRP1+jgTjC1E+N5U6hRoCaYyZNy4e7awKEW9Cr8Tpg105doypNDKd9WBoahJwOj7m+cbSWDH4/+lUIKv9LUhc8ejjhCMzP+DBUiJbB9jNAZVU3wilwThWPDb+5G5w4nZBw13ePU5i1EgMv3TBGelolOzxMaJqW2uiPYKaFb/KJEyVm2RnquX91fny3TZkqAv4NgtZEmJ/2yyP9Gcqh3SmVS+5zaxPvUE0we4hTFcLiVDhO1T5kf0kTLZnvnpJxmgLmXDc+FzQ7PYKMMyIjPpRVQ0cF6+kxIMDflN+kuwXiNiGN1IfybK+FOg+apf0GG4RKCjSGaCrXgFYzzgl/xg1aAEzdsklwpQf2R6kgmMFGNh7w73raVL7G4ihbo6Gdgg9oREl+bRiSFHeAuQU0XLWtZLINnws5axaR4Jq7Yug5fQl3yW/8N7uyBsM0xn5Zvn26zbuwDhINF50s9lBdYxh0ZicZKMFNjNgtkNX7B5FN61gjrcmJBzgG5Z8Ohp6lp3QLAMBQKGSf864Fk0NjIsw42M+0y1rwiBkwF807JSaUdxExrP7Up4HmjNm9zGib0HPjwTv+kmt0PMCyyutbIHVnNVUV36a9kLKpTvnxn6EpIe3VffB3y8lxUjQD9LpcStNBbWoOh0XkYsMP7FRy5df8nEsa81ajqFeSwqpt9/Yz5EFeGO6benEMwZZwnTPQHuASyY9D753BX+tccKJ7qQHN+Q5NLpEnwTb2WuiUuwk8m8xZUVixueeKHjcnrVPS/FK6N2Jku9h+H9HkdS2HhKme7tJinf//CJj5/AEndm5SokGS9alb7yhhPkxQgkUPE8HQWZvg5IMvZsdtvxQfM1lWCVHLkX7Xbrostg2+Jh4At9Bn05DS5gEJQYEDet7xJXqwKM2F7oSkaigeD3bV0TzW8vun+f8RxSG/Yrpn7I8ukaOVEq39AUzBHPt4FLJy/Il0jBi7o18ktiuJZgYYTfli60Ledn0T2IJciVwJcZlA8EmfkN4Fx2E/66gfGrY0c7x/macEB/Q+rLcURdOrR0euG2TaMGwzgmhAxqvxxiPFvm4F8GG61CvF3BtYIdvznP9VsMXX4f61ZC639PQ/rJ3PqJ0nQ2DhO74R70PtUJE3OFJqn9vBDuXWM69wKQ70qGxL1ZDerKNi4MI8V/L/ya0OTd8V1xYcEqWxqa0Z3/iG5J+egc3BPYgYGjcMRRxYEbFfCuY0c1+cP3hOvkkQMk92ADmdnpIWV4CYVxa08nRmmfQjdmghvNjopg0atDB6N0akbBsQw7vf2ztJSQguSLhdXC13sibRxzc6KjdHb+T+WohLf/gBkKPcLYdp6LtI6tnZxzdRm54wbqGSIcDv81A25MBzV1Bx7XAquZbNqBDlDlu4On3Qp1j5JKV6SUj5nJjOfx5KY2+zg0ENMo4rsjnt7aJFrVrvJVmiGc9DKBV9PjJ7o/5zo8sZpUsDaKzMsdzDER8nGlxfGhVcpq5is3P0NRnIgCPSlyKiNf1TAt/6GptXd7xRNhdQ4lVq75BK00uPbaDPA9tt6I9nuL7+IUg+DxpmCNJDBFfddvsQurSt5J/Ola3egSmjuOq7m9kcgz44bJUZGCPGbPiwMc+FaF1wUDJQdBHsgDE+hnVZ2Pq3TokezzseBmbrLPH+ScO58wRGOAGa312IRX+PqrIyIvCZpgJIJpT21hvDx9Sf9QSuM1S+HTJiq+dUbo7Z8rHLb9yqiYrrHfIfGaqHrJRkLAge87OQ+U1W2ToYNJKLFdXnKVI5D+Q9GD6aEnIuH/j7nPGY+q7r8wUjWADbyz0S1Y73sBEPkXLDv45GKxMBXsnnP7rKSJp+AjMf0grPlxv7Y8vY643q5S2xwAFvGqGPj6XlyBiO5+RrX4s9Um7Ae/rsgMYX2E0efXs0pbhxvOtaBARtMsJ5OjxRlyOyYqiOsSaLHUeKVSFZRcvLUJefHjoqcmVGpiKUucWaTCp35iJTo0Jdh091nfajnQipT95u5T/D9M3aOmDpT6krC3Gik8wld3swW3zuRYgKQLv/KACzHyAYdd8mU9ldome6N9WAw62k2boy09YMJsqsf9YEYBm1sdEov5qbbqJZh5/Z2JYMj+JF28KViGvadA/xFHnlwrScKI2sRISq0fnvoPJeJWZg6RahtoyXXapeBHzQqe1rE4YBBPKV2kpoHc2jM3PKNKbcrP9eWZjzoi947wzUEmwYq0torv19p50PDg8NU7+pc1YUUJRtdOQZiDraIW3umbW8lzlT6EzF1kSgTx1tmt9uW2zsncBF2bSa2FdeHWt4EGOyPyx5IpvJ1L0RDiP2sIwP240xXdGv6FVuh8dKGQGL/qlc5iUkT7PH3y31AhEXEjAyoAceO0ze0OUM+ZqAqRp733+9XFJf0lFx3B6nwHOuJo+D+x0AojcZc38XPwvo+6mr9RppweAZfYxqh6ImjZexMnb6bv6ohNMQ6oqQyq0vtW7V+YKcI5yKr43/bmPyI/5J0P4T6S7uahMHnCy0IfYYFnYUqQd60TS9nTh9UEASI930mWZYs9i5Em3exXP667TndRb0jDXTxdFhHSsdx5LmltlN4rBoNSmP8OxeVy1j/TpWHm+AIJ/OUvj5iv0S8FOjecTtDvbE3RoxvTLQQSfDk2KQw7SPlqlV0eha5+qf+JqRHoRytKaB/VXVQ8JApMMxmifsQjtZyqFBqVuLYahDSLoGcvAdXpK9Qyv2R1MICVbsnTZZTob47IlaZAdiQ0H/e17EzyNS6gcqhxSuzLuKwYLXi5wY0MDbMBIkW1jlk93KTJnl2lg3+XRIuLcvh4PQ8cH4sgGpH7PCv5wCbU5GifG+hhpONPNbcEeS6RH88oURlfhVRLHG6P0edA9+N9rl7fUsUEFuNG16kanJrBH2YJBG1a4iqlDuPDMQVleuQkJHGyVqmEi4e52e8T2T6hpyjFRW4itEDB6Gmc5RNcvArTwXivztM7PqGa2ScN8yY4G/Zeqa302EfFNtVEwetZ0nZquguBY+xMjk5sVskoyxObJEpLQPcWrHR1Yr2Toxy7ZvtitXQ2rQon4BAkFTbrstev/3mpsizWS1TiUD52jUeo1/W/2zgZ6+GEt6Ug/48WdotQS/f8+Hz8VX3P+IHt3Fxhi+yrPefKkWRiL4gWnMGEto2P4V+LNmp80xH9zpl4miHJDdFvSMNADTG4DdlZogP6mIXeMGIUziR6u1lOBWkQY5aYt5FY2xp0exbxJjQJVOLxtfsJ/n9neQbJJl7WDrjimcx8yKdKwMhLSfBSOpfU1tHYOR5b9T3A9iIrOxp2/1UcRgXYtrcXgdygy0twmISkjJ9txXFLPd+tMTgs9F8x2Ef831tQ4grUFQp/pd47uy6AZBSAOADft8uZG2UPQCjxYnHzLj4aFYVhJjw1S4opyUk4srfAobhNpxvBpHOruPygeI4j8nqwD2Fx00Q+NUqtkGeiy0RGygLCZ/jYpLJ6OTk1i8za6a8dwoAK7oz04LXhb2cx2r/zW+9/i+YtgyFwcpuZ84mIzuxkeYHzwCwtmrrZC35XLmBl4qICpYMwa2W17T6GvXfgPDE2YgOf9b7yts4T0Gl7AJaQ1smrcNmVMqYNsWrsEnOuuerMGsy5TKsg0G6x36K/bU3ItOSq+g9Losbqt+i0SW7NEhH4gqEDTvWbXRQ0S2Z6nrXyHrHEP9mRdCBXhZalsrIvSyJe0yZGy6dwVgoJ0p4m04wkQfUi/MVogsfhpIWYwADoIsVnjA3NKxU3SPjCoRqGXhrBlyLoWAvMqkx1okOX+ENbe8kYr4UkUeenxTqPDE2QAszCOsfD9cW1KL1u+zBXjY6wKvsTlVB2TBk7rE4ZQCPtRXQWwO+EVHxKf+nQIxFhGtOwe84bZVtxnNp6AcSPjMDQ1zo0BPBDAAYdsWoPgnOhqqTqnew4Sjbk1uMhDSy5ib8IaVRwn413QJuwW/sPjWZZ8US3nxFlD9FCUhkcvyFbbMrFCcRpP6VDwO5ipJdBqoDO0mcbmLgfkubWgkAxmfJ5pSRRvZigEkff272i3Ed4RMVnWoSEy2dglHqMNyFM7HP9NFUJvkLxfXAGLoQFkhVFFXCakBc5RJ5GRQzRAeJsfrKJpc0oORRZR+LHMuskuu7esjBa5mWi/m6IaSbVmpci3JBOBbkMQR4SC1SPnGlXiYoAUpYnjleA503lLZT7wRecYCOTOFYtrYl1vfWgEFfOxW1KjXhIZ1tfp8W3YXAOCtvTCS9PHA0HxvX3FLmCzHjJKss0aeB0XcsPj13R4qZpjR6SD3XpVhl8Mh8pdNdLujc7izA2fsnUHYGWbsrnt4LoEm/GvHabK0MP0xMjiFCYD3M0fpVFe1vUlo780Focwm3vy6+vaJFqwOvH82hccWo9e8Jde100BO08w4LkqOPStV0xUr+8MS0QmszAIn3tC1iAY6rZiMAArT3qIVxvc2PEuIIfKyP8U4mL9xmgO+3BWk1lIQrCBcMxlw5clzIo1MvevjMdp+5Hw3tmSHHKS4KYCEo+ChUE49mIFS3h9m5czhA6AXs5cRg4RpSbi91gmY5rBRXuXnRvgZgsKm4jfbOwbVX4zACcw/Rn3faLPQEg9CefTPvz6TyC1wSUUwr20uhLj3cfxFGtSLnRZWuRHhwSJc1M4JZ7L9Urn1aKt/amO5N19kRpSOAIEdMswKzBO0d649cOOYeWrY25yDCnSKahaofg49PVrT939p+Wr8CdImm0lHlIEdt+khhN3jgo4caARrWevo3hfY+rbdPrKMGUQOoZduXcTVl4uUfc3ATbfhsy0T0ywEVRH2SlI07Oo/xhzIZzLBx65yTHEiKj+N687cU/8aaoqAYmA6WVEnX73iP6lPn7g3STGiRUbKzPsX1xB7KaKxL+P45LfdrBqkhEC87RyGb3M/86p2KrH7I8LDHDIBKDa826e9HE+BkJgnvjX+qeXikjYuKVBJxsTKZecSjWhtrqOnDhJ3ttPTpKVpxABTsl/JQ3K79WJaQMPgbSwCal9ds9by1IJN0eDesFvm3kXy3BA4UZk6Z3JQW/fMljGk4YFOS4tWRZ0qf6SW8bfPkWmaUOdl//3LflLCdBVp4+Xgnj1BVnRQTAqoNeZbClz6lHLcLIbBp66v88aOYx2UZ1pcpIOOTPfENgG9KWrnsPdLNPCTqOL+X98K49AEGr53CudsgNrH1ddNEgeS1eEGE+marUEd+AuvKDH6K8fFM9UizZP4nWNpXm6xNigD+4tvLiwh8YHfKHf1c+G479jrdXUd36KLEElVWAWtEU355GUP+QsmHO1S7RtLmNSaseVvXNKPXX+xsJLtmaPd8Rch764EOODhFZDt3Zj3uJ5fYTUOeiQwAZ9q4ZHrDFHF0xJjv7J89koGB8IffO9zYuGwBwidNUahLUsaQO7nLQTMXsSHOcDyYwXK8HUVaLn3Hw7O9yCY2WSaJXjm9sIZ5/78IiVLTRWGEfLcfpFjqSkpG+kAZI8Vc8+OcSy1NbPT157HS2UJtHLojD+I/8uBlLGDIz6YFk2YlC2hXKOiDom71xhA5T5NfKSFNCEMTNMGKwxfELaEVFMFfZgquzpBZm0b08IKKmYCfBUAb2z2Zv/iE7ZEkVM25/Gl2+pyk9Nutvj60bx64NRrQYzN6OSD5bkSrFlIp6ChSdMsjlJLW1WBrFoW9EoRM5/bguO0NGIrlArVWbmp0Zbh3yPvK71s6vdxm3hpR3qWvnuKvN8Gf+basHOX47E7d0z92KoMfqswYcjmVvPOHhvDMp0Klvukdnchd3zBi7PFvlrYciEB5b0oJ0l0KhLbghiyOAA25xxc5ndCgjJcbLhJe/8SgTz87Awm9VRmeXpPkvDm820GGaYPmNjlgSEVmsfNmWrhWmZfLP0pnmifkzzVndTVVEAjXkKkzv6URliGPpfMDptneRAG6pJLYTtvtGyq+26ITC84RIM5IUtMyi/pNvnTVjCm5lYIoSPiwFZhvU1cXId4uGt75EOQObsxgBXslRB5dm01bZVNzJWn+APrQbq7SLFlfo23mDQEZvEap39fx5eOlLXEcBRlNibpokWoWvMbUPnNvpq/vVKLAJYRPBT+gxBqc4eWUlj00StVI1WvXf/Hv/XZ/TXV/bKps7g8MsekhoMNLNxuCcGNk1hWE6dyDfSnB0qABT+Rqqkde2pskFjHfRzOZ5BMqIEXw7rVgGfAXAWWCMd0wKGNNNTE9czDJFpS7ulksvKP9o4RLyBUqd8mRtaXE5Ef8EwgKCJSULA5d/7NDzKc/AKo1BfonRNv0NKgpVo/qQk0QeIlA8z3xWiNqMDXDHd0xTPQY1s3R3kN6jGMgLsaSUjQGa/G2LvyJq7F8mW2iHiFgjoMBDl3uTurxWwwD79QAqGoGV1BxP7hM47hcuSUjIc2df49wl5cL4YQCBxc54sLk7rF4gtY014L5GhmSIsMbRHZ5hOMmtC6jdztymQeV2afCYUxU22gtPgIrDAMK81dVjoXdKN2CNChKzYkWoqRRNXPrFZaT+wXJ22xGn17NawW8Hk9I1FMhA9Lz8W5krZiVQVLdt9zLI1RzBIBfIVfZVBKR02RcZeE2SEmzJR3yhNaxIVyDIqmtRqKHqKXf4tknjRaHTMpSPaOI+IWBfPjcVkz5jn322rRBVbcy36fxxkCSHyee1/mC/aiSG4i1uoQXkUv3jHBOV5sbiWQYbNJkuyXJgRfPwoKihc7+IkFxoVnuvGlcfEeIZ5uZCFdR6epsDHBBK50xvi2gAIVrmEhN+/SIAel58UFLqZIUTUsGoPTQ6FH7+ZzgNKcXPWzhbNX2FhcVeHf7j9T43hFknn/iI6JqjtZwmd8TOoJrPqX+UxsYBu+m/dgk1jSM9J4kAd2/+1qMd0YJ5E3fRlNTp2DPO+XfCUg2JC/SLk+Lti18lRbQtALEVA6RJ7QxTuaoFpUTi8A3l77zqJqrWAmCNCRbXYv1CtwK77piG0Vi5W5pFwT2i6MiE+PfFfyJ0j/apwGHHNKBWiaYJfetJ+ZpetWvZo8orzyVCalDxyRIFdRshWlutmSRqk+eJPs0ZQLo8WluJoP7hXmnqLfmaSbEtElkvoJ/QAnk9PLkXkj9wrCrAazu6gkzuDYbqPXSQJyfzmWczyrybdL0mwzmIT6gxLNvtJGoBSeu7upRbaEu86KNW3nIM5V5Vlp260OXNZHL5kLp6UihwEsHy+tZ2tBhIQyRjbAHR8loBWuUqbswhXrJoH4tyKpowzU9J0qXvKwtbrZtaWqf6BmDZyATVa8dm8QJ3R7FJRS1bUIr0bqm4mYEE0O+z2I8Rp2uVprdydqclmG4YykaH70eNfTimphknEEpaHgIGEe3idLd+USp5Ntkrx+1taVtCfq+BgD0tlFgUFSCkmo8TP4eu1o0WfncAI23GmAAfXCs+vrmKnw8GRJiiqqHnpdF020hhnq3cJPF3T++8BpfFtlg371EL7ho+jZNOEhRmTC7s0IRD8+NYH+3nud4dT2qq9Aj5A29AsyQtu57QjN+h/VFWb3FVNXhM81Rmi4vM1g3bpSZTZmYxErPYzgceLIWgDOrfs4zOX5iAIKOFv7Iq/YGj1PEd3Q8nVrpzVC9d3uPKqSe+bqdffFfRCpgqLIYwvMJ3nihIAyIjvUjK/3RMyNZG0VXXdgJdnjN1bAfbNiPiB5Z60gPL+RdD4QhtyOC+sR3C8qKglFE1NYGZikgAQKWUA8G63S1i/qnDWEU6YPmy5n3RNESKXtMFtjvgxnMyxJqzBalmW+qoebxoHFW1h5K+5OQcGD5YKMc79hf74Y5XeMVx1WbJRgn4ND2n3jblfHlAl91iUo2wW/h5BqmWaZZ/N31e8DJkg0IEYrlDIuHSH+b0l18McV9EcixXxX1EHIM8jJEleq5BdjWt+iwUGMP4ovIIjAAkRHYZDwe8G/H+O4WsvMIliAi/hTKbPctk8zpRPFLXePLl68Mh9m0HdWSvqxLHWEC1hgK0meR31qOcPLWoWnlA3yRrKW4VuGbsaMlzg7gqNw9QUkca6T6apzdoI3AAI/J+H9/SpP9qH+wtlsKperdXIylunh3BLM2kWJmY21gTmXtheJYdGUOp6GRJMhDzPxA2YCuk8oqEOwWQANDNPSIKdaRXVibgJSaS1k0EVpa/j5cWW1GjlKoUzWC3iJdWXkfD2fHG5/ny7MRbveIbxZPCJ1ly7GLn3MuVuY27KS0qDVG7YX2SzDaWh2aM8jZG5mr+IQAvzYDN8XdBdcLm+rDQ6p17x3lYuEtZ42g4GXto2wgtfBAyBCcKPlSTCnBWH1hCaQUScYTvEh7wo+7RjEWu8EDrM1IFi/nwRNjLiHjRLhZLmcLEPzH8JTTUP98NJv4u7/tGnCGe7vdyICJ8FRqxax3b8QpyhEjwOqLKAbQvlPZ3f1eZwfC2VkswYhyWdzY4X1AIW8+T8hqZRLUksJ8VEFQBYqUMoH2DGKGmIWpUlLgzGPnGqr0gVNRFbfQiw+aZ+dVjxpVpjUEFtYL8LaG2a12kQDLBt5PEZbcsHvJ/+0Zyb4AIwM8YZ2IVoL8xfTv0BD1WyK9hK/jLfNj2+KyFpKbSWknaZmUBtyFlGQ7dnToZvg5a8md/wRbQ5fdpp/SL2b7izKF+1Rw0LuUHzvKE+yLmQd+FXHisUpWAOewARLryB8BF0wdN7m1QX/LymClc51diyZwGcUqk9SrJ1uUhPv2maEqQqfykRgfhymJsOLY3Gx68f5h2D0n1zGVlazofdD8cCleakFSxyU/x7YvbnNprwLPrSrCY9shxStMmZ3048qZjsB/ly8CfBEiIDmj8mj+L0WW7fkGOb4pMUdhWGtWmgsp1KYcUAP/ltg1CsEwtP556cAQ3nEusjmP3lVQh9kIXuFfwcHeGlorIZiLiuwq2LfNVa++h3s+OIZwi3sV+8qVILjey8Ksv9ZQPnzgOzl++XzRE4W5jXgfCTx21VYn8+Q1c9sst+oJVRgJSpwkkXRUuEbsFVRguq5t8ZnKNcbDqawL8CWlKyrulRATtCAEqht0z7r3CAc0slbWNmtffaD/07SjlU+VPSh4eIHrtiQfMAiNZeirL3GLtFQ2842OBIQ+bpRUgKwSlbag79qxqS7J7bv8+CzGrUZsKK/zbmLOEmcbeFMGCknR2b5xou69BIYbYokkjJGrd4jj4lSyUox/G7RxcRjIl3vCfdMQeyvzWtxs9KNN2hEIYPQeds/WmSprAEUy7RuD0L7UpMAJWQLnYoz8oH2/MUj+UxBawyNPkLr4RF0TcejTFSq8X7CXlHxoP5voCVh8lBdqm6mp9dRtbS/h7hkOQhkn5ZwYzuBQOhK/vYF/t+Mxx1IQr/SVo9KNwDLxVTegYl/jZtDGuRouYRTyCCemiE9pGxoc/+IVCKmyz0Dhxi7W/X47G+W9Sdf/RqiOaNnZws5nhfEAIkmgIF2U5jdzGgTuKrdYTp7nA2mKcredTPkWh+TIFHSaxWb8pDTovQJK0r4jBl0e65Gi0bHCJOxT/CZ5+bXJVJpMhUDFyGYo31BDYl3pNb0m7/PK9m5X6n4hHFkV0tKHhM+UiQZWG/C/snmWuJAOZm3Jst0yNnr3OaLFp1jd3xn3gcGyiLQyHbHWP7NOpMnvhhhEzfA8IfdnE8nbQAhUSQxNSzx4t7UlPgv3jeT4K+crKk+Kq4g6l0AZH83a+Ek7HT+YbYHXFqIPV+MDHc+8isvEFj9x1qHu2p1FxMNdDoCgTtd7eYGEv7gkG+KKP4Shem8zljrvbIqVghFdpV3+eqo99qqyYngvB8nS0+JqOa5f4FevwJtxe2CzUHnHRKBC/bGJGND0zg/Vp3k4+2CVvbDPQeqCstvgCCXtEMkb3OYltnhq2yJnbOwPbgQDsXUV0ULnLRPt4L4Xof9SUbTzJfT72WQCUpUnJk1ajiYGiFtAgy90ARXwmL8SMfwy2umxrcvWF4/N4wgWum57jGFmRAev1rymy9j6bM7BM752CyalSvy+x+uoEftORHVXBdEDyjZ89lExY/uB75C5a/DJVu9k/Rn2Yrs9Cxm81vUcfTcz7U1MSsQL9uLJqgB5yUgR6jaflLC6Ng5QMeFKz4tzo+4wqzaepJ2Yfct43tm0NF6NgzIN3nSP8xh2inHjrmx79GphqwMT15zrPqyJXQkxwJLtjnIxIywMGbqQ/5npeGJVeY3wt9i8tznR2i6d5dQlTs9J3pzkZbNxRfxmpYx4bwW3y9oM2dssxIqtulPYIypxSiZcmeNJZHWdZ6/J3VtLgkyZfT3siIc1ojDMlwDeuEVHsu5Ivif1Tj6Pn5m8abP/8itMXgnSfnZyLEDmAUIv0TMZa10i0DlQU9bIURj3bOePzyChXr+yRyd635p8vF+vZDicO9zz8qPcxdZCF0y4Djumy+grIuM+gsXW4mDtZxrs2zwrkTZAHpt41IgCnR0V+iAVRHNjUnic+Q2hsXnQtOtSUFnjpgRs/rnhjaye6+Sz5WV+kLaWCdg5JMtVAMREDAAedPzCPrVS91Jha1JeMIUnjbTWpFeSxdrXWarPgEOA0YEaPMqEE7KDfWy8wTYo0gplRLVRllFWc//U+TwfvoDJXp5eiEHNa0aAG/Zg4NRCY1w2AYSgBNK7edQnAfF9cMfVLcdot0OgR39V2AeGiEBNwIt6oeFy8/+kyqx3VF+unMp7Qvmlzr7wPePZB/TprrdYE2Q5SpiDm+sBGGcltl6ok+wF25LoDxm+LwBJQfqvN+Q/kZMcToWigVJfP0VBRnIupPR/A9zXkUngb2jWwVTqj4/hZaj6fKPhdWUdpMMeIz0IJg2chfDllvKN0zOZk5GwEfhFUZIZ8lsTBv+96LfElIZi92fZn7x037GaRt6F5ayRtBcMXOdl2NhM0OJkBpXFKBLi8Cis2ON8+S4YNBDCCQEKxQjOJ1ja0Q9mAx1j7IQv01qFR4Bj5xfm3KbHkBzjpUwFpFBeumrAd4RW0oPXpYIbKOwYBaCUPi7pLXc9j4BdU3TYz4lJ2wZvNslYY8Os/TdyO+rXLddSXppdmSGsBwAN7fyiC/MhcLQ2PysE0AwAT6Bx4ygCZp2bSvAxajB94l/bnqV1dfFgOkQ+9Yod7gLMQ+AakRCeB7ABZ8EgUXqf65FWNKMf6hvwWvDv9m+VyN1dvU8+BQqPbcd272mPenZmUEf2OIxVnH+zYHwotJ2naCCOSjvtYiEasEJm6b7HUv7eKLJail3zGR1LSmbRMJuDSqQa/4cHJgOdda+lHVrBpIcesqC9ZKoF/TTwPthcRaE0FLsHTNsjHJi3fp2C1xl+PIMszO3RNe22rrTriG/fNz3D2nIVUmmD8BdrcvAVvKwdtb/nCP8JS9hwkQcKqZ0io8xIfm4IS0Dd9kmRXr/f7jTCb0Och1U+c+Pw/tkxoP2ouoklKREjSIAY5iQC+okd5eXNhixll/ObeaqeN4jmBYwAwxS5grV7dmNZd++K7O2Db77hX6b0U9rqBzrE5AkyWHbdSrqeuj+drE3eOGSJowazfnPrUKZuN6eSOq+Zt6PvAKdUZ18A68oZGh+eH4Xc7rX+PjJ0Utk+WO26LU++6MIAmWWHDmkgjRUa1rcc9z0OMXjGyIScb8f2H4qYm4/+QAp7IOOmK/iil+sbQFHrFzLS+zSGhQFUmDPIhO26nTnygRG7Z2AbjYMvHFoM7SUWIe4/XbCQlGjwwZuuXbgd0fCmZK0Y05KNQWXc0eX7jnJzU0hbCYhJ5amp5i1mdavzngyv1GyduQDU+H7RcPyPqB8Vs8XrgmZD7Kqq9h6w5WsLfJiD/URytKoW2nFgD3uYsFAOqm0Z73z0nsy4eGU/5NkkogQAySg5d3OEOKEZ27tvKcEjZa2iUPGEaUClrYf+tBgR682BczzA+mPdPY6TGTsOkXJ16r6f2ir1LaVybJsCCWCeZ0lpbBcOZZ5XwIWpZJ/izDzjz4dtKYpYEa4ZTLyPiy4M4uB6Epg0lXe9xc8XGex+SLIU4zIWlK5Zs6C9abK7UlSfTM7Gzh1XZk3lt0T4BtD9tCg/KsbPx5ROxnmHWzrsR3a7eGAbYidAwgaS1fGllTEaV+jdjJtzWzeWX70/2CIsxbppB3Yac5hO1YDzrNtawjWCXtWflM6CRyGvgiAL/BUuYIJsaTW3DLiKl0/G5kkpdab06rfLQDTpbn9dgRaR02HFGNTqf92D+z3+kPAUApFoWo9+qFvNYzvoFjpg1A/30PsjL43+jYD420YUoL6orHpRH31dxwPXid5t2nMe+ibSL10gNY8tmBzV/mBkFg32yBg7OIOxJyhVfG5Rg0P9Y6NHDnNuXd/ZHM81TmsOTkI/rDZ4qkF8YzN2fuS/NWSZKpOI8zw1FiSkVut7EBI7vjYDxQ9O+HE04QJyXc+FL2i5J+WifffHHapnfX7KC8b741pmZddYmFFj8hrJdZc8Dliw5EsgxmeiPN/VzH1BzifrsEw1g4z0YJODeUjqZiYZ92dG+BtX/xbE6fSvAMqSFysUzn3s+9exROfT4b0ze5hALnODVwSolqc4QyJ98DmiS9VdWMgdKD5OmA4wHyNoKJMlpdRC2IX+9rJgMOP5NUAJo/9b6Hw9ebl1i0SxU0G1MJatkovdtpNNadLNjp/PLWgFKvQonqk95ILU8Ow2OKNM1xmneugQeVS43DIABBdIkyobKARdqMqb2J50rW93uh3fS0o3w9Q1LZMRVszYhEhzmzkbbj/E7W/HSlva3BNlAB/1RHQW5JKoOBvP9Jbs158xr5pDsv16017mjY2NNgoIOd69vZg4VyF9LsXwTdysvPr3mFDeswyHINQJQ/4gQhiep60q4rHtXwpb4LZXIbb/vUTLRzch4Uu+9CWke2weGDqXZdcrMdF+EdLTHfgJ7dTIlC9CKeVrSN1JkTyraimbDLDiWEjDaeZVXb7bpfvwpgKc4fvF99vmaCYj+T+7O3bA9o3+W6hORYJpv9/hZVtrlA1dMvF1OWfcMHGx3U4ADVrhSyGGX32gW6g5U4xOeyPdOcQ3JpjV11wVXmMkZ6HI6d/7pn4+eeA0mnEfHlmNbTTsKun/PClgGNtAmpF7yYTuvp1liIm0wynPrudtfIQ0LTDywryXoeKRTxAJC9avmDFo2U1WJOsKaoSMt0oi4wL760IecmHMZc6Fp3HQ+XwgoBlMlCqTX3phMfucR4IrTSzFy4RKDMmXbWzsbYpvqpEemEb5YlR1GvsRli11DMTkFZzkguiJS5+FEyLVIVvGVi4k8xmSi6Oy1uu1mZKREKyotNzIQ6Hsoq7GGWGB9u7yPS9SJR+bSiySWLtUPZOj95py+UB1HQq8NJJYYt8DM0y4VNwdD+p+++fJwwGCN4sAur2PIkFgv2NhxgmWYFZXDbCBPD1NCj3ubF/ZSoQXXvMSqQjOGEmsqfGtWGbUsG1zwDKMK0LPujxataRzMGpnWwMs/UbaIYpfxN09onWkir/xtdKFoTtI8mNY1LNpe7Z8DKheo4KhiVPM8IppPnt5+EjERR4XXwid1CgJWePEY+aOboaLocoUyTGMUkAceb4JSMeCjIoxuLh7ZwhZXLAQdHdXajgjV5A7VndyQVW/R94DVpY3iStkcX/Ju8CbJmV9ijgA7+c3l7x3JvZd0mDwmlXu4dLOZdVU6maN+gswWCpLGOa6tBfvRhF+JKfJ+yBH/bFaXq2cNJg+4ZGLAypp4P+NTNVFygpFQ7XMyZ9DTcDaLpiM3B0wokpdNTgPUBXGQgffoHmnErW5+z8J7J4AeI4B4NaJhcWHhSGC06G424WpMELJczCp8ipI/ihEVxpEW/YwMSmeMJvlj2ZJdgE97Nx5Hl2Cc716TvDbVwmHg0BxBvPegHDb0QPkCLVt1rbzITWIoe/LMRG7ZXIxxLozqjiDGnIrZSwYxH+2gRqFanGWWuFTZo+OS2NlLgkUqVsGV3jzQummKIUjoZ5ZJLBKJMiWHVU+h44/I3i1S6YoedeL3RF3g9E5kfRNv3YC4iONB0kUYjqDpBkqFmMGVQVaQLpwAMMSqKNXOJuCY8/iX6dC5VGJYFcAEUFkhDpWtes3cOd2FcXzG5ooFcsuCtGl0WJZPuMuzvlHApvtN66XvTtvrAGGd/5StbsnDk2gqkm63zwbOk9sD9DnaWS1rR0OuoIX7goFwne7WrhBAq21twbG5PjchzeeFsJVdW10rRvQ7vfFtdtVvAI2EYN6/AU7VxA37xGPmgsAQrkF8OD5uoSkd3RXGX2UpMQpQIEE3JW7oXyIBbuqWd77lR5qctY3JwdT1lfVCduHKWI3VwSi31a2mX+YNLR9ClneMudqTLRlIdix86RaWUT1wOMmbaNTvpvFSmiN5Vh8zNX4R/hL86GilaxEsgukD8V78a8EQrvzxsHE4EY23AQfykSMjjIRkg1cBmcedp72xYJdnqq8k1HvwRRVUWqwM1Cmw5KTyit3pfIk/OFJlUFirZISlkAMI0egyTWqrlT73YUB/dsu1uLDgXDKko1MGOBEtUnYyoy6J1VJXQ4EYohb5EX6iuGvuHlhX9NbF5iLq4LwL/3za/aGYCZpth5Bvl4+uy4MEJQHmaPkumJGZOzHO3nnYiFRBdwIdoBag5Zl9IkBremTiwVL4cULMVgP9l36UbeoeMIW19iLYG7Z156Q7URZZKIjOJr7sHBkqeqn9jggAkcQMSv2aXaMZ6EKVbijAkMdxfNBx/VBY80c6qR+RUermvGMak1+AxLL25cW1wQ72VwOqq51K93j7XY4UX/is/cjwjde8/K9PaiRcQLzi2nlAQqk5NJ0pwf8uAHA14izKI0kBcHELGx8eRrYYh6LeDxpeo8LfcjkngcGfjcJ5/SLu81fp1oLH4+4kWP4kuAb2nK6XVzjJCn7uZu/xqNWAiiCgEl6PEpYdTtpSYu1j/Ay0AERXyeyKzwgC1grZQQ/PQhmwWJSUHDGEJPQ/64MSQm/cDTsmriL8CmP4t1Nrmnm7otnDwglwZ8CVhMDvwhvcnZSo/7yoRza83Dwd5SvMN1bz5B0mYR9sbULK8pV3bj2vYVdJNCPANk09tIoV3962DApBT2g6o9weH3CkAeVToYlhgf4JDhFe50idtCxEMBYDS8uAOlXvp13sumyn3OLo+ZM7FnVDcqv/4xJEmXf7XeXuClu/gGONgcMm6RC32CJzXMzg0RBKy3RuDc3j2sULuJ2WbqVea2S47+fg/iU69Poujw3CJqcHwTY4qxa8PdV3OgGd9OuPsriQIWyhmYRR08Yakc7j2/k8hlroRlNIyshjIgNzAaQycCR8DtTM0GV3C5ePWpp49ppDJbnUJZ5lKBzZuejXnQ37/1DwwBk7XLxkSLa/OCNxRyjzffpVcscwfpKy4+GeHeRtZXmbglEU+oafQAdvn5sGq6+dluzrel8ZzdTtDH9MIFFWlTF2MYsbwBFlV1jnnZIIiJhuyVax6HZqPHkTpK5jfyXTtxpFI1cERqLMT6uzRSs17Ix16Eb23wobOiQ1tRdmVj7hdIQ1OXjCP0+JlCDiPLXDXVrKqaJ4X+KLLQ/ZnMH4h9tZ65DXVkrn8tf6KKXB78hwBPsGSj7qiMLKXcyJue3twZzkJ/IxbeS00iZxM8cGE4svGg5D5OC7NOB/f5sJiV4IWzZKEmccRJPc1DeA6Yt3IayHsVCEdsi0sCnIcv5Y5i8gFJvlWmnKUxVbpGOk6iiZ7rY0VYDS7eCs7mwtnVkrblPei34jxs/wSeuCNaGnRmtjYRzU3xxYDs1Y7JGIsUUg4g1sMmFC0NoieSyzD4HAjKwQuAv4EAXCFYfo1Rkm1Dd0xrDTmWIB20p1BJGtuY9vsLzB55ozTU0nR5CQ3/zIdRDLMCbT4m32IA59r9SOBtml+RFiqnagpjO6f61KjYOUHFllcyol7qg0XNxQuHeAAPWVuA5WcchMO8m68WwVhtBYUHfm4ssDnsNp4jSo1MQ/sv852xwshMBv7i6tDSrPiETAAt+cQKg6+3TSvIKMeGl3F+pGuC3ZOi/HcMQgxtXnpJeIk69fOFmzaDJge4pzRCVnz12vekfMbA8YlM01ycoywC2H3OT0VRfNBL0TtIf4S45IX0uPMRBcm9RIwhiDe7a8+F/h4bSUv2+Yno+sOXhNlrFOJfKnLrNjZAaYqLf7HmJGmCiy7sdBjfVs455XWdIhoIA7xDccAEWOreK7afhHD7z+EB5+1voMD14MkbL6BfIwsPDH0FuA5KSGyKXyoJ1TjBObs8Yny8vXeAkN975rDQiapZF/e+GlyfoLn7YQ4E+LDSFfgMtX2zJg1uNWTcsejnABcmDHskowqJOOKdPASz/DUHEAQcbvVAYuMsPSh5tLO/IpMMxBRMCrzbp4wtOcmnttdbpeZtw45R7uhHfmrcwGCzy7ukvrMvzfIptJfQM/oHLTUKc3tzPgaB47E0gt8RjMzV70AJcCCrhtqmOM6+tKpl/uIq10o0KxtbZb9E/rQ9DnRL0GtlD1N8IEebLQpd2sbisRvhQoPY2M0YJt5wFtVXPpqJOnv3uZT0cfOjL6KcMy/iCpirCipas3ZvTEez1g7h+TKDrGZFjQVxAIeUixh2KjC2uMy1uz4yLcc3bHNloBsJJNHl2Ly8NfhUJaVMfIm32tPrjcdvQ4LdEuDi0mOhYii+ZpXepRZHqdsZcTu3De72ouKCEpo//NV4W2bi2Vm4/BG3a8y589SsG8Tjh/dM/Ng5a39Mwbhu6BB13CjG+X+WoTzAcA4A9YhaoRB4+du7p0O504AnWBkPgxPz3fV1mYVtsKDpMMzvo4Rom0UnNHSz2agjCvaN4Fw8oyHQcAUAqeAjoTqj13d4qpv1ah0I2Qfd+Ww8CV/bm2XadFKu4lz4n6Ala3yI+ThxoirHlkNiI2LANIzdKtUTkgmVgYZOy5//SzRJklPYgrQy2+1OwGOH/tuZsF0KDgZGTvn13glsR0DWLUMkOrE3Voa9h9ua73Q01oazCJBaWSvj6NzRzx5/zkI5wUfVnjEzeygniHLbnGHxqTLs61epNokS6iibbGoNj01U0F6TGxd6iP/YEIQb2XY/jzt3sdzSgKMCbJzrRkBNiNoKBjYGHdOaHrDbLuwJSgH+Z5VM/RPMHXCvQ1xgee1ouy/Dva9qlOR2rDKqX+1bfvFjDtLzrUmErRNyaGx+fd5zaL61u6EXNmchdUQp+r3Xopn9Nhnrt4DjWv/6SPtDIqIZpiR+Jg30z7M+wVUsbUJDTqETu33PqShwQxBKZ6YlZlzwBF4GPEXtCAlQIt1Tbvd1w7PpTMn6956B0y9Mis8cduZy9qEPU+d0UhRQcV34IGa6wjvhj3KyCC1M+sRJGPaBWfoq7UxjI7kQOMvOyptWsSPZfjHN74Nanv1wxSCI5pcuS8z42BPhUmLZVGRuurSgldAWXJhIkzUpQBRJDA9NaKLSyLP/wxcWqE/qxygvVp9PBwhvSdVv2bYem+42XS5XoMqxL3yxhIu5bApL0H6lENUAb3BqzlFB5g+NXEyt5M/m/hUNf723C3r1LbeR8SBx0bi7dEAhFHopFwqb1haNRqxNhuTWWzi9uCJhAjOH0G//Hqb0Aq1O7/oEaCFt5dnENv8syQLda9MT/EKf889lkNdKRvaisxl3Rd3ua5OKComHS8fSftnN44Yryu0KQtDFzEcOrT/PFBISuNKl9c6p18XhKfO9sPGuXKdcw45w8Mi7P9roG6z4Rp71H43VGUJRzbX0taloOX2r8jSzTNdajhX+Ou7cPQxlTIoNYHQjB5tkI3exF9mHaSafR/lE9So5ZGfsJoW/DoD8qvNvmoTy3dJodWyMsk3H73fgV6C7xXcfffO2Entcq3i1Q8yth+9dV/6HFE1pLL+opQZuKWhiosqWEv50Z2i4r5DTTeYsyCAgW2m+FSdMGZyJZ/vNiZYEjyiApB4/mKAaJqPqaxsk07/Hci+UHtvlqqItG0ZadB6gh/9aXCeRw/o6XBce9C3l1fjnOU8Fa4p+ZJAO1GB89225rbFig1jTkYIxA+AU9R2tys7sQgDg2soIGi+tvanqm3Qj7Am30TmY8PWOblMt6Rj7GAzvEbpNtSQks0hSvFicajmbWjMxJ5KJ+O9RnE1KHlNYBNnqyQL+Qtey8aivEiOQmpRYB+j9IheltIHiw0PyuAKcwKheRiZIRztneka6urbC2FlGbzfS6A7GuFWcuejGWMrgl0vSF1HotsbPHUkc59COFyYgYbg4xCZ6gRzdo+9b8WtvAQ4E0g4m0U9tL+49qJKTQj/FpfRJotBCAv1QVuqnhJfY2c4wzzO++ghC+l1PMYaPp4arSEw4i8s+O+uKvNXDsMu5igiYvy+DueWaGD5r5angHq5kSYzDkp4MzQZRwdwy880WRSis7rA1PJmz30lY4gH0OiPM7rWt2sKLQCy6DMdU0kNuoQrzwLHlUhJe0yYHFBMz7MKwyAm1G06j0wShkY/1rN9/pUDubS/CrJ84XqibLB5Qc4Ljz28226qPuZtNBUc44sVT182fYOEK7Bz1bWdp+wAS9F1h9ufb8n45qt+5xA3IrxqpyzrJw9j1yjFfh2Zt05dTCePdwiDJqKGeDYEx4D96ztZcgWlFacAmNavmMQUu1Tg98dxmuADREceXpdNFSau4OtrbbG0Df5PeW6BM8WaG4qu9cm0a9yJ1MTyD5PrdlkF2F0vYRadPO52nA9g4oVE9PVeB9bDCociwPCoNFRb+p8D6pOyI8/ht2szKn5q/wDBRbb4Y7vtGAkOeyauPQgJEEt/t09ea6BA/BtTPqySbw5Il5KBKmCLwWE0sBfbp+UaUyPdIC4jOyyviOF2nu3EaNxfMgkzrNLa0HH//s48oSVLkWxGc73LxVpam7qgCcQVPtcUcJ1xut9uplZkTpQNkWdgK29g+eiPzBAdeUbxGShLKs7NZVBjufqgmZw50+gwf+IbtGaXCr1XUYWKtHmt0Vfw5taZiAzGI/PXMy5qiaE2JJqVfBIoBOOc8H3TdlSMfvI9i1QPlyXjl0LRsIvykSr/egiBC7Xg0BipE+yqL81HN9qT8DxEuoDhsiaGKkkB09G8Rhj7x1l1VgCXbFM4qEQRf1Ypjee+Kh5+B7ovIzmWHoVlOY0ySGhdcJaaTG70N1exeM8sovqj/wtTVufwsxtgm9YbRPS2HIErGl0Bz7py16yoQoylRP2vqbte0rnvQI2Joj7K+ljYOaLiVRTokdL7kSMPBvg3QWKRQ2VbVJHcQQjlUpiL1KyTDdC+JZ8mdeE5RnJbMVsBuC7sjTXctCcOJt8OzYorW7QPAbQrnjA6Z9M3JpjT+IgbVxTJ/mAcFbGxYsU1Wg4SQrrxpGDYvS5nH4AiMFKvBw8GOO4i+rBYpXF/7EzEYd2YBG+p1NPDf3qJ3rq/G7bqG4zmLqz2lUvXiBOuDe6NrZf7MW1nGoot7DaRWjov8idafMC/JlY7dQ8gcKxF3NlbXB8Di6DwLyaWxgiYlUWWPSOkHVUeq4tqZAn/ribtJQyYgzvffnhwJe9C1blQADQgseCoUVsnz16/HLzWoyEWvgGSouSlJFA3WWc6Gut3iK/Kmee/+JPSdDtWH/wVrNQkz0zc0qy5WE2Xtb52Qsk4dQjONe2FqgQxZEVY+qDRaIXLjECG1lKBRiq+w2GgNK6tQJtK8q0Ta/op+aZtgV8V1TLSP/TAoWp/+U8W6GPC7lCNlmqguQAW7ZXbv+xeLwAbOwX9xuId4TxotBOSuhG5r/1LsN24tmnZF47Ur4E45DBa7ZmyNR93i058/LXVXWgJ+1Np3lfY5uIcocPbJRN3XJblz7NaWA1QNIUb4XczvHobA314XK/6MjZZrx308reCb0X65fc8/vu+GmK6NjGFhMZNYa5IcQR5q2uK/rEP+ymBLKVPH57UCIyx96dSWbYqZtdAolbtfKsLCtorW6inUeiiaMYqFMSbVrWvSghHQ5jI8TV+6y/R49riJZl0pWorDN5law22mGe1K+FAG/QpTIzZSfRtCDoP7myZjLQEelt07F8H+0c6iHl0llZzke8jdwG9qk+GcVKmydcUYpyVqvBMA2Dl2ZCmYsLP+nKIznunzsxrXYayhdle5qiJkTTs/9/lM1aDciu6jvXNLwTMqxVRjcoX74mdiXgiBOuFBWvwi+FcKhpcivkvwm9R3FcY4cMcym+oOFiRnC694rYAPQpyEkwdmYjJk0G+t58L9S5X0A3vCJfgLPI2hbxwFRDCdpj9QKK12J7jESFdI6R69Yf3F3Ed3OXFfQks4a+HXdezwUW2LxCeuYN8WAnkUAZafNZjlHgLAvXqCe8AVJOiY7Ldx2xRy62CWLw4K2cBwLH5SfWTtZfgjdfU9b6zQoWMyroNo8vOrtPchH6DIpi58x2yI/6zWk3fW11TP4BAT6q3yZAtEjsSP4urMt54J0mv7i17APvW4nTRa4txc470fXys3+qaLQode9asXc9B9Szd5mWLodjKAGJfGsm4s5rQEwVaBonVGfY7atzFzE2DEYioWZHXa8ZqldQZHKnQu4zdskBuZfI5J/D0iGGF5QkhWc6zK+bIp6/Fksio7rBcj12zsAOBL5snp5e8SNfRlxmx7LuVxyz0eHWPYEp9qNNV4gaClj5figwpxfWmg63YdkBS49y6oQpGhcfZmg/ym6Kri5G3GAjr2OfAn/svlSc8PVbJPPdRsxE4FQvqd4FOmW3FCJyTgwG3wyDFn7k/RytAf80vCNbQcZ9wrfpMb4HvKYqzhgk4Fufsn78JFbzabpuCZKKSJgloZQ9HirZ5e6M+k/mXkalIdt0bD6TaFAFi/S9wBAkSwDAPHVWOm5bRqL/mFuwNyEiEtlWv0ludv44Wdy006YPTeUp2v1HTSQoa92Hv6ZOC+Mdxp3SSBCJx8DJTdGqpQr6kbkuNZAoFYvwaRcJu3bzbqMFqavjjFTPwSVMboJhs7pDeP22z1B1jWz9CbUjDOmLB1gnm8hLt+CHrLEYmuWAYrji1Pk/CaekbAjWDlzPRhn6iPpbGJEvMjjhCL/KD2SEjqBFn7Qs7RjrfBuuE4olU5YsmBkEsosH1+xVXzV1toP8fcbNOgs4RFlRNtYDKjqdd4EI0xpQ25AR8EafZoPRqEdTxyOMFJESAXcjpJTHuHAkeynI7EIW3f5qoFEHetjPctF/tWH6zLhGiRJ+dk8RA/2foGCJQ2OSeqphIAzSNDDvnseAu/6GPd8h0FseXrBp9mwkVjlnDO3tnnn49RhAi7Tn/lCxWk8W6v7dcCyFU2QGSs3vwUYelzyIizF/VM+XrfSwUs5oMRbxNItdExHuHJHZQwVOgclOO/uwlYw3jGvWsLuqiyVIxnr7jdLiv50I+bur5FLm1wwYfSsfUTb78ZeLfpMA3bqnWdK/OfRm8ziCVAoPOJFfvnbRiL+hmH9cyqgmBHPg+DQYHV5OJu7HRAS9YDU1n1muthuFThOCxa16+UVkVIlEXvDEL7vRyz8rPzzbGGSEze6u4W/3jbodckLGB8gXVSd0XKAh13YUvTFGZyeeTCdQQCSIXm2xZWLZegOYeWOQATjm5lt17hmzzhormDRTC6Ut5pqqaKpfE9dyMc4Fue1oQ80OQLopzeQbqiFNfZ1iutKB3Se4epA/vf5k7AxD5nw7ozLtYqI/WBWNYkjCj0khGTwMjAt/N38Nwdh3W9o912h3grT7gONot6oXS/allDDdFNIsmbQokJMdp+RPaJtsVQlvWBK8VD+H0usei83hjZD/s2fGhewTiPW9OnlAaAbK+MitoMkrjlx/oCmuxmN10FEJBpdnbskKn+Wrr58mYH76t8iM3JrkyQxp1ZK9AWKkxs/CC0K7Kj7pi3aSBsjCo6Li2bpXvYE2ie6G4QgUNN0deJovezu02cfsypr8/6KtCZI+C3E+cefxNzDJrnEamGs9hYN4Dn3isYCUxGJFyxEZ+MQLRkN0rdsTi0sQejhym+t/qshMi1+hi9tmjkuq+wFINp89q90Gfiw/NkmRrMwf64SlJXLyz2BcIsIt+tjS9b6TjIvbSy4QBPKYIZ1QPVfxYEij200PjubZ+VQRz63cLSQwrk2gafsW2LSP/cbo4L6lZKDi3GMQBlfHSNk1qHkxr+TlqByYuBmD/uQjwPnREnJzu6SvXFZxx6EIxWBKrYK6PDkRY7nrkYWmk1ZqYMv2s8CXudzGBAXLWgx8Qn0hNnpeq0PqLvF2jF0F2h0nJ+w+ZDXn4CMG85e0qw9l95PFOGYk3lT/L1nVrdz+fQsFYnK/JbqSuY88jJLDA5YQtz+4o80VpdJbTOUDHxdeuP09pqMGQ59ecK/E9IbFJ9r+GJLz37W6B457QjQra4jfXCc41k6OUm3daNKiOewN8uxWjiwA2QvJnUUcGsLE9iI1vlqKJnyhjEvRSndWnUT0ua9zd1V3FZDM90Pz2QxjHxHanYFsa68eznYKqnWb1sMjh2cfIympapB4aHabJBGK2Y83bBO7bc2CftcYf14zPcRCD1l1VLSh60OjBKslsOkKPrBmbAdor0T1/Rp/yFhdaLrOwG5bpkrlf/jAnOaqPATDOPViS/2eYnumdFwGnlvz6AitU1FJ11prbz7N2IS2sd2RDTClEww8pbsH4UI+bbEBtbIQd4IMeTDxqMdGjEF2LygC6HunLdaUdBzb7qVkb33JsvqsmsOq5XMGMk/Jrdz9G7MOaoEaAQVlUBrG6wj6IOJdHTxmipm+PSd/IWZYm7SV6x2xuinrWaamC2K+laglEUIIq6rOPP2BpEBLjWBCD73cpH8aXdW2ZdqhwFJbJFs/yIdJStbqMV9OhnB4GQaRpoa21tGdHgrXE1XJz7DGFcOjQv80+3N38rUHoHuRpwBkIIXaWsTNeoB0CGxZMds+QtWBpHV0iV9QXIL0Gznlnz0nh9oLNw2DEbWG5GuON0E95ESsc80g9+bsxgC9teUtSs+tXujTZr//eJ4xfLPGPODrMrcx24xpLwDrBJzgZS4r5bxoemNajuk/jfC1CkcQrBZ2H7hfiJis/DBuXnE63lJuoljVjMnZWM559pEkJi6j2lXGNo6UtiaMAYquEKCPGCfQWlBfRUwcwelbCrHCzYAVRWjQ35NPixCsqM8csq/fwfbYvIrO4vihXIYAmdDeIBQJ4j16fNd9ps2o7wskGR7km+882VnAxMCK8KCU7gSoY62+O8gRysMzRHc4qP/yNgUbc6u+o8iV+tUpX3jpJxP3qOBWm6n0e4+bKqMqiNC0OxdoCsVUrbEv5O3oCkxwCJBVndjF6qXD8q3FQxy5mD7VDvSjyukNkEdsI0ZOS/VWM8RW9MPBpXMGpXMD9vRJmoSJQApGmbxCElw+/kfK8i1O0CvWxdSThjtvkh078YuaZB8aYcU2IWMhlnE5aU6/lL/CNoBx6pG9dOt1dZPWNDArnuhbFjYChiW/GNFTr7CNU3w68gYpTTYgBRlQy5p2NV1LFHbFQlOKmXd2Q6I1naPyfejj91pYScQgsB+VtVpzS7vfWpm97VlGYa4Y55jv4EMCA7Iv4n1XuA9RSgn0A90L4lKvmy3CmrS6Wgz54vim/R9YkwPvLOgqMQydHJB/96dDWJAYA5cbu8KsRjXWkqtt3GgoNr8yjSFx0CFLusmMeul/4ueX+jxU2Vvk1ImjLfp+PuF/dp+qUQxX7RVw10flPeLo5Uw9PiRFJaPnucUyry4QAEtgG+vjO9uvlMzaz38xK+ZcoRkZi5HwmtQKYublw/g7TrmapHiGJQA9VH/WITjMuoErubiZM54kGtzCLGQ/mq2g9r+ey53VYRzsjC/7OTz7nT4C8XiNHvaRGmtO9TXrFkcudwrwH4M0NkWJ1z0It4TUUjM1agJlGA7ggW6Prw54DyRu+gAN2yphNXca3IE/nJf/ctjYEAbnUSC10FGsFKZ1GXHRUENQEbGe1o+b6gT+y5lZ5+GU+l4R0bgl9cIbLd2/bW8KYgbZzl82BXqefH8bmqAke0sz++CovSdq0lXwdn+B1oTa2xMSd9G3YPerO9QAdcfQuRegkwZQGOzqT9QNlQ8Zep35Si/suKlqtDtbavc/fIkYCT15468n27auMtdL96IAXAmzT5JJyIFpnDyPNirTpvATCz4oFPIlZ1j0zDAi5LtTWY9cxQ8yU+6MlnwbFALEO2KjsQ9TLGUFTBEso1hQoHfAjHlwqfwUX3ZqTuu5Dzutvw/Saf6nSUpZFkGZyoEd8tzS7OnXLwoc/6U9x2k0vN4UVXrlNiZRkJGBNlpEaN9m4tA7XE+fXIZSK4li7FSY62WfoRa3nHbvkkzYw2BO6ll7cy9i/fXQH8RudjkjrTPNsevunOLW91qBnWhIcxQCLtzFaql8J+pmQwtGOJ7YD5UuZMJgg9St3qotjsMwDRN4Vd8wxwR3yDMkBMMUpuL2It96SxEcXLjZuAs9zulmKc9ndTzGUAQ3439dRaK7CfqghaxbPbnk7H2Wix0oiYk2MhIcOvgIxUWni0OKCfP9fxHpB5S+/6hABcM192hOZ7d9/dO0Pa86vexoTF6R1I3f7nJiszOUWSlVE6zvTH7lzdJ6035VVQ0BvBlECJV7Lut6s1Lt0Jmu7bK3E2Cr4wXAjsrAzlrvei15wtnqA1MtROZ4BOegHKP0g+kVo15rTV0FGiQAGzLPBFqNMxCnPaQ0ZJw4BXIZfziTThmMZ4jZLssRPF14lmWp2ALLvtzomlYHxN0IG+T2Zrn3dxGa5sSEvn3SwM0qGRHY93gPeTaAPGeImFdoDLcuAw2m1wimB2T8KJ24aMRi8rF1Lwt6kUAjNl0vEVCtsCIV/p1SzvrAYNIQGW+W2WWkbC3JFGvyqJTrTXU6fyGIUaEAgJbPSDxYgtDK4OzKZnCMzOTVp+T9QVsNEUUoTgtRuJJ87arTQYrMd2ctFZ6toqRZylCLsWVADwar7B+kOWTnKe47dRjBpag8FvraveCmycb5Yn/G2Q7fijzpCadkLg0M0DkRJ6Y13slsCSTf9Bov0ctQkHViyCgPiEyLEl/wqs9aoWZ7918vl5AhyPbvlF8f843geH/xnIkVkbMXok+j1TRXCuWCHUWAsPYOeELTu28ia624A43SUUKnj/+mfLmLHPRFrvY47CBI5eHau4h+WHVWMA5KENUt3iUnR3MTLmoCBdSlrS7Vd7yGBmk1D0yA/bygB/Bi14GksdXReK971EumzzaUoR77gk2eEtAGklwHGu8Y7HtwMUroENuHUuvacVAdHpxX7z+NdGHzS+V4/+J/jCgofU70eBdqAwSn5w6rpW+Xd0nZ8pfFU7nVK2Q9EBm/Yz1+UVpP2u9143L/Py2owCWc3nSZ0xP0u91fUiDOmjnPxYKBic26NDlYQV0xW+ggYlbJamE+xG/dxIFFC0GO/3vubf2Sj3EC8Bqb64JF/KrCAqDCuSC+4xzbMVYgGeY0NjT/7R4YQw7jgsYrc4bR47yekaIV907CGQzUcYydLuZKwFxteMOKo3vUJqvNsxfoXCl004TTxrHx+7vHpgbHFp2L7pObrjgweSKluxuIjJafY1I2Obf+eU9bowl7RCTjkoH+3axqpNRrX1aO3QUHBmTBzECLPHpON9MI5qEHbgSAZa7DlEfitZ5n1IdNRwnJok626Lo52KPZNYnKZSlt4H4q/fSZCuTpAH1NSMPsNBctadaz+cmfp8SBWS2i4SYMzKgO0LoBMTPt2vbrFtVpIpp+Z/KNw9E67LDs1LjlWRcOIOkqEjNeZE8RrHnLD6ohhge9a7vx4QXZZ8V09wysamGJDQMLExETM9Ip7xj3UUp/NeBqiIc6AtQIPHQJZHeuEJ4Ec4b6n60elNKmiv7FXiy4B99gjXQsddedNUJLW/Shc+sQLf5AZOhIYwR2a2TuwCzeUVSdqW7PiXxZY/B9rmWRSTF9v1KxbNsZiKMHQ7y35xGrvCvJqJgNnLX6YZyfL3DB5efvkmfWijrbyDhS/fT3JY57+Kr0yaJS/lub0zdrwAKKSWBAr3DJzbyMbLXDbqkDqbaGU3dTBS3WU+ZMhfEYeDolRh11pOhj5OCOO3XEjyy2hWXhBHob+caaPG9KuzSw8UxbvxaSkM3TrX3l4Tklfi7VU32jxygkoe50Tjhpb8CKlK1L1XhskEmJB0cFcwQKtoXE0FmfGdJmhQSRMCBIoY6FA4SFsQsLCPdtMWKJwhkdXixd/qDgwpTZgiu/qmx5LSjOKpT9qtdssSQ+9J48F7LJcniWWdGLRz3gazUvfR0yQY0ECeGpCTILiEz2DYpOamsOi4OJduC6Oac6yRtN+kjNBQb1Wi2QaaU7hu8CBGZc93iKHx+mFgcX38x89oh615nr1ISqSOm+zAJi9ZvJX3CbRfciDI/Ci5B0X/vBd7ffsR2kB+KFE3oe/xchlD1+BWSPtJV5Kvt+T2hUSh6gIbFAlFSmVZoht4Kf8nSGxPbd+29bD4Vjz932UQ2BubYXvVfBOCdIuI5WJo2R99PnlJVvqEPBLDUXO/cv4EtRHIYuS5jH9YLkfJfkVVbHBJHMYqBOCQBFMq2RcfNSOZVkar3baiySG/PPcIfKTDk7AQuPpBD0OKJdljtJaL8Xlc7zq5CTqWJfsHV/yIblWzWm5IJ5CfK1KklD4VrDYnbAMIBnCK3lIgL19867NV8Tqr9RkdGseODMj8csQsZMFfzWZtrGG1NOllXk/e7g7h5t4NTejJyMXh+3SRvYcHX9lKdBuybU6fC2hAeHGiYhrsMcU41TGDIhiD6KtXNiR4xkfwTj/SlGmdyixPIKz1RTdR22Aa/RO6a3nlcnyN/uzWPCroVymDZle3UihoKJZiktuB6kKCudtvqt/7wG5jJ+pd6MwzKp/JH+JClzXMgYV2XwlHGnD5JhZP5IXkfKWAqgDW341Bbd7zDfXZDF0k/U4Z/1iFYDeqkDynD+te5q1MWEPa5qCK+dGaekfxg2Lr+dsNK2eS0XYiYHRVHr3QIJOvNxFCtMyBaTTQRQJCuTYKQ5Ghm1x8Dj1RHZk7MsZXM4G+yDSh0jpFu5jtetg+22BEJJvNRMR+3v+eMC0g/FcDW+BOczrX2hlgXFxuom9GO6SnNcK8fRV0w4cBtLiG1RmgyeeC9OhA5dGXlrOcoUQDi9B0Lr5ZjgA8g6Z7alqTKIDP/ZhVTAmDCpZ7KXZBFzralqkbsJKeEcm3VFll6YM8aTMsCIjTwW127xN4A3rkXO4CF4/3QJ2EjmzuYunZaxeMhj+tjLBUqc85s7rn3RxoY30nM7QRswPDDAD44jYgnL+lkEXd3QybO2quQULyvDWLNY3aYsdq5UFG8kH7/uuwsVKPnhGnk80mzAvati9tgoUkCDT7Zh4PJ0Sj09GwzUL+hJwZZ0CNq8dETKOqfrwLsC77XhooxoF376kn6ZNDwZ+41Leptet8DiK0kQDxesfeVJAe2zE+r5n1b9f9L/f+GyhTmZnq2a5AbAcYZsH92gv3TsUKa4vHXMcLpjG2hLVs0owvldqrWbUMehE0YnLes/s3eky6c7Vkct4Ip0Wpq9qLru4iE6p0I3n2FQSo5hMNZszaeP8q/C2GI6obDZ+bnLpn+SsFCJPNNYBZlYh37KOZmC8Yfvj4/tUNExrxSYfeT24CFB3IYK58eGSDuoL1CzsSF/iFqEhwrTGB9V2CuzE2CDqwhEspsBoFWuD7JAL8i5hxPnoPnH9AiHVIhqjGjiQp6hBbgMQ5mgByzudvyFFvU26vP3BRrRL5t4koB1bij5QtCo3cDW1ciD2d2u7ZW3IFi/KUkDe2FDRTG9LyWBuBaf7VmCCTT274GlhYw7WxssFSw9BH8MNo7jo6TWtkGANiTHsaRTHJbCMUvvHRsP6j1J2pFS/AjekltHXT0x4mbVTukG2K3CF9ot4BK5y436GLdkb/LMX/2ILLTlhhHRLPTHzGHwRIsL21SVBj+pFAUOErAlHex54sJEst6lqLQ3MdTv7jMlJbunpqEs/Iiyj8Eem4ZtiltEJ/l3z1ppy/PC6yh8/IgbijEzNLFzP4MGul87WpxoLTrWEjzN4Y1+3y1zngYZOhyf2AtFrt5DMds8cthXOHJK/f6J2KCOuIEXVrIAKL2ojRVtPdbMI8Q6PLEl3HYYPTMhQrVh5CilTu7Ru0ujOaMdtOcaVTYuuJxwcQfTZrGg13td+zn1fHpWpqo+BChR/f+E1OdzZVX2cWhaCr/zNVAz+7zSOnMmElKCMhRqF3fhit5kqJFnWVSLXPyfkzJg1QIwdGMXdEewZYtlprZqcvTUZNvHohlCKxv3w4J1+AfmWD6wQismknq+sG8L0AXxEbZX9jxa8qGkeRICprjoQU1mqPRfUcM8m6SSJw0xbNbD0ex8ZGjkR+NTsJaPPBv0FZ2N6i7S2rrVfXSAS1cC+ciqkZ6Fc/WfHYre4LYB22L6KZDpzKL1a5vX+vvdunC2tLHs/kh/AgsOFt2RnC6UNPvlkGo/LaI9EfOC0r8InWBFdLmME8VpBA5+b+TRX4X0foke25OLoUyWlbsThNFCUU3IROFdDAaXMQgk10s4hU+0+J00X9CShDMTCg6AlfwEoQ8ORyJPWKRiANN1SSIGY5cJ7Ufqdv59bIE08hp4A9Mt87M73l8lGOweqSe3KzD/uCg5TU1OCputiDSUpLqBFZ6KR6+HZKV6yHr3m6ie1Z+SPb9EbhUSTgO74wMyfB7JiygkrollHPM1GkNBvr1zvbm2G0+IPhgAq1ZWdEKskT1iZ56QRFzOzpe11hMGTBYEB1QFarAA8Gh7uPTTK635CxTJ4iGbscWaIef0EjEily7YQknhfRJfZaX2kqy6kkxHTeKbA5amvvCaLs5NTMavHcvD9KEDW9GogtHXnABCeuCT9zmNFa3iIyAjKExUuUcDb1CmQ/J5W33UWKyxktdDoNT6ZUBX/1n0UMkzizclqCkPow0rSHlDFD0EwYg7bgSlKZHWMpuWAzbL+icXxk0FpDQ5mYrf2WtUkq5GE01z29jLGMN70RHQotNG5yFxDa7EYfQVdUrrPo5Mj9SMtH0SjK/ZRdjIVkJMJOv5A9VSJkBOERVCoEYAWMTXu1H8xFGP9q3jGPqxb6DTOYMtprz2Wz/Bab9YiMhRf5eFINk0hRLOktR0jqQ29yHutHjnnSrUaYmtusdfYV5HS9BrWGo2cGzH+F5ySBddqBL+FXbCbSSo4aIaviUSBGARboVPq2xtlrwnomJGqWsb8dWPU6OAHRx06o9sDmnBE/PREitlh26KRQ+P8JiDNIwqZrkPbKFiUJCv0Dmo5XqxFzlO6r8weZCY6Xeqe7n01rmvVsIfKGckOkhFN2/Gb2oNn78Bz98OVY0hyliSuYDgvjS/7IQ8tdIrHSjZFq2zfupQ5Kto3xd0hVBcq4MAFTpKvyIJgM9XxvGagLny8Z5eJc1xcVkxxnLCpV28nIgrvoaJqAKgXnm7qlbVChLYuejuSyNhhCdaoHbWZ9qfwzKrXI7dyeHkVXkTrMzS5e2+tGPU244pU6US8e443IxQ/KH5X7/9U7h+HEhR8ZapZiLvRzlgTqEeWiOnZX7kSAoraMDBLUnZxznp4nhFxzKY0+qf+RysJBwA3zsiT2OYLFTylF+fr09C+DKWYecbUa9ifo2qf4cFMs68QrnvDKAe5eUsShyYIWUWE1RQuTWcS/YXFdQBYpJrUI4sxycFJk+ld4kMnUhpAwSuVcRfRK0CEh+6trk2SKs4TYRDEZ4QQ0fW/3necUFHXkga+mqWMh7WQRXs19IEucS/TRkq93fGNr9fI1/pFjeP9tJrw1v7x5PR1lEAo64zSzdwFPPahyyXaIlsxKgVVX4VBubhYgaMShCncyd/UBM/Sjzegsrmg7LANgqHq8KNcNj39Ohs4WX3WxCgifZHmGg0xLa3Ohatj5TxIYPL2ZwDh7pzemjjLL1yCxd125tDzAz/RJRtPTZhxb2m2CTozlyrsJ87oZ2P637UZK+LNXAkzHQoGt1Q2eEj2RyCZxltph+aP3B60wnrccxn03XVZLy0Mzz/JGISSJLFq98YxINxNv7N4beooa/wKiFDinR6MplCd9loWBWhSztpzgh/RLbDrwyELVBVam5gloQMGnDs2hSB1txCL4fBUIzhB9ibdO9bc61nqqtpY+2qHudalsFc88KQYakBtONiJD3TFjfuxxl1nhyP645Umk1vnHWcf368hwFLaEyvgRpBw1SRRNAV9DJ6PKlipNpM6lGBB6VIEiueRKx23u6VdrJkuNdpCvKrx3wbzUSLbsgCKY8pz8PPiKTEnRsuzy4XVb5wht8fbtl2W1x2cdqGF1InbtT7XugW+lzlwMt0tU90hGNLp4zFsWO8+7EPCXYBpn6a/Cz7a4Q1z1npMWwNfoAixV9FbJwdQk8utnIKdkBsQG2VZc3gBUalIHSBBtoSWXdmLyRtQJpuuvHzH9fPSMqXxznmYAsTpKVIembOK5f6rpP61xUMriGOxLURUZqh+xgH6HZ1+AqV9ecC+/PGzOaVXM/anJYFZORvObKuvT4EK1FIAY8rSAi/LyDGbDos4mSZndG2TyW+a73llpRKbSVuj9RZ7/m7X0V7CE1UI/JZ0In6ERndLzFj0BuC/Vt9mlFhwtvKR090eD7m+Ns0hwdePXx03iiTkildkJ/OyAM3I+4TzBONU3grtBcl8hvSgStGC9p+sdbGAdDYwCj4oXgAp09Gm03n+XlL4eGstmM3dhnzjjKWbV/PBqx7gekYzBEQg7uVh3oAONxVc86WZT1VcVyhe8ZO7fWHdTHgY+j3eZ+5TYESn2qCa0dt5wc7HdNkQkpehEigDkIKzRov+xIBlJIZ2XiRcotqs6fqaKR4KpFGd+0R20mt30LLU40eJOIHuxhslMZlAmYafI4GV8E0NvJZF/GDpo29SfslyiW+8uTJIkcL2qIdbxycyX45bAmVaLDxfDuh7KFXWB5aCzsnhYt48t2BAKFdlYLn+BkgU/nXoi48i7d9zir18OQ+PWPP8Of5AkU2vOw2sSJOTPAjrrXQKsQ70h5+6KkDU/nasFrlnLaeeyYYIMcRx+YAIK3eKS4LJzyEaUSa79fd7cPXXi0dnuM4FUY/X67T+Y5JATZanPdc+62LQLxtf7+bShkBFqeYzaVHN+Pu2z2oMD4D9PwzQcBI+Nqck4n4366HWY8kkPbteFH8ufePTAMIUQGm/vGsx8IH7ckEnBSXTlz0BjUBHMvvzmaiRtzYd/m9M4rcsONzfgTlXljMCKFPNtXfErJGB3cU3o5wmV8Dn3e7p+8s5petRDQ1tcssWRuq2fYKYJAVugjiZfUbGflqVpFr5SvYu7iwaiIE9lX3F6DHF734VFmAMw5EhVQevC2B/bAdSCUxEzRC8y98lBM+iGoV3w2jBNhPFq49cUMBhuFFCNYo0r25Zrd4ZXDOQ6CqjpbvZSZw1WmDS2dJ+fnvAaYzE13YqSK5elUtRjwtxXjRYEJTD/2AnG+CVpaCp8ZXDFot3mTSuGN3XqKUiiYxmuT8MqKch1hgfnW168N7b4UP4hcS4oUKMhHdWssd6PUmuVATaj0benrhm4KknhTYdtDlDMqIeiwwIGQVGFKA209+CbUFaZKxhoeZ1BoXdpZGMIJmeC7OPkm1tw3Q6v4GyEdykAeul7tpdDmz4Rq5RBKqzFv6LDfRISEpSuKcwtHe+dYAE1cQW/8uDPfDr4GeA+e93scTtlGdTZq/mkvzvjV7vQiaNxtww0DSIV89nfkD3Jmtwuimz9ycsEXVAZsDQlbdlYUvebtiEag5sWy/+iA9FSbAJFr8sQRuO567jJT3dEl4xTdfm2D+oBKsuyTx9Has2Tc2qfMbvhsmfForMefMimgj1QXafeHgriVT8zPz0yKcWZUaNTN1DCR9PEUZue9Gq33vKOvMSNDLTOjYHwjkzi9KR4GrkC+cu7XPh7E3neAfVHJkVQfTEmKRk1RsW5DpVb3uw0GVvLlUZnV/lKg0cSsELvUluZqzwJfw4P6tT6psuo/rSIIRjEG+Fq9NLIgt6jLrPdu4hln3OPqQUq56oKxrEj0MAGVKgGx/XD1EQx5W+5XZpAbGxCYw7zZGgU0UdXGAHX+PIhNUvG5XiGVrMlR8Ihy7m4y5RidKkpSk+8+6GNqTK/eyIRymeFaDuv3+yoN6QwYBGlSysq45+66+cZKvrZEARahc5Kxk4M03XFL0XoeTgN+2mie/492EwRVk2pjW6rRlJjhoqc2gQV7t+I4vuM7bjlfxYUOShus/+pU4RwyMnne+nEPFRjTiBAUKDH/wkooD21CKdN1JK3TYNzNSXNtsSABOWkuRNkLNeIdcrwO+juVRMs+GA+rEx8fbyx1MsEw/nhwiew7JDKP1vgIXQby4lNK0EV075qE64Fiy2oh73MoefWd8zBHFDqCJTfqw9AAuNT9kH7DRgvqk+qOEElTlOUJMYxTT7Aid0tf3Z2xI94DVg+NuyAsmPag3Pzc7F87ln2C1Jgpv6OG68DXBnV2NfbMN9BS8CrYbpSH+8iCNOeaQo1t7u6vqAlmo5cHoEooGUqyMo4Co8dSwhqTwID6OX64y9JuweBmOmaN01KLPLJLTjaGpskim7mNDFvOMzk8/8UFHV/kEjdjJLGTnDXffjDL/gYYvHyl+nFI+reZnKln4SOHcMH66LsOGK8bL8W/9SKJhdFTdaw7Si2sCteDDxfgCYlT/jwsl/ogCi6DXFwMwG0e6GYdN4cLSBBY3j7k2lvecBKftRXjo7fq/fIFLgiEWY7yoPqt3JN60C9eczP9yRZKmEmYznQS/+qzlZLrdMBmm8cywEvBx5nq0CEoA8M1m0cUNjIWV3Zr0m8TNCE1ilk6IU7qGyFVgPKLqQM+tpr204/eSOTHuga92V54geN8UW9erP8gkkutP4tvoHYrxRJTKqIKUKmDMGlGX9EHMoB/PtO7TuYTNI/MaQI1R4JMqz82xrSxL4g3PQCq5Ciq0y6k8ZJaPCTKMLPZim6+h0Mch24eKfyhLuunWKKnRPk1UX0oAulaIja6U+O4Mlvc1rzujvejvHDzXHhhHiufF3RdLD055zDXf5wNfaV3cR2iwSYjNkV5JFo2gVhE7q5ayM79GILs8qHZJCFRfMlgoKrvrmyQSXfhs2WzD2RMlUP5jbQMtLJ5wDikvQvwOfK2XhI1Of3HWlrAVC8D7kP7QfyuwvBDlRb3sGmXdm6JA0tINKymTsUXliWMjtnsxtKNLbMWZHg0FoiXJ3ioEDKtPyU6uW2f8cDypgkm8TXJtVbFCNqtBa3XH8zJ0ROq0fsaCkcoypjbz/tFwnYtrXEANHPlb/lkSSTwZ0cX1bzrjMHCHsH7mKSAnqTRgbSSzy5A/0QtwJN+/kl1q036UT42dJGqzdvAOtaPRfPRk4jmMOqescdG5Z/vwZNzWDPx3pZ1ndNgUilaMGzzOYzVatj+FkC2rqkBNOSyFF+9rp+1gTyn+iZoQBdegW9Sxaz6EZwA4LBTfltYfzlALvo/yLiwyhTadoSwZyRKB0RuIIRg6NKX5YFp63kjreBFwsdCeE3eBWskQxJp7Qqsr60HD94j+8GPXqFWcrcE3HlBRSdyjGdkg0Rf68CqIs+zg//SRUoswDy7hJoAaS8HeWqyB1QTDH18VF80J50j/YJmNFM+AMLVzA+pBfPIE5OP0i6yxb/BAjUkoEISVNCPVA2hB3ZXuaVaT+GWA/ACpWbULkF28bWIIghC5/TKhvZJdg1hv7dGKDjwaNDrb10fSJecfenQ65p7jKHSfwVpOwhdE3yNdr7+nCEeNle8HGrHthKyFojANuCleAYwgXXloUvY3KaSDX3bQmGNnpnMaO3VzNvYPCorrIZ2o9NAo8NtpqY41E5UpYJqNzvTzcYw+WDwefvJtPt+JEgUnwD8j3Q9wwu+HYKzzyaa2x4sXv9TzW8lgg1ODk0JDRF/hBOXq+adw6vmg2MpuI730+eys680cIHD1vsuTSERGTAAkkU2krKD55fib5vu756gKIeWnEH4PBvZVb28MBIJOEHIWSqKpTVC2dwaCZ+5NlbSNKJ5BOR2X3T10QcCyATMsVwcIbrYbieuc+Q/7VZnb4EvAhVanlofHKCSDWTR7Y9X1x+X7opS1sJHcEpkZ0scMqkUQRrZsAouTrjyLENbSFcGIe1cCpA1rL4zaXs9yohCRhqhWNGIItoRdbWHlnX9jtrHqSglUExAd794lsHGVPrN00K+DE24xNy5QJTnKqgxdjzC9FhsY7E6LLKgYbk/hGN4qelTdzvESu1yGfaS6Fmg3kajp4aqxXuPR68GREVby7uwihKxIr6KWRu4CxZXzBsWs8F/O+y8RrUwQiRUXjkzFvFcxLwvRE8Vnn1Ur21rJk+x6ZOq7F2Tf7Dr3FnTT/rzivABg28au++HX51ifzTIABhgp8dmJsJf1fEeDb76SBe5hX3L7GGyv3WrOw1mgrU3d42jcayRpsCTw59DlxNKiRxF9I2IMqYhVdCHlno5ua7Lz5qHeh2zlDpDZLg85YCogxwby6G5wCmpAxPy92NvquRtpo3pUlFAkZQtX/yCp5W/TpkCf+rmCZR6/Ooib3ui8IczKBDKnF/xuvF9lLbLt66/4Adb3lG5xavvGV1m3l3EsDA5fME8zw+/Iguhuzq/9hu6YD87EIzdW/lPIyNr7tXwgmEQvI3mNNXwu1rGbzF2Rb6chNbc0HoTeOZgkg88sZof4XTcYbIYXHb+AO7XJ6kyJnO/m+phzC4O61ZM7xLsCE5D+SVYx/AFZdQN3I/HjtYr1Fv48PLdkUBlCBpPIFnhoBVUaI9fyAMRrKAGM3ZVv3p33QXdfXRNq5sBAew5ulRRRMRM8TVlZerToLZUKmVZqDmc4Hr/lXq786pmCQhDEmFjqL6kQADqvUa4qy+gUkq5u76Ds/CJgG+GgYeLEMLLh1roQyB6JbqPFDD55rnZyhxFbUQw3ynFXHS+QodWoSAvnKvvJ5ND3nrxj5ayQRjq5jdtc7dRktezwUjmPB/lKuFZsrk0WIow6BnNeD9Yllge1fpOa9K/hXDhteMR2AsySfEXBizLxdf3zMQUy1JJOXIjxCkY7YTi7WaCuFdYPLwrbmkPUeitg1Eo5O5A5IAE/ehvyC/kvHbfHvIAvK8pOmAdrcGBVmu5LlPgiG5MURGJuosPMKGNV8moQI4fUp4Fh/rj5naJoix7lsOGSFb/5ksvPQXZnY26DMhu3FlnO9RIZo7qtuuq2RjkxOb0HcdZIs+k1AU/IVnAvhKa2xbFs+PWV0/HoHg4KhZ82hfTHS7zp5UWJ/667DpN3EzUzzcY/aMVUobXV+aRgBv0ohEo5mj678t9YSqnJKEWIXLbu1UAGVuK+y07vrHOC8VZ3TZprCgtQyU85HPL6ppWA7ckEC2kJEkcOVVcK6y6FI3lB4IY1hb4Jwnjmgh2hBjrtZ0nSCmVIsgnFiOjxCfBVUjjMoENOe3QTbHfj3BjTJGUx54cRw/76GMhZJXyqhgWy82zyNk6k3yqTh6UELq9ikyOi2tpBhsZTIPWLQ/kGf3VykXXEPcUcYWPK/mQXWseuDqYYmYNJmouO0r2KaJ1lQL9504DMVZj+jJC4W2GaW58HPZIr07rD8KcVF+nfZW7ZkhBPGON2JJfE+JBWVzlPAxc34wU89LTPhvRdHTQmicKXadYWJ9cUpFWhFYh8LCAsu46MxNOLt3zE0fkeKVjq6HvLQS+BFUPGYYobz29FSTfbmNLZTbFOY8TwnbxryB15LfsLWyn8ZTe7Sr3edlJxVfzxyCxR4iI99YC/6hKQDj61J7OGUTWFvfSc9gd3FHzfhRvMQGpYW+dBPuZqm7Pcb7Mm7hpEpuM42gNPmQBUawyZXTggl+O9JzyRBfNucVAquknuGtvPT3jk8b4SHMT8DZQ84RA6ezCxjX4dxG2fahB9EzZUuKjexvhavgEt3EVGNo0X7eBX5wd3jJzKkZMytLBXy1ticbWEa//Qn3OpYZGS3lg/SU9QYa26PdzwRcNvfl2Zo7cboQ+1W5aHWnIKpmPnZsr7qFjS+BZyvi023vRFDPXBvsONzhCLvmN1OK9LQPOmhy0FaHZzq9VXKG2cHy50+SS4Iop9myYMfXJ3MtqQzdiUAYgkT/IOOF1GH5R3gzYK2FmPOopo9+VmRYqhaqJKJH7lWrNpvQLfB52w/GmIDdG4P7B+dHUuUeCMKYLuAg4hHAZpwyckEMJouuYzqRDqd60f68NL/CvQVuKgTdfZlmwt4k7eONtMrmaaiMlZM9dAREFchD5eFkpZKNU7iGx+MBWnj6+HjbeLCYxlRVygnb+HOLnow2tn5But0/RVYTR5ov3QnBb3fmFaZKur458HFrg/HkgYuxXbcqFQcmeH9llG175CwToMqPXmbcmuWXP825BixnIvrZExw7qo4/0ql4dqzGQcc6zM85n40H9NHU/WuqJ9OmYXu4ImZiTHw5niQDY7l4rPxUGw+SVR9l68kLVqXv3wnlphR/L0V+KOu78vUZX9f1LzCmmXkKKzwW2xcEbxIwds9yVTgotKnqsqLFNSYx745RwMdvmjZn7zNnyODjnIc/VxavtsTqQPLeOP8zB8CqHwtSRC11CNRYD/hNWV2S81qteW37h1BcpMf4zBEcGqs1YCRCruUP77eJQFEWEp1+PTG9F2hd5OQmvcvBytk5v49WMYtLEb0ihn6Ug6PwWjy/iRHao+4XI8AgzttRtNXzZV/GCY900CUUGPZNf8+gO39FXc0pZ3WNHqFuPtFGn/o/qXhiF9Whp6qzfzPzFNaZoub5E5T9Adu50ULC1d/LrL3+ai9KKiVN5U9drqdLPr0c4x3RhqVjg0mcp0Iztp8BNSqyBn5sBQEsKLx2nXcGGlE1gIB2Lmob28CpLgb0HAzcWPPhAi6IQJ4lAYtpcoyZKRHd7BeKams5J5EQct7/lGf1RmBgzVKjXgDBuGs+UZ1WbI+Lglfu5vPhbdDK3yQMsgvxYJhmp6goq91KnfrvbnyUxPnVf1qpz4bjAWrWyzjOQ2LjoieCrTyN1PChs+k78Zxdhd34pqNq9M++bhhNAHwCazHwAUWn/7/lgY+mIlLmBVqnDIjKxVw3f3WRWXypiqhK1SYCN+S+rTKeLTPFGRSGImz+MR/V4ZTmi8ZOGolkcBa/biAH7l32RgrMBgvWVdFT7Jy7mo3OFXSaBj/PIaOBCNxL26CB7uW8J1E4JcRhOuesnuebqRhTqBUIf7SIrS4Ueght5BiY0YVJsCXZJN4PCtQlsMrpjRVPRxo5wkJd5mQxZDCZCnhvZyHlDcxUooHRz2NtOFWehuwBuIp05GPVj0gNEOeO/P/IJDeJksaOaE+QVvUDxVtUMb1i2X7n5MqlYenfMNBHZ1SUNZnGzFVkYzpuq6ciMh4zghp3RxMEGWeXh4NLaO+os87mursMVKbci7NtLTLlvSzRkoPA8/grR1hl+5ce+baMUJjtoEjcTl8VVR6dyu4ZlpzCxjnH9FFx4chrZHg1NJmYWWzXTQbKSO4Q1BFt08s2Z0s/eoMUALJctvYPlCYApE0bIjsn1n0CowulsQeIAy3KCEaST1MxVPHSBwTMORU+EAb6sBF4fbY6JloRh5TPqwz5inMBKDzZugUgvj7m6ykn7BPEYxgkl9tsgeMG5rJ1tP2j5pQmPvsJqEahxpesW/C0c9cjotrL+dlv3FWLaREt0rd6/ZuKcz79wVmOfxyFX6fnIA6ylp/o7hK0vD+uN0YT1C96Napqct0iHh76HZBb2qW9X5LhFu6X+U0nPJHokEI42zup1JU4rEDuuScW3GeOe2yhIQrGXJpV9KWYo1MF15BfzlMysF9w5qMRK6/CGh9nGjtLK8xnBaDoMx2sHeB70TTP/nUDti6KL/M0yLZ7ki2k7wF758v66rS6BB42ch1Y85edVp6c8V8hTN51dHAWA/T3fAVgzp9/4jryIu1Npv3b18Jxan+oF5eOikWlcUUEYG2YDstAafwgUxyL6Ia+0+VGDih70gV54Plbf6UKoqx5aXDVPYLgl/lI5fHaTLttcaVaQcEGPoOTnetj4MzWHCDsLYNpADeGzy+cSAqIIHhnGDISglQqVJ/e/T3UhU/qhApd50+AEOkynYwaaOFosWwotq2YAwYFogdQOBeBouh9LRrtIU7VvfYE37Hx9ih4NVctA6mo/BDm48a1R/waTsa1Dw3P65bGvl8PSk13pZowRO1kMnftQVPczrn3gg5oeZpYM+9AQHXFffU3T/h009I9I860yIydh5FyIa4PrZM0jyhpP2PqDbMOLzQKkXhEvoOzC544fbI/RTiwvWMCQvqMzwh2wKCiN9Kj/zLJ+Jl8eheu/WzcPmThQ29OrMdHh5WRILTbNIhy1CroL078Yp6LOGf9+4dMRo7P8dLUGvq27DC9FLsV1q35TsODMtgmsx9sHIbon7OdvPg7dJHlG90m5V2KzCQdiqzYnOnLeOpFjCO8QoXSQXsbGvvs1+d9eA3hQESK0DMxjYM04Fh6fG1dX8WwOFf5M6P5SY+2O6T7wOi7A3Tsw3DPyrKxmM3LP6K++j4f0TrgtNuekNRVz5DI1TSWGoWn2lgPXNuOPOy6h0C9+SnxriZblkQkfbVrKdvTxlVK2XiPRC12yBDW5IJLZMkP+r+mCgT+4cH0SMz0hAn6VH4bwzgxh+HNhF2bTN1YIAUZU6SuMObN3q0lkTh8xJUe/S4ogTOTyvuocItdI1G3fepR1oHvw1ulO7Xpl27lkiaiXntS5t9Xxx02l3DKIZ+XyuaoPFV43NNqg8b8bt9ZniL0EvXzRw0BgHH7QmSc0fGOsZixWkp6l0L6HXSTVQuKj6qqKzK9NXhtadPg0l3pwgDwSF0raCIQPvaKIWDrH/9DtIBkhPTutwEROaWZSu6IFJy2DPj2RyPR8Yfl94v1PN9PMSI0NYX2HuJgTj2MYy+Os6JuHq3WjUfZbevpEE4TqdJuF5+QfQwT9xW/bBz8MYu76dbXLDDzgWwX8FTGg5s0mJSvVlfWSoj6uiejzxE+apTB1AalUJXXaNzRLP2yy1D+QABW4ivGXIZvnfN6biPT9reYWiTWp4RZ8RLYE0d/JYGy/B00Jc/0WREG9Zfnyy+1vg+lkBluXxlSXR55gc45M8tJ3rkvMdurg74uztpIIcgLeszaOKVYaO7tucM857mmD5Oa5UIQlvT0V0z9uuvODYZiKf0kZBPk9alOe2NMEsEiij8vO9mpcXNsMPEwTQXw3c/MoZ1TOiEDvjdOl8UHCbI7DZfsNojKUJHFRuRaW5p2/JsYK+/FMEu+jbz3jV2NEfhniOddd6ZaAnhD59dBVOzuPLH10DyCrfgqCI9W2tvIa/U25XiFLZOtHMDP9H/RqfFqGZ+tzmLPdb486NFJtmcGTxxtOTzyOoRoAmVCnWgrnAWFWBiTlWaEOdV3amSSYdQp1LwZDbEKtbME4ZhT8ER8WNpNULyR/i/AKsCTDmuaZDpl+WGoWVhJocicF7nlhcxcOzPbaXvbtrheDYTjHyF5UVKmm+THdBWi3x1ZUhiwxpZUOXWXUdnKDQfEjR72bye5tUXLB/M6rd8gMNl3XpDYxEGf8OXSa04QPAbI8IsS8Sn+FwB2+c1K3DbLlSXh+RjMoUFIYHNeRtpEb4dKM5pTvR7hk2LbsgyJRuAiZtw9ALY1TjvKUfI6Kn5Vjy2dmFPMV1bpJ1U","interpreterSafeUrl":{"privateDoNotAccessOrElseTrustedResourceUrlWrappedValue":"//www.google.com/js/th/vzhxKM1qcRg7S9Z-TmKz2_hvQlY8pI4fkOw2tjRzaC-.js"},"serverEnvironment":1}}},"adPlacements":[{"adPlacementRenderer":{"config":{"adPlacementConfig":{"kind":"AD_PLACEMENT_KIND_START","adTimeOffset":{"offsetStartMilliseconds":"0","offsetEndMilliseconds":"-1"},"hideCueRangeMarker":true}},"renderer":{"clientForecastingAdRenderer":{}},"adSlotLoggingData":{"serializedSlotAdServingDataEntry":"sP1bLOMK4jmBFmyrMlFRKgxna7DpJQr_bZYPB7muhEDK2lJPp0q1G-GL3rLeb1oCfyq-gXB3CQjwPlLyXEQGJez09na-V5NeVtqKkHESaMxMgrc-ZBMJ94-GHAse82YoPdqEFprHT2zkfS5WxybKJOn4w4bstq10raNlJO2c6v4pLE3Z1yZJDzScDMtjnBSrwLaiLxkMXt5d_ZM7NMbKUJbme_nd_IwHOpInlHWnUuzX_PQstCm18F6X5JgdilejoLechxp75ExGDSyJdkxCB21fsO2uYE8r5I3KO-nmqbsn"}}}],"adSlots":[{"adSlotRenderer":{"adSlotMetadata":{"slotId":"N1sSqVdZi9tNOLHUlWaI:0","slotType":"SLOT_TYPE_PLAYER_BYTES","slotPhysicalPosition":1,"adSlotLoggingData":{"serializedSlotAdServingDataEntry":"tA_CGvoAqtBrRPS1iTeuKLezBruMqh1XOfXUFdnN2NjL6FIKJNdERckgIqKtBkpEqhw8t6LEqdiw-wIUxH6uGIrb4Fw8NMq9ykGgUhq5jPeWdtZdS3NGlTmMdTwEQwpIDopZEfUHocTNBNn7k5GpDq2dgFE25sM7EOvvWo6w6csobW5uFSu1OYFDAxq7x1DjekhPKjEq"}},"fulfillmentContent":{"fulfilledLayout":{"playerBytesAdLayoutRenderer":{"adLayoutMetadata":{"layoutId":"2-d_hQUEUPxfM1AUjPZq","layoutType":"LAYOUT_TYPE_MEDIA","adLayoutLoggingData":{"serializedAdServingDataEntry":"xEmpzLW8E0Oui_EIq_SioGdcTRImou9Xvqi_FBXb7zOOfll6-WE4BhGRA7GTw3Jg9y2jguaFTZtFEN57POAZm3h9Qb9UgfK7K01m7C7hNDfBVuzzaLiyy9FCklSoYQSxj5Epk5mPZIWaLBHFst42kP_TRI5MluXGtH0-nKbutWP8Na_jJZaLPKR3jwDniHoSuq88SKXOTG1pKBG_8_k1SSYfhdCptbH0PZsC8IxDn4sVGgjGRgcp8JVsXSruZ5_M2MAsYWGuw2S2Pc938Xnk-6FbxJCG_jneFVP73zr6_K2oPLDwnWULjXEO8Mtz0BVHpG76IkyDr1eyBMxdLOyrKw81zEsmHun5ChAoUtuNoqaobeHaZplmT9K8hMe-eCxnls_B29If2bFVxjyd"}},"renderingContent":{"instreamVideoAdRenderer":{"pings":{"impressionPings":[{"baseUrl":"https://www.youtube.com/pagead/adview?ai\u003dF7zSyV9c9T5J_j6F1O0CEWwXfHVF1XxdpouVJhWhs4xy2u6yQ6jX-KBVkDJdzMmBu5nylKh_OONN9OhG2J5uQDku1MacS7QbCaHL3x8HXt6C0aBunQOA1EOR8w21ELeE0AlcXsR1dRHVjHd0ma3JfiUMrjP19qV_SzGMf9_l6t79rye-De5EukWoQzxKUjpl7nNJ7-Zc5KYQN85ycjQfmZ6Wr1RfF__x-nqkriBDIjDDNpEo7kXdUKfxPz82L27DIS6sO9oCxilM3CIDNPT2qor_EaHQoyyd4EFg2ZMgacOo"},{"baseUrl":"https://www.youtube.com/pagead/adview?ai\u003dmXHMTZmKkamcNdCsJJaWbCIp-jd1ScuNbQu4WuzgqglE0F89DYQ_kXr7se_fxGha_4YD9qXzNsPSCt6juDkWi5WYNCR8HtL4KvLw7S1ATnNhwiuLn9FKK4l4jRrEzIfHlkHy1YtchaF5LAJ4wCaTZ11PqglZA4LLc-QDTvpCUv7wpPjmESntiQaf3PcsB1AedfmMuBxC8RMbb0FaCzdS6argZTZJHNYDtsBMW_nQauPPxJrWuZbyEAzOxdER_WJkMR_lTDqFYTMovyykwv8RqzDYlt-I-9df09ocRXc7A1v2"},{"baseUrl":"https://www.youtube.com/pagead/adview?ai\u003diGIIXpf2xBEeJAow0_iuWXkLVn4PyIKT_ySjVczK9hUte8utw_HaEgKu1nB5aE9Eq9MExDS1FUpurH5fSO7TSJS8cRLSCG8Lz493e2SlJmv7qnT3jgP0GotVk4OQ4KCn5PSpJP3Z0uE02Hbbig2nWlG0nDcaVKtQpi__vNvGZbRj5ywEjUCbD77Y_z0h3490QtSqbsd_0p1bcDl6J0a4ZkhGz-bavIxXVPwtBScUseLGMmatv0u3M8dHaeFNVPVJ7yZX4Km-h85buthFPRyK5fVvEJNUY3Qc69phWJy7UORe"},{"baseUrl":"https://www.youtube.com/pagead/adview?ai\u003drDTwQ7cTxfs_tm6uKnXMYzQzKGmFng-TtmriHSM2Bqlt0J21tSQ_84a-DOx5efbj023Yev3trhtvzMvf8BaIbDOsz4RwuZMZxBnCIt2ATTVECPDGlMHLxQxHulPgy0N224Exuvme4bxbFfHvXEZBvYK_-Ol2A694FvBJ6twzwQIdi7GfpUhGxgzQFJZeTPzQgDAgqduJ_bNgyNiiMpq2eYbQHHyGNvP8B2dnSRNEcvTwvTSch_bgCgl0u9vZdRZLqtfR_tP-NoFSiLSFQpBV_PTGhPoLyLh00kaRDPW5HnzA"},{"baseUrl":"https://www.youtube.com/pagead/adview?ai\u003drf3-si4hOtPp7DZVOErp2WlBIJnclmUlcLzRh8cEFA8-DZ3twiiyHyEu2FnsIGiIB2EZFmk_GObdao-m9wNo2wAM14ZjQOX5Jjt0e-sjli77NfuaNVSllCXIExySTYGz9B6OjOnGrHD30baAOkFmrcW3jbj4DQ481rCfSoGXwSGA6Uqoc9VnkH9pP4oXcWE8Gql1tMfXktqV8XliDOu9g71qJ8VfYB0nChVTiFwlQKmExTLXcSx9iwH0DnAMVc3Iv9BkoVolhxuiEA8mXFx-4iljO4USLbkniciKeu2EBTSM"},{"baseUrl":"https://www.youtube.com/pagead/adview?ai\u003dgveXEqnzuNrnnqjA8u7Pp5tG05WBEmnWpUqnj6Yp3r3Ct-u7z2Zkgm7r8O-s7mPhV88Dr30XScdO0GE8UpEVMTj8aq9e3-K7f2n9QIlOx8keRSnsxLwhf2R5nUiH4mpGMieb_uLYmBItHA0GxaT6ljO5LyLuRqRWGauW2T77Xu0ZnPFMpoK-U_Z1c_2QkYGkKO77AhrGYh2nrueUb-fDGn5aU-8_0EuNgCwQpCz_DIEijA7xzL2-w3T0Pyv3mHqlKgxbEE-9vvzuCGsIR8RrAsbxM_cYftusltbzmeKBlqrm"}],"errorPings":[{"baseUrl":"https://www.youtube.com/api/stats/ads?ver\u003d2\u0026ns\u003d1\u0026event\u003d6\u0026device\u003d1\u0026content_v\u003ddQw4w9WgXcQ\u0026el\u003ddetailpage\u0026ei\u003dG7ZNoCedzWbPOOsKJgobfp"}]},"clickthroughEndpoint":{"urlEndpoint":{"url":"https://www.googleadservices.com/pagead/aclk?sa\u003dL\u0026ai\u003d_eIMLMcTWjft5G2ZAjjRbs4dCCc9ZKZjsExJj_VjkyMku6LnKrJH-tSRtAAD1q8yUyENXJIkqoxXwmMN5c7vjXkUAjaza8HJuUOPm84WqYZfhtMJHTRDIJ8f1d0msoA0UYSD6XwuGPC8HiFrNEw88l5ipurCNnOaeSKB6l5UQpxaeUdRtBsd_ZnodPMLwaJniaZJKUCdd5vzF9i8BRFg4qMshxfkTyilmtpBajT4S9KWBRc9s0PlFTc39Vq54V5RGwrzjKnGqkLVUJrGrP_j1UQgO-L8eVaj3kWwuqjg1YbX8_yAR16-8wFCGCPcTGf5em6gQe5um91FKstYvNRL1rb75BbASLw90bVvgxjWXjiSXroBgtmoZuNL2Y0LYQpJiLKMw_AZ6ZVR8Z7OdcgvfK4s8rWoTjL5MsGXuCUpnqxjEWBQkfokamwMPL5Ncyj_0Nlut6nXKPzOuBWiJJ4Q55Ioqe1HifkFoMzzelzf9fXmyiG_K2SU","target":"TARGET_NEW_WINDOW"}},"playerVars":"ad_device\u003d1\u0026ad_flags\u003d0\u0026ad_logging_flag\u003d1\u0026ad_preroll\u003d1\u0026ad_tag\u003dOo_lX6SVcKp5EjlNfkuxeGBlupXV3sLlCWXbn5dRB57EnpjUIYDxqaVLtI3ko5S6qzH4MAP1nCngxlXUCZJLjRuMmR-bIkjEc9VqLYLZY3mBS2XRjBvfWG7skPFxImumnV3NnRxtbwaWiucpEQr3Hcw-7GVkCeM3eYaU81qsCX_BwLvMfnEIChfV3W6H-MVCjYmp9nMwIKnYK7Am96akn-GO01dsRlSunbSWseUQq_VTxMPFcyjLplT-plh6n0tzHN1vnmw98E2UYVx8Cnchys0IKHkAnYRpA_J-SCp0BIcNYW-X5K29InrOcKJJOeG4lNwrKJ1ev8g7wZ6RmNjkr9ngaFqqC3DhuCiiro4z_b_yxPLXfi2lyey0S9UQVGTH5KP4fGrD4fzWtR0EhKbh7CTnMP8lt3byQ-5OaTvlmnpR1fK5FYtBvPyktHJIFBC5CQyA1T5jwvbbfhSy2QaZQ7yeQy1QNbWnbibUEL1XMuJwDeEWZ-ozKIYMptfy6uxfTTjhUbdoWzOD9g0vFwXuCxILmtZpWN2xMefINj1CleXUorpU7Pd5L2TTXH--bogzmXk7_HiDZ-CKMuOCsXSUWKDAMUpy0tnqj0VEOXdLfu6Jzk9bOSQ13zWqrp7EgvqSCJPXkjaOZa4EXXcd-i5_lFp8J3eWLSSndgfdqxs8wXAxFjf2rldeMlLQjocFpnlVnIGLXljebBy-rGwoxacaLwNirPpbpgiWToGR-bSg72u4ZD_Xr9yx0brgqmArTMP4AjHNawMDkUdnXf3LoNL9l4VwreRYYmVU3t9iTI9lP1BJgcTaAMq3EKcEnba36LQwCMAYxVoIzYKQ9ZKLsAIUcEObFliD0LrG15dxPO9P9sxA7VqFFdUzfbIKIWM_WyD_arj_0n4F2L0majnHbG_rxsaq7veoZBW5CWs-oD1IqCJFPi-XRYD_rUuwbHPnsobLhWMgzeZrvUNW3GaCVWH3gsiXvOP5fsY5jYgvVD1mwm8-gWBkz7ncGRbno56m-DAXuJypDBATlmejXw0vWZsZQ8Dlc8LDgJM4pr9vZLgbofKQ6AnYc3y4Qqnz58b0vqV4wsozSHHT9kZdr4g5MlDMOmnyHFuNI_0w-H_DiT9pWKJcqkaFns6F5HTD2iuPdLkJ7PSqA7BPYK-7j8_xoHLIX83Pa9rM24GgE4dm9HDGGfHh46d4GPG9xNklz7SMdo7zBSJmEfrL1nzfDESUYvYakyz-OvaAMZ2tPBVGUg4BkOTfZv7TnUTfg2ucvStqpssczwax7-B1Utj0X9LA6HCe1ATCBy9EK0qkFEKkyTkOZhXXywyLTwoqGkC_9nZ2DRsFQDW4XLArq_8zwTHieP18Ds7MZEqcuVLtzvEd5Br8PLatRv0L3U3tIY8JMiyUeZADAMDtuKUyncgw4ExgMhkL88PhhIDdeG0zqvkVcjmb5u2ELKPclcxFV5ZBBDX8VyNxY4KmaC9BL8KQV4OKLVmj1Quu1ZhN","elementId":"thgsVSaKjL-E8ThuFtl7jOc8ogC2X4lbmUjP","trackingParams":"WifHtYV04yb68l90GKIoaNvjjqdw4FWnxAB6-y9s_TO0","legacyInfoCardVastExtension":"","sodarExtensionData":{"siub":"suJzWs1h1aSFzkNSUCvVfIjXY_cH-ALAHLDBTecblEKeODPf-KLDrR1TFpyh7d0N6ws27a8tQSgQAEX51Uv3vOHMv6Ht0h_pZisDGQxKw_Q_1PhWKhMEb083DHldyOqAgThHR9fJTNd6E49U4u4biHFnObqhmjcxXtxz6GXjN8xKaE1wnIC6gvnVsP325wf7Acp8B6yG","bgub":"zjUrsBSTW4fnstz6wEfO1kR8wgtIIzfHaT09LIbGWW7P2_larSkTkD4fyvEzBUcHQnsLg1iHTH3SlxXlx0kcwxv-FQFZHARn2eUJ","scs":"wjAig-YUE15sJf4rBZgQw6nIRCLLMeUQg7aop_-LY8Q1V7I-8C","bgp":"hk3R9YtG5E0ENYHnzG2CHG7MqtCNOHixYvg2XmBoytXNilfOBuiAuJgxofMG"},"externalVideoId":"YvtNYKXsY6T"}}}}}}},{"adSlotRenderer":{"adSlotMetadata":{"slotId":"ZmUugzy35lq55JUab4Ph:1","slotType":"SLOT_TYPE_PLAYER_BYTES","slotPhysicalPosition":1,"adSlotLoggingData":{"serializedSlotAdServingDataEntry":"Hm6feqWTTfedY-1w2jFvKiiL_CA9MpSmErtXB25IXCsHMDyYQ-UHHg2gdxgKR9uMpiZOBaTyiEB4M5aNnywt-YvnBvNZS1EqX9G6qlwS7gi7T1v89QyuO69M2C_R6BD4T0VIs3n-X_Cuvpn37aK9_UYJ-Climp_WLkbf87WQbbN9O5v5Hdnf0hsxrd8PTy72JHswqFyH"}},"fulfillmentContent":{"fulfilledLayout":{"playerBytesAdLayoutRenderer":{"adLayoutMetadata":{"layoutId":"oZp93PizHbjYkPEfQ6VM","layoutType":"LAYOUT_TYPE_MEDIA","adLayoutLoggingData":{"serializedAdServingDataEntry":"laRAap1VmXS14W2Cv_rSW-fo4mUYlvpawPbV1_tjKdXlQzv8_W9P1eZ2XilJmZy27H4J-sf7wXwiGNwjJejdrK-4GCyB-q1NDI3MG-QYnBWO-JuutR2U5bqYtVVz1mzJsisJB5fY08oCAJdWmkYa_M5KFBa5T_H02rJ1mBWHAng0a7P-sbL_lo5o8ix_A2EUK-4PMBtgrvdLe1AKkNyxIRUfNYjB9Wz2U3BWHJYkXnnqMVuXcnSFDVuNW7bzMpuUp1O_cdgdwbgWPGkuQSXCo9Ib-2_cYKYqgomb0WO9SIPMmm18Fqab9KdrAF_nj-puwxy2l64gmgnqHy5T-w0bRdN3RKC_2GoVn_88rj5jM0TcmC9mwtOOngrI6cFsYWi9fUFer_I1pa95famV"}},"renderingContent":{"instreamVideoAdRenderer":{"pings":{"impressionPings":[{"baseUrl":"https://www.youtube.com/pagead/adview?ai\u003dGIbOshAIljJq5jhjLMH0IjdV3I_JA_6FdOpkxrtWKAlpgB4awz6WefFXtBbTog9BN7MATKuc4HezRQLipBl8SGIt6ROy2IgmAgbKIBsw1reZH5f31283L15PYnPHIVVm0ULvAOF1NU4IpajmwLHmZAiFyMA2SRGeJVAaUBEiI-RWlGbOloxD4GChvyYyP0t0r_-4GDWhv67fQJAqIpg7KDqAYxs00k2uoT3K0-m4JIhfMg1rRrMdNQ3Xk2ASO1Lc__D6DCjVUDIfQYISPqPwfM2CDCgbsuXmH10kAF4HWKXX"},{"baseUrl":"https://www.youtube.com/pagead/adview?ai\u003dyRRDEUUFDiX21DMJHctjWdVnns9_Qy_-C_KEeQISt_APoVa9QFrEhdGg7Cr-qp3uXaUiFlui3xQP00pJ_A_kknu_Sj_2ZR-mlw4DJSui2DGVaECY2L86YBdw2HdeLASx8I5AvVU6l1-1MeInQ_Bz375AAnBccN56rAuk9XTYHbe4K6t7PYAADe1tFmGskOPStcWuegyNxN2SaLriQJya7aBOWGdxuLcW1vbouG7sAFnk8HlT5DcLIbPf-gaDhx84fKhPppFJmWxwJMtt7TOC6O0kLTePH0XvmairNA69A_wS"},{"baseUrl":"https://www.youtube.com/pagead/adview?ai\u003dN-FaZLIDaJTwm94hKQWBDMkCBA-ktEIDynojWxCpkL4G0qJY2jZjoAtK1hNtr7zyM_dvmFK6U8tEkHRCMMD5rDFTBUTs-T_sb2Xil1Bif9W_ZHtJkQZll4o93_JlORsNNFSH4ZT6ftuoLY9XmUesCcKw9r1VcEhrs0aRHRsqxz3bXYXjzFi3yTyk8JQOJWhS_W6sUaL_cZCJI3PnAGBQB1f-4LnpT2LEp51LUohpDOMK17osx5Wiuc5mhVLGHLCS7hr5-Fk2PmSqiX96aw5UMT71ZVGHNSNWxlJ4Px6AL4Rx"},{"baseUrl":"https://www.youtube.com/pagead/adview?ai\u003dGeBsNgUyF461AXSjKhyenJgct6UGuJ4AYNwXgD8RTxUXENBpft4MNFsoBOw9h5-tODPt5-csTq0Y2jLDk2KtIWfhZDB01EexD16BPcki4kP-4x2-MF3fbaZvp3UzVVBt9OAuf3458Z1moaRv8QJ3t-LqBtyBSvLAD2VFcp9wIxol7QR9KaBit-3yEHdcozvSX-xVcmZ9sbR8LUmCEPYcLNsbSXTtfze6a5IihivlyLzAdPQJS4-N5BS878FSp6i9w3BFqQqe0AZYGztjz0j-gyrvI36V-GVgekGCkGG8ec11"},{"baseUrl":"https://www.youtube.com/pagead/adview?ai\u003d5kJ6HDQlJlhAgLaJQH9GMDMyyFoNx2MRmzOSin2uI-mwCKUYrD9dHOTFzkJ8YMKE4D81gGvLHtV5FvMtxfP2QHBX0V8kDM0Xvc4zmRbgCFShL0J6LAXnxLotsrq6AJSaKL8ilLVXpMOMyWpU23-tkgZo7a_wkGQafFI08uLK1v5eMBdww_O2-HTc6A93CV4NKdlJWXJW6cJ5L_t5MHX5n1p8fg2OzvPiaTm2eYJt0Kfx0unmv_8ONkhHGdjSpjDtlIUIzo4he2rzBRYMBILg3nBTOIIJbRrgJhQ2_h1i1k4s"},{"baseUrl":"https://www.youtube.com/pagead/adview?ai\u003dXBTtXutgne0v2KcobrESWv6Po27m64TtziK3KSf2pe711hIjzlqAK5ge_Ey5QRHoPWY11qn46H3oRPqIvz-bmkNs8fKdpFgQXW19lQP83GLgrECb5OssI-OLeoKbrVY-JWVV2IERhpn0eX9ORoTsjf13rcRTyFMNZ4DoYYmPiLt1D-XVc3sGSSmIXP5ST3i_1QKk71kOczRFB3DgxW7PVFM4WcYnjjPsI6FGAOpT_DjIYYZe81Bw2Gctk08Or32ZIEoN-hejTNwo93r9TdJOV5zGx5J9Qj1PG2nG5BPhmhPy"}],"errorPings":[{"baseUrl":"https://www.youtube.com/api/stats/ads?ver\u003d2\u0026ns\u003d1\u0026event\u003d6\u0026device\u003d1\u0026content_v\u003ddQw4w9WgXcQ\u0026el\u003ddetailpage\u0026ei\u003dUhEXC4OioX8NIkV1u2T0qx"}]},"clickthroughEndpoint":{"urlEndpoint":{"url":"https://www.googleadservices.com/pagead/aclk?sa\u003dL\u0026ai\u003dU2cC45YgvTy8tO4s7sAkgoQcdAZNq0DfSSNtF-XPvWjYbATmOR1YCjmohZYCUKcoVe9vKbvCnKz4-Bu438zENTJk6RZC98Y_52Udp8qa13OwhXiu6iSd-RNpr03VcVZdrGPVibPW8aA46n19vxyT0xoO5hLqE9vLzXTKG6FVWVLow5-Uy8RQ3eShozBi4OBnbWhpPksZ1mBSDudIFpUokPbspcJJnpuJB8MEOuLF2tfzMLKya892-n7AFhw0ufeQQsXMuqA6BCfNhOFdMO9jYL9aZLTIklsvWw0I2AftT6Ynz89SjN902sG-WEyKZBhCnZC9Sb6HF0iB3TfCHZh1ymGmaoBpckXWUO4YnMoyUqM-HCOTZsGFf3-iaj8ItsqQ9HDLyxz5J3O0cBgfixjumut8vPtIVqEig102YKMPTdGJhSndqKI-HFlfsHBtjM2eUGmeOcdxswVbPEQW9gJ3pahsO1tLG7UP9F3PNLm04Tflm94AkI0m","target":"TARGET_NEW_WINDOW"}},"playerVars":"ad_device\u003d1\u0026ad_flags\u003d0\u0026ad_logging_flag\u003d1\u0026ad_preroll\u003d1\u0026ad_tag\u003d6tSsev5YCCYjctuIZvaIWB0uEuHDODcIjruhnPyfkCLf6oNo96Vy4gjcONer8Zkv8tkWWCNsLzGJjWklPfzjovXVgEkw-WxGjLmKBLkhuFgXgAHxc_9GqXxO6d_knl6XOkCp9l6jwIuefIAbgZxQFNDMSE7Zxv-gRV9Mrlt3CMvcPxOY2DCTDZi3FFvVxPx4KoixYhYFONXFsLib4RODxZvr0579rRfm7cVJYbWTff7NbT6m2LRpDOY2z2baYAftSR8BUxGJh5ytoueadwlzCMi_G6RFrlzLPOnshLeYC-A-e8WNd7lxpgdJmprGQm5WU2MqRri_dE-UC2C4NrCbWaRFCbpbzWTaRS3wZIC26wHh9nACcmbqOxRGHL-7WV4uiYSLc9tgHgsZ5ud_jyJJHvP3HwZIL-GtVeRsezkzoVt7AQ7qlITFzdVM6Q4VJ-5cIxU6RGJnjdjHQXuCgVt5ZOoHB_PuAwUNY8ZMPsNKIiH9IINQ9qAzMwXV9i6qjuU1_zJaTATTdQBrrPAdk8nZn2TbDonomXwPnMr1Yu4biXZdgpW244YYSvRpWRNFLNHrdZD5sSNfNQa6vHFGFZP_8fILnQijvwp2YdUp5cby_rj__SAVzGw7axhHJXfCKFABDrzceceYl0_lZF0FzIeVNuoAJsut-huh0Bv04C4LKj3M531lxLRtkFYgpzT2UwV04hK_JV1ujXbQKdfExmtDvDOBfZVXa7ZIji6OAkTybYRmcHJPUcU_K3asQ9UF4msAX9Cybmtfi4xPhoEDZYuEgw0WuuUsBL4GQd7hUv9fKX_BSzk7JjlYeuJTWXJo3n1hk5GgZKMs_GppP52ytGzo61n9eUCqE5CGNdRoPGLWuh2ciJMdXeCE9FB-wmNwhSyXTrpbr2e4aDNtx7iZFJlKpYCFlxZRSQDLeRbPVAecu9GUJ-zESYvkqN2xM1oyYVWTlYSBK0poyXv6s8ptFR8yai-hD6TrFwAkior6t8dFxiFJO9IDggTFq9OaL3g1jKKK3IuZFXnffd64uQPJ5FC2uRHAC63a8RO35e33RtZAPd0gA3Q22aFllIYRY6dGpjS0MhwINUCH_1NDec6yWUWU-aJvrCCCSajKOWrJo4vx9kud2skCIiSMviv84dJG_OMNAGHxgL5FsU06qByOVY5qWlcswoPMTJ6X_lF2yLXZ60KOf6z0r0HmqPDXrct_cXDl0IU0BAG9R3JWVpG1WtQTCQAyr3hUm4E0grMmfxTRkdhxSYLYCdOotuiVWLCMHOVHDiONgHfVouxlnUfwWcF7UyK4Xt2d8KFGhyuORddT3vpZ0voYCtaI4WZqgsYBnkwqI2G5WxMW2Q6YRdXFFDh5UWhLK-3PYdodhC6Jd6t336Y9AuCsgHQpu85-GgFGlTvau6um0H7EPs8mvy5VMPht6EHYMMwwU1kZScErW5yjOZc4Nif9TGEFdkkU0sTaMdrw2vSQFn7LIfM2SKsrrFdugLqk3i9U","elementId":"kUpGIb5AsuvpE1q5HSZ2tuUBv8dHRnkqrpwP","trackingParams":"xUDO_dOHCdc5iwyO4o2VOUiuI6-TPENNfR9xN9BHLPqF","legacyInfoCardVastExtension":"","sodarExtensionData":{"siub":"OIsVNvY63u3bF4EkETR5HOdlIl_egMj7YGAm8eKVmDaK1KrHaEM6XxSwAMQMsvsm3OkKtDLcbwPxpKb1ajqKZkHeTOyXWch8oYK4sakjOt9pQ66kVs3aa_U0aI3Jz8I_mF253mJMF4ywoXzDhogYU7giBWTi0iAdqcNERhDOE5rpEBeXWmslUIgiEAM7zFXXdtX0QkbM","bgub":"v8-IQ9GEk4y4b8P2I3SAy42v5GR3AhtwCQEAHWHuFmi7GsnBGf5o3-hjPOfA0FQvr-d6kdh6yWHBj3d1j5Npc7wClOdYmyGrOP20","scs":"TY2A7p6cZGr08-tgV9LyJXIJ-LmG-0A3oGxfO8_vbT4eB5Stk3","bgp":"d7f01f6UUANmpGb2H_6GAFIajM9QhDsemRQogTZ54zYCMq8i73-s0C_BkfCP"},"externalVideoId":"NM4zJ6sxpXT"}}}}}}},{"adSlotRenderer":{"adSlotMetadata":{"slotId":"JcdR9PkONvdQGEIUpyjp:2","slotType":"SLOT_TYPE_PLAYER_BYTES","slotPhysicalPosition":1,"adSlotLoggingData":{"serializedSlotAdServingDataEntry":"aB_uoWzGxeCveCVT4dW8fs3DWAlQMiQ2gwGmHE8yumg0Xp_OrqO-HYjdp9xvpuih3hmJhtRpU5zRGZwMepfIHzesiZFO88P4yRIXwx9SnKGmILbEXNSl3C3eYXNyh87WglbmPkleuZ546BcYYNz9N4ZEyjG3lfoCBF9sv_IcX05cxoUtWAZTtlmek_t9dEKrKK_OHOoK"}},"fulfillmentContent":{"fulfilledLayout":{"playerBytesAdLayoutRenderer":{"adLayoutMetadata":{"layoutId":"zdQchujfOB61zPuvgslL","layoutType":"LAYOUT_TYPE_MEDIA","adLayoutLoggingData":{"serializedAdServingDataEntry":"DLS0XFZw_EEATO4iGnEtJKhyEUYKu-m7NEbSpcLeyS-w9pctG4PLEqWbiHurH__8co5ALONw4tisSkgHFn2rYKrYGGT4KTq2vu6yIMDcalstXDu4DgvGDtPnL9etXJB8ku_XQZbu4aJVMhyuldrAXa8tlVk3gQ2DzjaxVyiu0wdsrftbVafGa8i1R92GcUgW-0L9D5IaX0FF3XxoHxGx1VINV6lDEs3-DbUl1Azlp92GDg0sNn0mS3oo5nP4eoGVVtHdn_C1RowSPrtwtTNLtp-QzPNA1ss7BhE3dibxOHsHBJRQUm-PtuBk6pOQ_Gf5OXbJX6E3ReolmZ7qeWW2KK3uxko6UX3CYShZ0JHrUmhaPrZS3tbJnrFHVOdM78LX3ALaf238a-LraOdF"}},"renderingContent":{"instreamVideoAdRenderer":{"pings":{"impressionPings":[{"baseUrl":"https://www.youtube.com/pagead/adview?ai\u003dKtKHMS3dEXLOC3u2hxR4IbbqErAyjzk2tA7NxsnBc2PVhk_xbLh6fD99vyLhLsnb_M4wGOLSffZ0EI2dFU5u8sLivMVSURLEpaHBvMBdZNk6LtzBD9M_YtYzl81Z6nw2lUxBrzJZ4B5JXACbzcusdl1vuQSMAPqtF5T8UqqREcLvwy_e4_fbUOpghwfNEKsux55SMxlCM8ZZa2XBAMaelCYzYmiC_EKsF2CwsMIrWNT507V9P3M6sca_LVoDN7-R8H1ZCGiVxfOvXfoFZ-_kv1i7PS7SOJSmIHHwXUJwx_Mo"},{"baseUrl":"https://www.youtube.com/pagead/adview?ai\u003d_geWmKnG-Xhb7k38eFzUxzpExge9F6tcK5qf7xXtpAO9zCaeKjUt4okTEWAc3CQMeNj4Ha0ZfabFp4edsTbZl_5TEOgbXrHgplL_5jSdvgAJFESBUPunlXJVW6VDZsHfuvnzeERzMHEmOJhft2CtIJKGXZRhaJZbgsn75YhgcPvR5VXAImIRRm6mO3qySpzoaW2zRe0FA7_9yxUPRbQtJe6vG1QA4PqZwqsL65GZfnDIMYbYSBL4s8w2B8yfCDEUSb2ncbwRylLHFky34gAC8rzu0ccUD9QN8W49hhab4DqF"},{"baseUrl":"https://www.youtube.com/pagead/adview?ai\u003d0wQ508uMtG9kvvxz-vLG3DY-vlS4R6RmFKwGeNNII29Ku5Cnei6oWCJ6STyibTJuUn2EL7eR7tDYM1H8n9GQS1wv7wVl-iUCVeRKUgPy-ASxtdmNqhZZkvUq_keBlncf-GXjjXgItN3GreOLVu28gMUblfsh1TPFzB6Dasvs6WjH2qHh8c2xzK7D7yJqdBF2GfPyQluH_6H2-2GYfpsxVuHCEap-UfW9_8HjqwyVOUW3vQZgqi9uidY_fpnbH7haY5oWs65tyu1AAwaF1gdw1E8sM0HfoDsMVfT9iwbaushZ"},{"baseUrl":"https://www.youtube.com/pagead/adview?ai\u003d-ouyj3YsJoETIA1ipVm2VLZqhHShwJr9fDJrw-82aOrnd6_AmCxuZ9RAwr_BYZGrZE0z9hEDOCH6eTwJoQk3XksfTwIGWEcLtvNgo3voHh4rWkGbGKuu-0kSuMi5MhM1wDKXy7uL427rmAr5_7Pkb99EVWhWKKY15UB9WnsEZdevUSO2OyWvliudAIMJyNlOyy7Ul3D7j-ADl5nB3oHg8OQZCxeW1GDsW5wc5wDY4CCqYy61DYx-oGNmy-r4QoOMWkwTplt4DMqd0durSsJe9sM6elyg5HwvON9r-Zhnu_-1"},{"baseUrl":"https://www.youtube.com/pagead/adview?ai\u003dFGKJnfwhfQqRh-Mo7iFH9q4X84_lYHqCcx24e1EksrdZIRgD7LBY_XGfSFFlzGyxxr3eQ07FDKckTqFkZVy1AV-BBiNqd9oUfwwgPHQmhh6m00-fVIoQXtSiDxUFxqTutWuSod291pJbq1j5o14YifFyOG-Z-ofXLZlqtMfF-DkGvULe_tRZQLlNUq6uPc0kkY-QeE2WRO5SdBA81bAhUCS7u03oXu-mURc5rMUiDdalbWO9bl6kryZgTYXu3DKZC5Ewoi_E46k1TfXX9sZ0NzXH5DSIDklKQxrEx5FnBaOF"},{"baseUrl":"https://www.youtube.com/pagead/adview?ai\u003dDH5rSdsaTLdFN1EwxS6tzffFwgM_uP9EBjvku4Bl58k0vd9BapqtkbDVKfXlpVdykQq2fxpFWmbGlD4x-0VJH5bwwT-Ni-DG69cW7TMCozmM22raDZsl99rkigZcGFf9fYuEEkWNPzYomROAKynp6tNPo5YqlpJIKh3LwP1uFJFszC3XsIq0qQ3mqkrAdcXLOOXnNpdWmfrLdGuAHczN9vNcq-N_rQF8OgMED6N-ty9epXu1_oPQne2TUqUkST-LAH092m9LVXiMDf2946mcOT2ltF2tD90SgvT4OUPrqmOs"}],"errorPings":[{"baseUrl":"https://www.youtube.com/api/stats/ads?ver\u003d2\u0026ns\u003d1\u0026event\u003d6\u0026device\u003d1\u0026content_v\u003ddQw4w9WgXcQ\u0026el\u003ddetailpage\u0026ei\u003dQRG5IOetnuQKWwGAHJYbT4"}]},"clickthroughEndpoint":{"urlEndpoint":{"url":"https://www.googleadservices.com/pagead/aclk?sa\u003dL\u0026ai\u003d-zPrmLNFtBCwpJnyX3n6TxdkfaT2jDCLZXK8PkWfAXIaEH6ovgW_0R9jx4ddcWlfzxri_4pz_VMRP72D-MchKMm5Ez3BsEjl1n6iGhbhkQViOMLOF_fZR7zkoz0OzUKnWhZymOZKhTc5Bj1WCKxaWQZlVm38_G4ewFVD3bLemTwYBtMVqT1fKAnRfYeg8yy8R-BxdISFA-bHktO4CL2byM-NohO2m9bCqTmTZbqvopkloUCan9y_jcB6R3TKqD2nyDtFTRvn2k5Oz8-Nrmzy1AMUtNsPIBDNHpRjjBvXmOMiIC8ER4iAX1ZHy6x2vxwcqqs3vKlrxf7mxxApBMBk_q2qqbG7-5e4F5ZR-8tJ4RvFrIa3SGf1VarSd6ns_Dw4SDcF0nyAk5PeErtBtJoyLRZ24Swh17MFcBIEa81GoJoDrUcHNqwhuCoRRWCq81z-hsspyw_SHq6UplMZlc-fw1QqyFXr7zZhAiy2D1WiJZyS28cJsR1L","target":"TARGET_NEW_WINDOW"}},"playerVars":"ad_device\u003d1\u0026ad_flags\u003d0\u0026ad_logging_flag\u003d1\u0026ad_preroll\u003d1\u0026ad_tag\u003dijCSWj8M98qmrCGQoih-1OPKZulCz41H1l-avVLa3xydsZIHQEISWojdXDjV3qEGVmGPIEHQRGgPKQABSyVGCXB2Bu0IJyu8cekHIHfKiv2_rovuYVBVN4vmMax8pRRgpmxxdQeFPWCGszd-B_MfMidpkfn0V8yaPkVSGpIUW6qDUx_UmBvB7-jsfI3sSGqCA8kh3ZIZpZk2lCwtO9TDNfTyrtQP-ZnOnOF7mQ57JKmpQmww05Q-_fgt9RP-8PuXlqy5a7_VjcZpoNVlHclkAqsEHr8pC8YkoWi8wCKlYS48JNUkkBeQHK5A6RX7xhchgTuh7yAaneHgNdrUQaROse1Up0anwl6FQpxR6K-GPxV3rQhUkkrYDBKsBJdUKfIxtW9UOr5Qae8yT3_5VvGhZUDdzdxsc0JK5K_MAWk0B91WN9TI3XjRn3MSgJiP6oDFIpzpDG2kGbf1E6clHw4QLkTJuyVuA-7l6-AOID_cYTBCVsywZ4YfWfvcxf6JwJzMdk6gBjHkIT44MwV385-4sUbUuwV6d3g-f-EuzOGdXVnTFKQYehANxNk05CTyuSM2bWCAyVQ_zRkrwWvWSN98fC7RF2FBPhLG_Ltz5tZu7ebfl7vKx-94x_im4cgbjTKqUB8JfUVgIxBHVS-yvL7cKzz6KZb8I5BEh_4vVASAtiKbgNYpbAtg_i4uxE0TFj1P8VIv9P_SASylrENV_XNkp8jmBTNQG9K5HPguEFdvwJcsmgXuAsF3MZVM_aYgqcTJSbMwdqwSG00rupvwGNwNfNmLAf1yME2ltOl-9Z2CvbJu4HAETwgET1PD6-dJx62kBgDlnL5munBVKthFMv-Igosk-VrMBZDQNgLxQEDJv56--SGTbHEfQnlbqql-kupJ0vNfTqUz0h1bLAterniZmWOhH-XloIH4ESMAgl4xgCyU1KX3F07KgG6_H1HgP150OvmaGHYSUMoVowaBNEtDNyyXT6-NX1bkV0dbi5qPqZY3GVOCsBG_iLLr302c7YFci6UOi0F2g2VYCgw45D6uizzunx0m6vpWeE3JKMEcix8YDFdRAYFBDL0H0KN81NW9AZ4WAAvrfykifseBYmajHSeXi1oy-xEOgN4-Wh6xvEToGfe_jlp_S7rp4WHZ4w0xoS6emW2U0VFAH8plJ7yl0vAels9bOZOzVZ-JMNfq0fx2wKWxtjvMwflqtT_hBdRWADZBCs0Q3ijQ_UF1qrLo3h1OHGBJFG0YMOeLPhWH1-MOoSOa5JzCQhPFN_ZCTQy4DjVTXQmKACOQXfw6jAYtk2OG-DCo74wpENYkGRIa0w5nw-QDoZQPIie6WZD0NbkR5zA7jIRJSSn2fzqmLCltjhLga0CMb3c650JO2S8gYSPGpCpwVArHVLGZwPmMRT29XktxKsMNQzPJ_bFRkAHRnh3lmlNgfo2Uz-eUoH5W_SW3plnnL320rp3g6Zp5dlaq8TsfMmt4nOqd7onQ2_YvpgzWfLWg","elementId":"CyARej1zLg-0U01yoEAU3faTj8qoHbFJs4kx","trackingParams":"LtutWdoZTPU8JUnlZEX3ZkI0CTV2wMr_pQswUAN0CvgE","legacyInfoCardVastExtension":"","sodarExtensionData":{"siub":"MBrW8UjxcNkgrhxrx4otAsdCXX0e8L5dCOCUX2b1iuo3LYhkG8b3H291VgKm4q-fJduuM5S0GGp8Apjlh6jgAQfCAUOwFNTKXNo9NE_vkxtGDt0-CaZdRbqNIo4eAVza3Phfn183Nqndt62y60awaLzknOEj9y8V3zMeY3ZBG7urkW2YrRy314s1hOxbAWzKved2fOv8","bgub":"Kp7JWJ-jhcj2uDCKmvEUif0ftRyPi6L7v6NFIfk9OyTAvn2i4j5e4ssnCSHi9HtIAGAfrbHYgrcRLBFe6RWKAl2_EC67eTznntad","scs":"_FoeBgnfa0_scW-GcP9h6dGFlcwrZBWPrFkxPMwVFlBw7HV0y5","bgp":"Hc4tU0LKOJmEx3vdkSECHEIWUf6lTVoG7q4WTXbs7RA-qZsg9GnC4-ZJhRLG"},"externalVideoId":"kJplnkfZ2le"}}}}}}}],"frameworkUpdates":{"entityBatchUpdate":{"mutations":[{"entityKey":"xjkCdaAgY1O3YOdF5UF79d974hFakNFPULyFTS8B","type":"ENTITY_MUTATION_TYPE_REPLACE","payload":{"offlineabilityEntity":{"key":"PuBBdxPc9wLHLJ0O_4eFRwwQchz9GNjkt5j-PyhE","addToOfflineButtonState":"ADD_TO_OFFLINE_BUTTON_STATE_UNKNOWN"}}}],"timestamp":{"seconds":"1760878145","nanos":528741025}}}};var meta = document.createElement('meta'); meta.name = 'referrer'; meta.content = 'origin-when-cross-origin'; document.getElementsByTagName('head')[0].appendChild(meta);
\ No newline at end of file
@@ -0,0 +1,386 @@
+#include <cstdint>
+#include <cstdlib>
+#include <ctime>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+#include <libplatform/libplatform.h>
+#include <v8.h>
+
+#include "../src/jsonextract.h"
+#include "../src/scriptjson.h"
+
+/**
+ * Compares YMD.json.extract against the regex plus JSON.parse path youtube.js used before,
+ * both running end to end inside the embedded V8, on a saved player response script.
+ *
+ * Usage: ymd3-jsonbench [fixture] [iterations]
+ * */
+
+static int failures = 0;
+
+static void check(bool condition, const std::string& description)
+{
+    if (condition)
+        return;
+
+    std::cerr << "[FAIL] " << description << std::endl;
+    failures++;
+}
+
+static std::string loadFixture(const std::filesystem::path& path)
+{
+    std::ifstream input(path, std::ios::binary);
+
+    if (!input)
+        throw std::runtime_error("Failed to open fixture: " + path.string());
+
+    return std::string(std::istreambuf_iterator<char>(input), std::istreambuf_iterator<char>());
+}
+
+// The checks are written in ASCII, widened for the two byte representation
+template<typename CharT>
+static std::basic_string<CharT> widen(const std::string& str)
+{
+    return std::basic_string<CharT>(str.cbegin(), str.cend());
+}
+
+template<typename CharT>
+static std::optional<std::basic_string<CharT>> findPath(const std::string& text, const std::string& marker, const std::string& path)
+{
+    const auto wideText = widen<CharT>(text);
+    const auto wideMarker = widen<CharT>(marker);
+    const auto widePath = widen<CharT>(path);
+
+    const auto values = YMD::JsonExtractor<CharT>::findPathsAfter(wideText, wideMarker, { widePath });
+
+    if (!values || !values->front())
+        return std::optional<std::basic_string<CharT>>();
+
+    return std::basic_string<CharT>(*values->front());
+}
+
+template<typename CharT>
+static void checkExtractor(const std::string& representation)
+{
+    using Extractor = YMD::JsonExtractor<CharT>;
+
+    auto findObject = [] (const std::string& text, const std::string& marker) {
+        const auto wideText = widen<CharT>(text);
+        const auto found = Extractor::findObjectAfter(wideText, widen<CharT>(marker));
+
+        return found ? std::optional<std::basic_string<CharT>>(*found) : std::optional<std::basic_string<CharT>>();
+    };
+
+    // Scanning happens in 16 character lanes of 64 character blocks from the opening brace,
+    // so slide escapes across both edges
+    for (const std::string escape : { R"(\")", R"(\\)" })
+    {
+        for (size_t offset : { 13, 14, 15, 16, 17, 18, 61, 62, 63, 64, 65, 66 })
+        {
+            const std::string prefix = R"({"k":")";
+            const std::string value = std::string(offset - prefix.size(), 'a') + escape + "}]";
+            const std::string object = prefix + value + R"(","n":1})";
+            const std::string text = "x = " + object + "} trailing {";
+
+            const std::string where = representation + " escape " + escape + " at offset " + std::to_string(offset);
+
+            check(findObject(text, "x = ") == widen<CharT>(object), "object with " + where);
+            check(findPath<CharT>(text, "x = ", "k") == widen<CharT>("\"" + value + "\""), "string value with " + where);
+            check(findPath<CharT>(text, "x = ", "n") == widen<CharT>("1"), "member after " + where);
+        }
+    }
+
+    // A backslash escaped by another one must not escape the closing quote after it
+    for (size_t offset : { 14, 15, 16, 62, 63, 64 })
+    {
+        const std::string value = std::string(offset - 6, 'a') + R"(\\)";
+        const std::string text = R"(x = {"k":")" + value + R"(","n":[1]})";
+        const std::string where = representation + " escaped backslash before a closing quote at offset " + std::to_string(offset);
+
+        check(findPath<CharT>(text, "x = ", "k") == widen<CharT>("\"" + value + "\""), where);
+        check(findPath<CharT>(text, "x = ", "n") == widen<CharT>("[1]"), "member after " + where);
+    }
+
+    // Strings spanning several blocks, with an escaped quote right before every block edge
+    std::string longValue;
+
+    for (size_t i = 0; i < 4; i++)
+        longValue += std::string(62, 'b') + R"(\")";
+
+    const std::string longText = R"(x = {"long":")" + longValue + R"(","after":[1]})";
+    check(findPath<CharT>(longText, "x = ", "long") == widen<CharT>("\"" + longValue + "\""), representation + " string spanning blocks");
+    check(findPath<CharT>(longText, "x = ", "after") == widen<CharT>("[1]"), representation + " member after a string spanning blocks");
+
+    const std::string nested = R"(p = {"a":{"s":"}{][","b":{"c":[1,{"d":"]"}],"e":null}},"f":"\"{"};)";
+    const std::string nestedObject = nested.substr(4, nested.size() - 5);
+
+    check(findObject(nested, "p = ") == widen<CharT>(nestedObject), representation + " brackets inside strings");
+    check(findPath<CharT>(nested, "p = ", "a.s") == widen<CharT>(R"("}{][")"), representation + " string with brackets");
+    check(findPath<CharT>(nested, "p = ", "a.b.c") == widen<CharT>(R"([1,{"d":"]"}])"), representation + " dotted path to an array");
+    check(findPath<CharT>(nested, "p = ", "a.b.e") == widen<CharT>("null"), representation + " dotted path to a literal");
+    check(findPath<CharT>(nested, "p = ", "f") == widen<CharT>(R"("\"{")"), representation + " escaped quote before a bracket");
+    check(!findPath<CharT>(nested, "p = ", "a.missing"), representation + " missing path");
+    check(!findPath<CharT>(nested, "p = ", "a.s.deeper"), representation + " path through a string");
+
+    // Every path, including overlapping ones, is resolved by the same walk
+    const auto wideNested = widen<CharT>(nested);
+    const std::vector<std::basic_string<CharT>> pathBufs = {
+        widen<CharT>("a.b.e"), widen<CharT>("f"), widen<CharT>("a.b"), widen<CharT>("missing"), widen<CharT>("a.b.c")
+    };
+    const std::vector<typename Extractor::View> paths(pathBufs.cbegin(), pathBufs.cend());
+    const auto values = Extractor::findPathsAfter(wideNested, widen<CharT>("p = "), paths);
+
+    check(values && values->size() == 5
+          && (*values)[0] == widen<CharT>("null")
+          && (*values)[1] == widen<CharT>(R"("\"{")")
+          && (*values)[2] == widen<CharT>(R"({"c":[1,{"d":"]"}],"e":null})")
+          && !(*values)[3]
+          && (*values)[4] == widen<CharT>(R"([1,{"d":"]"}])"), representation + " several paths at once");
+
+    for (size_t length = 4; length < nested.size() - 2; length++)
+    {
+        const std::string where = representation + " truncated at " + std::to_string(length);
+
+        check(!findObject(nested.substr(0, length), "p = "), where);
+        check(!Extractor::findPathsAfter(widen<CharT>(nested.substr(0, length)), widen<CharT>("p = "), paths), "paths " + where);
+    }
+
+    check(!findObject(nested, "q = "), representation + " missing marker");
+}
+
+static v8::Local<v8::Value> runScript(v8::Isolate* isolate, v8::Local<v8::Context> context, const char* source)
+{
+    v8::TryCatch tryCatch(isolate);
+    v8::Local<v8::Script> script;
+    v8::Local<v8::Value> result;
+
+    if (!v8::Script::Compile(context, v8::String::NewFromUtf8(isolate, source).ToLocalChecked()).ToLocal(&script)
+        || !script->Run(context).ToLocal(&result))
+    {
+        throw std::runtime_error(std::string("Script failed: ") + *v8::String::Utf8Value(isolate, tryCatch.Exception()));
+    }
+
+    return result;
+}
+
+static void checkScriptApi(v8::Isolate* isolate, v8::Local<v8::Context> context)
+{
+    v8::HandleScope handleScope(isolate);
+
+    // Both paths have to agree on everything youtube.js reads
+    check(runScript(isolate, context, R"((() => {
+        const full = JSON.parse(fixture.match(/{.+}/gi)[0]);
+        const sparse = YMD.json.extract(fixture, marker, paths);
+
+        return JSON.stringify(full.videoDetails) === JSON.stringify(sparse.videoDetails)
+            && JSON.stringify(full.streamingData) === JSON.stringify(sparse.streamingData)
+            && JSON.stringify(full.playerConfig.audioConfig) === JSON.stringify(sparse.playerConfig.audioConfig)
+            && Object.keys(sparse).length === 3
+            && Object.keys(sparse.playerConfig).length === 1;
+    })())")->IsTrue(), "extract matches JSON.parse on the fixture");
+
+    check(runScript(isolate, context, R"((() => {
+        const result = YMD.json.extract(fixture, marker, [ "videoDetails.missing", "missing" ]);
+        return result !== null && Object.keys(result).length === 0;
+    })())")->IsTrue(), "missing paths are left out");
+
+    check(runScript(isolate, context, R"(YMD.json.extract(fixture.substring(0, fixture.length / 2), marker, paths))")->IsNull(),
+          "truncated fixture returns null");
+
+    // V8 keeps Latin-1 only text in the one byte representation, which is scanned separately
+    check(runScript(isolate, context, R"((() => {
+        const result = YMD.json.extract('x = {"café":{"é":[1]},"\\u65e5":2}', "x = ", [ "café.é", "日" ]);
+        return JSON.stringify(result) === '{"café":{"é":[1]}}';
+    })())")->IsTrue(), "one byte text with a path it cannot contain");
+
+    check(runScript(isolate, context, R"((() => {
+        const result = YMD.json.extract('x = {"日":{"k":"日\\""}}', "x = ", [ "日.k" ]);
+        return result["日"].k === '日"';
+    })())")->IsTrue(), "two byte text");
+}
+
+static double cpuMilliseconds()
+{
+    timespec time {};
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &time);
+
+    return static_cast<double>(time.tv_sec) * 1000.0 + static_cast<double>(time.tv_nsec) / 1000000.0;
+}
+
+static int64_t usedHeapSize(v8::Isolate* isolate)
+{
+    v8::HeapStatistics statistics;
+    isolate->GetHeapStatistics(&statistics);
+
+    return static_cast<int64_t>(statistics.used_heap_size());
+}
+
+/**
+ * Counts what garbage collections free, so allocations can be measured across them.
+ * */
+struct HeapCounter
+{
+    int64_t usedBeforeGC = 0;
+    int64_t freed = 0;
+
+    static void prologue(v8::Isolate* isolate, v8::GCType, v8::GCCallbackFlags, void* data)
+    {
+        static_cast<HeapCounter*>(data)->usedBeforeGC = usedHeapSize(isolate);
+    }
+
+    static void epilogue(v8::Isolate* isolate, v8::GCType, v8::GCCallbackFlags, void* data)
+    {
+        auto* counter = static_cast<HeapCounter*>(data);
+        counter->freed += counter->usedBeforeGC - usedHeapSize(isolate);
+    }
+};
+
+static void benchmark(v8::Isolate* isolate, v8::Local<v8::Context> context, const char* name, const char* source, int iterations)
+{
+    v8::HandleScope handleScope(isolate);
+
+    v8::Local<v8::Function> function = runScript(isolate, context, source).As<v8::Function>();
+    v8::Local<v8::Value> fixture = context->Global()->Get(context, v8::String::NewFromUtf8Literal(isolate, "fixture")).ToLocalChecked();
+
+    auto call = [&] {
+        return function->Call(context, v8::Undefined(isolate), 1, &fixture).ToLocalChecked();
+    };
+
+    // Warm up the JIT before measuring anything
+    for (int i = 0; i < 10; i++)
+        call();
+
+    isolate->LowMemoryNotification();
+    const int64_t heapBefore = usedHeapSize(isolate);
+
+    v8::Global<v8::Value> retained(isolate, call());
+
+    isolate->LowMemoryNotification();
+    const int64_t heapRetained = usedHeapSize(isolate) - heapBefore;
+    retained.Reset();
+
+    isolate->LowMemoryNotification();
+
+    HeapCounter counter;
+    isolate->AddGCPrologueCallback(HeapCounter::prologue, &counter);
+    isolate->AddGCEpilogueCallback(HeapCounter::epilogue, &counter);
+
+    const int64_t heapStart = usedHeapSize(isolate);
+    const double start = cpuMilliseconds();
+
+    for (int i = 0; i < iterations; i++)
+    {
+        v8::HandleScope iterationScope(isolate);
+        call();
+    }
+
+    const double cpuTime = (cpuMilliseconds() - start) / iterations;
+    const int64_t heapAllocated = (usedHeapSize(isolate) - heapStart + counter.freed) / iterations;
+
+    isolate->RemoveGCPrologueCallback(HeapCounter::prologue, &counter);
+    isolate->RemoveGCEpilogueCallback(HeapCounter::epilogue, &counter);
+
+    std::cout << name << ":\n"
+              << "  CPU time:       " << cpuTime << " ms per retrieval\n"
+              << "  Heap allocated: " << heapAllocated / 1024 << " KiB per retrieval\n"
+              << "  Heap retained:  " << heapRetained / 1024 << " KiB after GC\n";
+}
+
+/**
+ * Runs the checks and, if they pass, the benchmarks in the given isolate. Returns the number of failures.
+ * */
+static int runBenchmarks(v8::Isolate* isolate, const std::filesystem::path& fixturePath, int iterations)
+{
+    checkExtractor<char>("one byte");
+    checkExtractor<char16_t>("two byte");
+
+    try
+    {
+        const std::string fixtureText = loadFixture(fixturePath);
+
+        v8::Isolate::Scope isolateScope(isolate);
+        v8::HandleScope handleScope(isolate);
+
+        v8::Local<v8::ObjectTemplate> global = v8::ObjectTemplate::New(isolate);
+
+        v8::Local<v8::ObjectTemplate> ymdObj = v8::ObjectTemplate::New(isolate);
+        global->Set(isolate, "YMD", ymdObj);
+
+        ymdObj->Set(isolate, "json", YMD::ScriptJson::createTemplate(isolate));
+
+        v8::Local<v8::Context> context = v8::Context::New(isolate, nullptr, global);
+        v8::Context::Scope contextScope(context);
+
+        context->Global()->Set(context, v8::String::NewFromUtf8Literal(isolate, "fixture"),
+                               v8::String::NewFromUtf8(isolate, fixtureText.data(), v8::NewStringType::kNormal, static_cast<int>(fixtureText.size())).ToLocalChecked()).Check();
+
+        runScript(isolate, context, R"(
+            const marker = "var ytInitialPlayerResponse = ";
+            const paths = [ "videoDetails", "streamingData", "playerConfig.audioConfig" ];
+        )");
+
+        checkScriptApi(isolate, context);
+
+        if (failures == 0)
+        {
+            std::cout << "V8 " << v8::V8::GetVersion() << "\n"
+                      << "Fixture: " << fixturePath.string() << " (" << fixtureText.size() / 1024 << " KiB), "
+                      << iterations << " iterations" << std::endl;
+
+            benchmark(isolate, context, "regex + JSON.parse",
+                      "(text) => JSON.parse(text.match(/{.+}/gi)[0])", iterations);
+
+            benchmark(isolate, context, "YMD.json.extract",
+                      "(text) => YMD.json.extract(text, marker, paths)", iterations);
+        }
+    }
+    catch (std::runtime_error& e)
+    {
+        std::cerr << e.what() << std::endl;
+        failures++;
+    }
+
+    return failures;
+}
+
+int main(int argc, char* argv[])
+{
+    const std::filesystem::path fixturePath = argc > 1 ? argv[1] : "../bench/fixtures/player-response.js";
+    const int iterations = argc > 2 ? std::stoi(argv[2]) : 200;
+
+    const auto pathName = std::filesystem::path(argv[0]).string();
+    v8::V8::InitializeICUDefaultLocation(pathName.c_str());
+    v8::V8::InitializeExternalStartupData(pathName.c_str());
+
+    std::unique_ptr<v8::Platform> platform = v8::platform::NewDefaultPlatform();
+    v8::V8::InitializePlatform(platform.get());
+    v8::V8::Initialize();
+
+    v8::Isolate::CreateParams createParams;
+    createParams.array_buffer_allocator = v8::ArrayBuffer::Allocator::NewDefaultAllocator();
+    v8::Isolate* isolate = v8::Isolate::New(createParams);
+
+    const int failed = runBenchmarks(isolate, fixturePath, iterations);
+
+    isolate->Dispose();
+    delete createParams.array_buffer_allocator;
+
+    v8::V8::Dispose();
+
+#if V8_MAJOR_VERSION >= 10
+    v8::V8::DisposePlatform();
+#else
+    v8::V8::ShutdownPlatform();
+#endif
+
+    if (failed != 0)
+    {
+        std::cerr << failed << " check(s) failed." << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,161 @@
+#include <cstdlib>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "../src/streammarker.h"
+
+/**
+ * Checks the chunked matching YMD.retrieveUntil does in its cURL write callback,
+ * by replaying documents split at every possible chunk boundary.
+ *
+ * Usage: ymd3-streamcheck
+ * */
+
+static int failures = 0;
+
+static void check(bool condition, const std::string& description)
+{
+    if (condition)
+        return;
+
+    std::cerr << "[FAIL] " << description << std::endl;
+    failures++;
+}
+
+// What the marker should report for the data received so far
+static bool expectCaptured(const std::string& data, const std::string& begin, const std::optional<std::string>& end)
+{
+    const size_t beginPos = data.find(begin);
+
+    if (beginPos == std::string::npos)
+        return false;
+
+    return !end || data.find(*end, beginPos + begin.size()) != std::string::npos;
+}
+
+static void checkChunks(const std::string& document, const std::vector<size_t>& splits,
+                        const std::string& begin, const std::optional<std::string>& end, const std::string& description)
+{
+    YMD::StreamMarker marker(begin, end);
+    std::string data;
+    size_t from = 0;
+
+    for (size_t i = 0; i <= splits.size(); i++)
+    {
+        const size_t to = i < splits.size() ? splits[i] : document.size();
+        data.append(document, from, to - from);
+        from = to;
+
+        if (marker.advance(data) != expectCaptured(data, begin, end))
+        {
+            check(false, description + ", after " + std::to_string(data.size()) + " bytes");
+            return;
+        }
+    }
+}
+
+// Feeds the document split in two at every offset, then in chunks of every size
+static void checkAllSplits(const std::string& document, const std::string& begin, const std::optional<std::string>& end, const std::string& name)
+{
+    for (size_t split = 0; split <= document.size(); split++)
+        checkChunks(document, { split }, begin, end, name + " split at " + std::to_string(split));
+
+    for (size_t chunkSize = 1; chunkSize <= document.size(); chunkSize++)
+    {
+        std::vector<size_t> splits;
+
+        for (size_t split = chunkSize; split < document.size(); split += chunkSize)
+            splits.push_back(split);
+
+        checkChunks(document, splits, begin, end, name + " in chunks of " + std::to_string(chunkSize));
+    }
+}
+
+static void checkMarkers()
+{
+    const std::string needle = "var ytInitialPlayerResponse = ";
+    const std::string page = "<html>var ytInitialPlayer = 1; var ytInitialPlayerResponse = {\"a\":1};</script><p>";
+
+    checkAllSplits(page, needle, std::optional<std::string>(), "needle");
+    checkAllSplits(page, needle, std::string("</script>"), "begin and end");
+    checkAllSplits(page, "<script", std::optional<std::string>(), "missing needle");
+
+    // The end only counts after the begin, including ends overlapping it
+    const std::string tags = "<p> <link rel=\"image_src\" href=\"a.jpg\"> <p>";
+    checkAllSplits(tags, "<link rel=\"image_src\"", std::string(">"), "end before begin");
+    checkAllSplits("aaaa", "aa", std::string("aa"), "end overlapping begin");
+    checkAllSplits("abcabc", "abc", std::string("bc"), "end repeating begin");
+
+    YMD::StreamMarker sameChunk("<script src=\"/s/player/", std::string(">"));
+    check(sameChunk.advance("<head><script src=\"/s/player/x/base.js\" nonce=\"n\"></script>") && sameChunk.isCaptured(), "begin and end in one chunk");
+
+    YMD::StreamMarker stays("x");
+    check(stays.advance("x") && stays.advance("xy"), "captured markers stay captured");
+}
+
+static void checkUtf8()
+{
+    const std::vector<std::string> sequences = {
+        "\xC3\xA9",         // é
+        "\xE6\x97\xA5",     // 日
+        "\xF0\x9F\x98\x80"  // 😀
+    };
+
+    for (const std::string& sequence : sequences)
+    {
+        const std::string text = "ab" + sequence + "c";
+        const std::string name = std::to_string(sequence.size()) + " byte sequence";
+
+        for (size_t cut = 0; cut <= text.size(); cut++)
+        {
+            const bool inside = cut > 2 && cut < 2 + sequence.size();
+            const size_t expected = inside ? 2 : cut;
+
+            check(YMD::Utf8::completeLength(text.substr(0, cut)) == expected, name + " cut at " + std::to_string(cut));
+        }
+
+        // Replays the predicate side of the write callback, which must see every code point whole
+        for (size_t chunkSize = 1; chunkSize <= text.size(); chunkSize++)
+        {
+            std::string data;
+            std::string handedOut;
+            size_t offset = 0;
+            bool split = false;
+
+            for (size_t from = 0; from < text.size(); from += chunkSize)
+            {
+                data.append(text, from, chunkSize);
+
+                const size_t complete = YMD::Utf8::completeLength(data);
+                const std::string chunk = data.substr(offset, complete - offset);
+                offset = complete;
+
+                split |= !chunk.empty() && ((chunk[0] & 0xC0) == 0x80 || YMD::Utf8::completeLength(chunk) != chunk.size());
+                handedOut += chunk;
+            }
+
+            check(!split && handedOut == text, name + " in chunks of " + std::to_string(chunkSize));
+        }
+    }
+
+    check(YMD::Utf8::completeLength("") == 0, "empty data");
+    check(YMD::Utf8::completeLength("plain ascii") == 11, "ASCII data");
+}
+
+int main()
+{
+    checkMarkers();
+    checkUtf8();
+
+    if (failures != 0)
+    {
+        std::cerr << failures << " check(s) failed." << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::cout << "All checks passed." << std::endl;
+
+    return EXIT_SUCCESS;
+}
@@ -5,7 +5,12 @@ YMD.log("Initiating retrieval: " + YMD.inputURL);
 
 const originalURL = "https://www.youtube.com/watch?v=" + YMD.inputURL;
 
-const html = YMD.retrieve(originalURL);
+// Stop once the complete tags getMedia() and getThumbnail() look up have arrived
+const html = YMD.retrieveUntil(originalURL, [
+    { begin: "<script src=\"/s/player/", end: ">" },
+    { begin: "<link rel=\"image_src\"", end: ">" },
+    { begin: "var ytInitialPlayerResponse = ", end: "</script>" }
+]);
 
 const $ = cheerio.load(html);
 
@@ -140,8 +145,11 @@ function getMedia()
 
         if (text.includes("var ytInitialPlayerResponse = "))
         {
-            const videoConfigJSON = text.match(/{.+}/gi)[0];
-            videoConfig = JSON.parse(videoConfigJSON);
+            videoConfig = YMD.json.extract(text, "var ytInitialPlayerResponse = ", [
+                "videoDetails",
+                "streamingData",
+                "playerConfig.audioConfig"
+            ]);
 
             continue;
         }
@@ -2,12 +2,36 @@
  * Type definitions for the YMD scripting API.
  * */
 
+/**
+ * Either a string that must appear in the document, or a `begin` string followed by an `end` string.
+ * */
+type StreamMarker = String | { begin: String, end?: String };
+
+class YMDJson
+{
+    /**
+     * Finds the JSON object following the marker and parses only the given dot separated paths,
+     * returning an object with just those paths populated, or null if no object was found.
+     * */
+    static readonly extract: (text: String, marker: String, paths: String[]) => Object | null;
+}
+
 class YMD
 {
     static readonly inputURL: String;
     static readonly retrieve: (url: String) => String;
+    /**
+     * Retrieves the document until all markers were received or the predicate returns true,
+     * returning the (possibly truncated) text received so far.
+     *
+     * The predicate is called with the text received since its previous call. Chunks are only
+     * split between complete code points, but a match may span several calls, so predicates
+     * looking for a substring need to keep the preceding text themselves.
+     * */
+    static readonly retrieveUntil: (url: String, until: StreamMarker | StreamMarker[] | ((chunk: String) => boolean)) => String;
     static readonly getVersion: () => String;
     static readonly log: (message: String) => void;
+    static readonly json: typeof YMDJson;
 
     static videoURL: String;
     static videoName: String;
@@ -0,0 +1,396 @@
+#include "jsonextract.h"
+
+#include <algorithm>
+#include <cstdint>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif // __SSE2__
+
+namespace
+{
+    constexpr size_t blockSize = 64;
+
+    /**
+     * One bit per character of a block, bit i is set when character i belongs to the class.
+     * */
+    struct BlockMasks
+    {
+        uint64_t quotes = 0;
+        uint64_t backslashes = 0;
+        uint64_t opening = 0;
+        uint64_t closing = 0;
+    };
+
+    template<typename CharT>
+    BlockMasks scalarMasks(const CharT* data, size_t length)
+    {
+        BlockMasks masks;
+
+        for (size_t i = 0; i < length; i++)
+        {
+            const uint64_t bit = uint64_t(1) << i;
+
+            switch (data[i])
+            {
+                case '"':
+                    masks.quotes |= bit;
+                    break;
+                case '\\':
+                    masks.backslashes |= bit;
+                    break;
+                case '{':
+                case '[':
+                    masks.opening |= bit;
+                    break;
+                case '}':
+                case ']':
+                    masks.closing |= bit;
+                    break;
+                default:
+                    break;
+            }
+        }
+
+        return masks;
+    }
+
+#ifdef __SSE2__
+    __m128i loadSixteen(const char* data)
+    {
+        return _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+    }
+
+    // Non-ASCII code units saturate to 0 or 0xFF, neither of which is structural
+    __m128i loadSixteen(const char16_t* data)
+    {
+        return _mm_packus_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data)),
+                                _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 8)));
+    }
+
+    uint64_t matches(__m128i chars, char c)
+    {
+        return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(chars, _mm_set1_epi8(c))));
+    }
+
+    template<typename CharT>
+    BlockMasks simdMasks(const CharT* data)
+    {
+        BlockMasks masks;
+
+        for (size_t lane = 0; lane < blockSize; lane += 16)
+        {
+            const __m128i chars = loadSixteen(data + lane);
+
+            masks.quotes |= matches(chars, '"') << lane;
+            masks.backslashes |= matches(chars, '\\') << lane;
+            masks.opening |= (matches(chars, '{') | matches(chars, '[')) << lane;
+            masks.closing |= (matches(chars, '}') | matches(chars, ']')) << lane;
+        }
+
+        return masks;
+    }
+#endif // __SSE2__
+
+    template<typename CharT>
+    BlockMasks blockMasks(const CharT* data, size_t length)
+    {
+#ifdef __SSE2__
+        if (length == blockSize)
+            return simdMasks(data);
+#endif // __SSE2__
+
+        return scalarMasks(data, length);
+    }
+
+    /**
+     * Returns the characters escaped by a backslash. Backslashes are rare enough to walk one by one,
+     * an escape of the first character of the next block is carried over.
+     * */
+    uint64_t escapedMask(uint64_t backslashes, bool& carry)
+    {
+        uint64_t escaped = carry ? 1 : 0;
+        carry = false;
+
+        while (backslashes)
+        {
+            const int i = __builtin_ctzll(backslashes);
+            backslashes &= backslashes - 1;
+
+            if (escaped & (uint64_t(1) << i))
+                continue;
+
+            if (i == 63)
+                carry = true;
+            else
+                escaped |= uint64_t(1) << (i + 1);
+        }
+
+        return escaped;
+    }
+
+    /**
+     * Bit i is the parity of bits 0 to i, which turns unescaped quotes into a mask
+     * covering each opening quote and the string contents after it.
+     * */
+    uint64_t prefixXor(uint64_t bits)
+    {
+        bits ^= bits << 1;
+        bits ^= bits << 2;
+        bits ^= bits << 4;
+        bits ^= bits << 8;
+        bits ^= bits << 16;
+        bits ^= bits << 32;
+
+        return bits;
+    }
+}
+
+template<typename CharT>
+std::optional<typename YMD::JsonExtractor<CharT>::View> YMD::JsonExtractor<CharT>::findObjectAfter(View text, View marker)
+{
+    const std::optional<size_t> start = findObjectStart(text, marker);
+
+    if (!start)
+        return std::optional<View>();
+
+    const std::optional<size_t> end = skipStructured(text, *start);
+
+    if (!end)
+        return std::optional<View>();
+
+    return text.substr(*start, *end - *start);
+}
+
+template<typename CharT>
+std::optional<std::vector<std::optional<typename YMD::JsonExtractor<CharT>::View>>> YMD::JsonExtractor<CharT>::findPathsAfter(View text, View marker, const std::vector<View>& paths)
+{
+    const std::optional<size_t> start = findObjectStart(text, marker);
+
+    if (!start)
+        return std::optional<std::vector<std::optional<View>>>();
+
+    std::vector<std::vector<View>> segments(paths.size());
+    std::vector<size_t> candidates(paths.size());
+
+    for (size_t i = 0; i < paths.size(); i++)
+    {
+        View path = paths[i];
+
+        for (size_t separator = path.find('.'); separator != View::npos; separator = path.find('.'))
+        {
+            segments[i].push_back(path.substr(0, separator));
+            path.remove_prefix(separator + 1);
+        }
+
+        segments[i].push_back(path);
+        candidates[i] = i;
+    }
+
+    std::vector<std::optional<View>> values(paths.size());
+
+    if (!walkObject(text, *start, 0, segments, candidates, values))
+        return std::optional<std::vector<std::optional<View>>>();
+
+    return values;
+}
+
+template<typename CharT>
+std::optional<size_t> YMD::JsonExtractor<CharT>::findObjectStart(View text, View marker)
+{
+    const size_t markerPos = text.find(marker);
+
+    if (markerPos == View::npos)
+        return std::optional<size_t>();
+
+    const size_t start = skipWhitespace(text, markerPos + marker.size());
+
+    if (start >= text.size() || text[start] != '{')
+        return std::optional<size_t>();
+
+    return start;
+}
+
+/**
+ * Walks the members of the object at pos once, descending only into values that requested paths
+ * continue through. Returns the position just past the object.
+ * */
+template<typename CharT>
+std::optional<size_t> YMD::JsonExtractor<CharT>::walkObject(View text, size_t pos, size_t depth,
+                                                            const std::vector<std::vector<View>>& segments,
+                                                            const std::vector<size_t>& candidates,
+                                                            std::vector<std::optional<View>>& values)
+{
+    pos = skipWhitespace(text, pos + 1);
+
+    if (pos < text.size() && text[pos] == '}')
+        return pos + 1;
+
+    std::vector<size_t> deeper;
+
+    while (pos < text.size() && text[pos] == '"')
+    {
+        const std::optional<size_t> keyEnd = skipString(text, pos);
+
+        if (!keyEnd)
+            return std::optional<size_t>();
+
+        const View key = text.substr(pos + 1, *keyEnd - pos - 2);
+
+        pos = skipWhitespace(text, *keyEnd);
+
+        if (pos >= text.size() || text[pos] != ':')
+            return std::optional<size_t>();
+
+        const size_t valueStart = skipWhitespace(text, pos + 1);
+
+        bool wanted = false;
+        deeper.clear();
+
+        for (const size_t candidate : candidates)
+        {
+            if (segments[candidate][depth] != key)
+                continue;
+
+            if (segments[candidate].size() == depth + 1)
+                wanted = true;
+            else
+                deeper.push_back(candidate);
+        }
+
+        std::optional<size_t> valueEnd;
+
+        if (!deeper.empty() && valueStart < text.size() && text[valueStart] == '{')
+            valueEnd = walkObject(text, valueStart, depth + 1, segments, deeper, values);
+        else
+            valueEnd = skipValue(text, valueStart);
+
+        if (!valueEnd)
+            return std::optional<size_t>();
+
+        if (wanted)
+        {
+            for (const size_t candidate : candidates)
+            {
+                if (segments[candidate].size() == depth + 1 && segments[candidate][depth] == key)
+                    values[candidate] = text.substr(valueStart, *valueEnd - valueStart);
+            }
+        }
+
+        pos = skipWhitespace(text, *valueEnd);
+
+        if (pos < text.size() && text[pos] == '}')
+            return pos + 1;
+
+        if (pos >= text.size() || text[pos] != ',')
+            return std::optional<size_t>();
+
+        pos = skipWhitespace(text, pos + 1);
+    }
+
+    return std::optional<size_t>();
+}
+
+template<typename CharT>
+size_t YMD::JsonExtractor<CharT>::skipWhitespace(View text, size_t pos)
+{
+    while (pos < text.size() && (text[pos] == ' ' || text[pos] == '\t' || text[pos] == '\n' || text[pos] == '\r'))
+        pos++;
+
+    return pos;
+}
+
+template<typename CharT>
+std::optional<size_t> YMD::JsonExtractor<CharT>::skipValue(View text, size_t pos)
+{
+    if (pos >= text.size())
+        return std::optional<size_t>();
+
+    if (text[pos] == '"')
+        return skipString(text, pos);
+
+    if (text[pos] == '{' || text[pos] == '[')
+        return skipStructured(text, pos);
+
+    // Numbers and literals end at the next delimiter
+    size_t end = pos;
+
+    while (end < text.size() && text[end] != ',' && text[end] != '}' && text[end] != ']'
+           && text[end] != ' ' && text[end] != '\t' && text[end] != '\n' && text[end] != '\r')
+    {
+        end++;
+    }
+
+    if (end == pos || end == text.size())
+        return std::optional<size_t>();
+
+    return end;
+}
+
+/**
+ * Skips the string starting at pos, only unescaped quotes can end it.
+ * */
+template<typename CharT>
+std::optional<size_t> YMD::JsonExtractor<CharT>::skipString(View text, size_t pos)
+{
+    bool escapeCarry = false;
+
+    for (size_t blockStart = pos + 1; blockStart < text.size(); blockStart += blockSize)
+    {
+        const BlockMasks masks = blockMasks(text.data() + blockStart, std::min(blockSize, text.size() - blockStart));
+        const uint64_t quotes = masks.quotes & ~escapedMask(masks.backslashes, escapeCarry);
+
+        if (quotes)
+            return blockStart + __builtin_ctzll(quotes) + 1;
+    }
+
+    return std::optional<size_t>();
+}
+
+/**
+ * Skips the object or array starting at pos and returns the position just past it.
+ *
+ * Strings are classified for a whole block at once, so only brackets outside of them
+ * are visited one by one.
+ * */
+template<typename CharT>
+std::optional<size_t> YMD::JsonExtractor<CharT>::skipStructured(View text, size_t pos)
+{
+    size_t depth = 0;
+    bool inString = false;
+    bool escapeCarry = false;
+
+    for (size_t blockStart = pos; blockStart < text.size(); blockStart += blockSize)
+    {
+        const BlockMasks masks = blockMasks(text.data() + blockStart, std::min(blockSize, text.size() - blockStart));
+        const uint64_t quotes = masks.quotes & ~escapedMask(masks.backslashes, escapeCarry);
+        const uint64_t strings = prefixXor(quotes) ^ (inString ? ~uint64_t(0) : 0);
+
+        inString = strings >> 63;
+
+        uint64_t brackets = (masks.opening | masks.closing) & ~strings;
+
+        while (brackets)
+        {
+            const int i = __builtin_ctzll(brackets);
+            brackets &= brackets - 1;
+
+            if (masks.opening & (uint64_t(1) << i))
+            {
+                depth++;
+                continue;
+            }
+
+            if (depth == 0)
+                return std::optional<size_t>();
+
+            if (--depth == 0)
+                return blockStart + i + 1;
+        }
+    }
+
+    return std::optional<size_t>();
+}
+
+template class YMD::JsonExtractor<char>;
+template class YMD::JsonExtractor<char16_t>;
@@ -0,0 +1,60 @@
+#ifndef YMD3_JSONEXTRACT_H
+#define YMD3_JSONEXTRACT_H
+
+#include <optional>
+#include <string_view>
+#include <vector>
+
+namespace YMD
+{
+    /**
+     * Locates JSON values inside larger documents without parsing them.
+     *
+     * Only the structure is scanned, so callers can hand just the slices they
+     * need to a real parser. Malformed or truncated input yields an empty optional.
+     *
+     * CharT is char for one byte text (UTF-8 or Latin-1) and char16_t for UTF-16,
+     * so both V8 string representations can be scanned as they are.
+     * */
+    template<typename CharT>
+    class JsonExtractor
+    {
+        public:
+            using View = std::basic_string_view<CharT>;
+
+            /**
+             * Finds the balanced JSON object following the first occurrence of the marker.
+             * */
+            [[nodiscard]] static std::optional<View> findObjectAfter(View text, View marker);
+
+            /**
+             * Finds the values at dot separated paths of object keys, e.g. "playerConfig.audioConfig",
+             * in the object following the marker. All paths are resolved in a single pass over the object,
+             * and the values of paths that are not present are left empty.
+             *
+             * Keys are compared with their raw, still escaped, source representation.
+             * */
+            [[nodiscard]] static std::optional<std::vector<std::optional<View>>> findPathsAfter(View text, View marker, const std::vector<View>& paths);
+
+        private:
+            static std::optional<size_t> findObjectStart(View text, View marker);
+
+            static std::optional<size_t> walkObject(View text, size_t pos, size_t depth,
+                                                    const std::vector<std::vector<View>>& segments,
+                                                    const std::vector<size_t>& candidates,
+                                                    std::vector<std::optional<View>>& values);
+
+            static size_t skipWhitespace(View text, size_t pos);
+
+            static std::optional<size_t> skipValue(View text, size_t pos);
+
+            static std::optional<size_t> skipString(View text, size_t pos);
+
+            static std::optional<size_t> skipStructured(View text, size_t pos);
+    };
+
+    extern template class JsonExtractor<char>;
+    extern template class JsonExtractor<char16_t>;
+}
+
+#endif //YMD3_JSONEXTRACT_H
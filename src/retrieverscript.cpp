@@ -6,11 +6,14 @@
 #include <string>
 #include <filesystem>
 #include <regex>
+#include <algorithm>
 
 #include <libplatform/libplatform.h>
 #include <iostream>
 
 #include "retrieverscript.h"
+#include "scriptjson.h"
+#include "streammarker.h"
 #include "version.h"
 
 #include <curl/curl.h>
@@ -41,6 +44,39 @@ static void log(const v8::FunctionCallbackInfo<v8::Value>& args)
     }
 }
 
+// CURLOPT_WRITEFUNCTION requires a function pointer with these types, luckily the pointers don't matter
+using CURLWriteFuncPtr = decltype(&std::fwrite);
+
+static CURLcode performTransfer(const char* url, CURLWriteFuncPtr writeFunction, void* writeData)
+{
+    CURL *curl = curl_easy_init();
+
+    if (!curl)
+        return CURLE_FAILED_INIT;
+
+    curl_easy_setopt(curl, CURLOPT_URL, url);
+    curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, writeFunction);
+    curl_easy_setopt(curl, CURLOPT_WRITEDATA, writeData);
+    CURLcode res = curl_easy_perform(curl);
+
+    curl_easy_cleanup(curl);
+
+    return res;
+}
+
+static void throwTransferError(v8::Isolate* isolate, CURLcode res)
+{
+    if (res == CURLE_FAILED_INIT)
+    {
+        isolate->ThrowException(v8::String::NewFromUtf8Literal(isolate, "Failed to init cURL."));
+        return;
+    }
+
+    char err[1024];
+    snprintf(err, sizeof(err), "cURL error: %s\n", curl_easy_strerror(res));
+    isolate->ThrowException(v8::String::NewFromUtf8(isolate, err).ToLocalChecked());
+}
+
 static void retrieve(const v8::FunctionCallbackInfo<v8::Value>& args)
 {
     v8::Isolate* isolate = args.GetIsolate();
@@ -66,16 +102,6 @@ static void retrieve(const v8::FunctionCallbackInfo<v8::Value>& args)
 
     std::cout << "Retrieval from " << strURL << " requested." << std::endl;
 
-    CURL *curl = curl_easy_init();
-
-    if (!curl)
-    {
-        args.GetIsolate()->ThrowException(v8::String::NewFromUtf8Literal(args.GetIsolate(), "Failed to init cURL."));
-        return;
-    }
-
-    // CURLOPT_WRITEFUNCTION requires a function pointer with these types, luckily the pointers don't matter
-    using CURLWriteFuncPtr = decltype(&std::fwrite);
     CURLWriteFuncPtr writeFunction = [](const void* ptr, size_t size, size_t nmemb, auto* stream) -> size_t {
         auto* srcPtr = static_cast<const char*>(ptr);
         auto* destPtr = reinterpret_cast<std::vector<char>*>(stream);
@@ -85,28 +111,210 @@ static void retrieve(const v8::FunctionCallbackInfo<v8::Value>& args)
 
     std::vector<char> data;
 
-    CURLcode res;
-    curl_easy_setopt(curl, CURLOPT_URL, strURL);
-    curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, writeFunction);
-    curl_easy_setopt(curl, CURLOPT_WRITEDATA, &data);
-    res = curl_easy_perform(curl);
+    CURLcode res = performTransfer(strURL, writeFunction, &data);
 
     if (res != CURLE_OK)
     {
-        char err[1024];
-        snprintf(err, sizeof(err), "cURL error: %s\n", curl_easy_strerror(res));
-        args.GetIsolate()->ThrowException(v8::String::NewFromUtf8Literal(args.GetIsolate(), err));
-        curl_easy_cleanup(curl);
+        throwTransferError(isolate, res);
         return;
     }
 
-    curl_easy_cleanup(curl);
-
     std::string resultStr(data.cbegin(), data.cend());
     v8::Local<v8::String> result = v8::String::NewFromUtf8(isolate, resultStr.c_str(), v8::NewStringType::kNormal, resultStr.size()).ToLocalChecked();
     args.GetReturnValue().Set(scope.Escape(result));
 }
 
+namespace
+{
+    struct StreamState
+    {
+        v8::Isolate* isolate = nullptr;
+        v8::Local<v8::Context> context;
+        v8::Local<v8::Function> predicate;
+
+        std::vector<YMD::StreamMarker> markers;
+        std::string data;
+
+        // Bytes of data already handed to the predicate
+        size_t predicateOffset = 0;
+
+        bool finished = false;
+        bool failed = false;
+    };
+}
+
+static std::optional<YMD::StreamMarker> parseStreamMarker(v8::Isolate* isolate, v8::Local<v8::Context> context, v8::Local<v8::Value> value)
+{
+    if (value->IsString())
+    {
+        std::string begin = *v8::String::Utf8Value(isolate, value);
+
+        if (begin.empty())
+            return std::optional<YMD::StreamMarker>();
+
+        return YMD::StreamMarker(std::move(begin));
+    }
+
+    if (!value->IsObject())
+        return std::optional<YMD::StreamMarker>();
+
+    v8::Local<v8::Object> obj = value.As<v8::Object>();
+
+    v8::Local<v8::Value> beginValue;
+    if (!obj->Get(context, v8::String::NewFromUtf8Literal(isolate, "begin")).ToLocal(&beginValue) || !beginValue->IsString())
+        return std::optional<YMD::StreamMarker>();
+
+    std::string begin = *v8::String::Utf8Value(isolate, beginValue);
+
+    v8::Local<v8::Value> endValue;
+    if (!obj->Get(context, v8::String::NewFromUtf8Literal(isolate, "end")).ToLocal(&endValue))
+        return std::optional<YMD::StreamMarker>();
+
+    std::optional<std::string> end;
+
+    if (endValue->IsString())
+        end = *v8::String::Utf8Value(isolate, endValue);
+    else if (!endValue->IsUndefined())
+        return std::optional<YMD::StreamMarker>();
+
+    if (begin.empty() || (end && end->empty()))
+        return std::optional<YMD::StreamMarker>();
+
+    return YMD::StreamMarker(std::move(begin), std::move(end));
+}
+
+static void retrieveUntil(const v8::FunctionCallbackInfo<v8::Value>& args)
+{
+    v8::Isolate* isolate = args.GetIsolate();
+    v8::EscapableHandleScope scope(isolate);
+    v8::Local<v8::Context> context = isolate->GetCurrentContext();
+
+    if (args.Length() != 2)
+    {
+        isolate->ThrowException(v8::String::NewFromUtf8Literal(isolate, "Bad parameters: Expected parameters 'url' and 'until'."));
+        return;
+    }
+
+    if (!args[0]->IsString())
+    {
+        isolate->ThrowException(v8::String::NewFromUtf8Literal(isolate, "Bad parameter 'url': Must be a string."));
+        return;
+    }
+
+    StreamState state;
+    state.isolate = isolate;
+    state.context = context;
+
+    v8::Local<v8::Value> until = args[1];
+
+    if (until->IsFunction())
+    {
+        state.predicate = until.As<v8::Function>();
+    }
+    else if (until->IsArray())
+    {
+        v8::Local<v8::Array> markerArray = until.As<v8::Array>();
+
+        for (uint32_t i = 0; i < markerArray->Length(); i++)
+        {
+            v8::Local<v8::Value> markerValue;
+            std::optional<YMD::StreamMarker> marker;
+
+            if (!markerArray->Get(context, i).ToLocal(&markerValue) || !(marker = parseStreamMarker(isolate, context, markerValue)))
+            {
+                isolate->ThrowException(v8::String::NewFromUtf8Literal(isolate, "Bad parameter 'until': Markers must be non-empty strings or { begin, end } objects."));
+                return;
+            }
+
+            state.markers.push_back(std::move(*marker));
+        }
+
+        if (state.markers.empty())
+        {
+            isolate->ThrowException(v8::String::NewFromUtf8Literal(isolate, "Bad parameter 'until': At least one marker is required."));
+            return;
+        }
+    }
+    else
+    {
+        std::optional<YMD::StreamMarker> marker = parseStreamMarker(isolate, context, until);
+
+        if (!marker)
+        {
+            isolate->ThrowException(v8::String::NewFromUtf8Literal(isolate, "Bad parameter 'until': Must be a predicate function, a marker or an array of markers."));
+            return;
+        }
+
+        state.markers.push_back(std::move(*marker));
+    }
+
+    v8::String::Utf8Value utf8(isolate, args[0]);
+    char* strURL = *utf8;
+
+    std::cout << "Streaming retrieval from " << strURL << " requested." << std::endl;
+
+    CURLWriteFuncPtr writeFunction = [](const void* ptr, size_t size, size_t nmemb, auto* stream) -> size_t {
+        auto* srcPtr = static_cast<const char*>(ptr);
+        auto* streamState = reinterpret_cast<StreamState*>(stream);
+        const size_t chunkSize = size * nmemb;
+
+        streamState->data.append(srcPtr, chunkSize);
+
+        if (!streamState->predicate.IsEmpty())
+        {
+            // Hold back a code point split across cURL chunks until the rest of it arrives
+            const size_t completeLength = YMD::Utf8::completeLength(streamState->data);
+
+            if (completeLength == streamState->predicateOffset)
+                return chunkSize;
+
+            v8::HandleScope handleScope(streamState->isolate);
+
+            const char* textPtr = streamState->data.data() + streamState->predicateOffset;
+            const size_t textSize = completeLength - streamState->predicateOffset;
+            streamState->predicateOffset = completeLength;
+
+            v8::Local<v8::Value> chunk = v8::String::NewFromUtf8(streamState->isolate, textPtr, v8::NewStringType::kNormal, static_cast<int>(textSize)).ToLocalChecked();
+            v8::Local<v8::Value> predicateResult;
+
+            // Leave the exception pending, it propagates to the script once we return
+            if (!streamState->predicate->Call(streamState->context, v8::Undefined(streamState->isolate), 1, &chunk).ToLocal(&predicateResult))
+            {
+                streamState->failed = true;
+                return 0;
+            }
+
+            streamState->finished = predicateResult->BooleanValue(streamState->isolate);
+        }
+        else
+        {
+            streamState->finished = std::all_of(streamState->markers.begin(), streamState->markers.end(), [streamState] (YMD::StreamMarker& marker) {
+                return marker.advance(streamState->data);
+            });
+        }
+
+        // Returning a short count makes cURL abort the transfer
+        return streamState->finished ? 0 : chunkSize;
+    };
+
+    CURLcode res = performTransfer(strURL, writeFunction, &state);
+
+    if (state.failed)
+        return;
+
+    if (res != CURLE_OK && !(res == CURLE_WRITE_ERROR && state.finished))
+    {
+        throwTransferError(isolate, res);
+        return;
+    }
+
+    if (state.finished)
+        std::cout << "Streaming retrieval finished early after " << state.data.size() << " bytes." << std::endl;
+
+    v8::Local<v8::String> result = v8::String::NewFromUtf8(isolate, state.data.c_str(), v8::NewStringType::kNormal, static_cast<int>(state.data.size())).ToLocalChecked();
+    args.GetReturnValue().Set(scope.Escape(result));
+}
+
 YMD::ScriptingEngine::ScriptingEngine(const std::filesystem::path& execLocation)
 {
     if (engineInstance != nullptr)
@@ -191,7 +399,11 @@ std::optional<YMD::RetrieverResult> YMD::RetrieverScript::run(const std::string&
 
     ymdObj->Set(isolate, "getVersion", v8::FunctionTemplate::New(isolate, getVersion));
     ymdObj->Set(isolate, "retrieve", v8::FunctionTemplate::New(isolate, retrieve));
+    ymdObj->Set(isolate, "retrieveUntil", v8::FunctionTemplate::New(isolate, retrieveUntil));
     ymdObj->Set(isolate, "log", v8::FunctionTemplate::New(isolate, log));
+
+    ymdObj->Set(isolate, "json", YMD::ScriptJson::createTemplate(isolate));
+
     ymdObj->Set(isolate, "inputURL", v8::String::NewFromUtf8(isolate, inputURL.c_str()).ToLocalChecked());
 
     v8::Local<v8::Context> context = v8::Context::New(isolate, nullptr, global);
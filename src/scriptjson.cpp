@@ -0,0 +1,203 @@
+#include "scriptjson.h"
+#include "jsonextract.h"
+
+#include <string>
+#include <vector>
+
+namespace
+{
+    // Copies the string in the representation V8 already stores it in, so no transcoding is needed
+    std::string readString(v8::Isolate* isolate, v8::Local<v8::String> str, char)
+    {
+        std::string buffer(str->Length(), '\0');
+        str->WriteOneByte(isolate, reinterpret_cast<uint8_t*>(buffer.data()), 0, -1, v8::String::NO_NULL_TERMINATION);
+
+        return buffer;
+    }
+
+    std::u16string readString(v8::Isolate* isolate, v8::Local<v8::String> str, char16_t)
+    {
+        std::u16string buffer(str->Length(), u'\0');
+        str->Write(isolate, reinterpret_cast<uint16_t*>(buffer.data()), 0, -1, v8::String::NO_NULL_TERMINATION);
+
+        return buffer;
+    }
+
+    v8::MaybeLocal<v8::String> newString(v8::Isolate* isolate, std::string_view str)
+    {
+        return v8::String::NewFromOneByte(isolate, reinterpret_cast<const uint8_t*>(str.data()), v8::NewStringType::kNormal, static_cast<int>(str.size()));
+    }
+
+    v8::MaybeLocal<v8::String> newString(v8::Isolate* isolate, std::u16string_view str)
+    {
+        return v8::String::NewFromTwoByte(isolate, reinterpret_cast<const uint16_t*>(str.data()), v8::NewStringType::kNormal, static_cast<int>(str.size()));
+    }
+
+    /**
+     * Finds the values of the paths in the object after the marker and returns them as strings,
+     * leaving the ones not present empty. Returns false if there is no complete object.
+     * */
+    template<typename CharT>
+    bool findSlices(v8::Isolate* isolate, v8::Local<v8::String> text, v8::Local<v8::String> marker,
+                    const std::vector<v8::Local<v8::String>>& paths, std::vector<v8::Local<v8::String>>& slices)
+    {
+        using Extractor = YMD::JsonExtractor<CharT>;
+
+        // One byte text cannot contain anything outside of Latin-1
+        auto representable = [] (v8::Local<v8::String> str) {
+            return sizeof(CharT) > 1 || str->ContainsOnlyOneByte();
+        };
+
+        if (!representable(marker))
+            return false;
+
+        const std::basic_string<CharT> textBuf = readString(isolate, text, CharT());
+        const std::basic_string<CharT> markerBuf = readString(isolate, marker, CharT());
+
+        std::vector<std::basic_string<CharT>> pathBufs;
+        std::vector<typename Extractor::View> pathViews;
+        std::vector<size_t> pathIndices;
+
+        pathBufs.reserve(paths.size());
+
+        for (size_t i = 0; i < paths.size(); i++)
+        {
+            if (!representable(paths[i]))
+                continue;
+
+            pathViews.push_back(pathBufs.emplace_back(readString(isolate, paths[i], CharT())));
+            pathIndices.push_back(i);
+        }
+
+        const auto values = Extractor::findPathsAfter(textBuf, markerBuf, pathViews);
+
+        if (!values)
+            return false;
+
+        slices.resize(paths.size());
+
+        for (size_t i = 0; i < values->size(); i++)
+        {
+            if ((*values)[i] && !newString(isolate, *(*values)[i]).ToLocal(&slices[pathIndices[i]]))
+                return false;
+        }
+
+        return true;
+    }
+}
+
+v8::Local<v8::ObjectTemplate> YMD::ScriptJson::createTemplate(v8::Isolate* isolate)
+{
+    v8::Local<v8::ObjectTemplate> jsonObj = v8::ObjectTemplate::New(isolate);
+
+    jsonObj->Set(isolate, "extract", v8::FunctionTemplate::New(isolate, extract));
+
+    return jsonObj;
+}
+
+void YMD::ScriptJson::extract(const v8::FunctionCallbackInfo<v8::Value>& args)
+{
+    v8::Isolate* isolate = args.GetIsolate();
+    v8::EscapableHandleScope scope(isolate);
+    v8::Local<v8::Context> context = isolate->GetCurrentContext();
+
+    if (args.Length() != 3)
+    {
+        isolate->ThrowException(v8::String::NewFromUtf8Literal(isolate, "Bad parameters: Expected parameters 'text', 'marker' and 'paths'."));
+        return;
+    }
+
+    if (!args[0]->IsString())
+    {
+        isolate->ThrowException(v8::String::NewFromUtf8Literal(isolate, "Bad parameter 'text': Must be a string."));
+        return;
+    }
+
+    if (!args[1]->IsString())
+    {
+        isolate->ThrowException(v8::String::NewFromUtf8Literal(isolate, "Bad parameter 'marker': Must be a string."));
+        return;
+    }
+
+    if (!args[2]->IsArray())
+    {
+        isolate->ThrowException(v8::String::NewFromUtf8Literal(isolate, "Bad parameter 'paths': Must be an array of strings."));
+        return;
+    }
+
+    v8::Local<v8::Array> pathArray = args[2].As<v8::Array>();
+    std::vector<v8::Local<v8::String>> paths;
+
+    for (uint32_t i = 0; i < pathArray->Length(); i++)
+    {
+        v8::Local<v8::Value> pathValue;
+
+        if (!pathArray->Get(context, i).ToLocal(&pathValue) || !pathValue->IsString())
+        {
+            isolate->ThrowException(v8::String::NewFromUtf8Literal(isolate, "Bad parameter 'paths': Must be an array of strings."));
+            return;
+        }
+
+        paths.push_back(pathValue.As<v8::String>());
+    }
+
+    v8::Local<v8::String> text = args[0].As<v8::String>();
+    v8::Local<v8::String> marker = args[1].As<v8::String>();
+    std::vector<v8::Local<v8::String>> slices;
+
+    const bool found = text->IsOneByte()
+        ? findSlices<char>(isolate, text, marker, paths, slices)
+        : findSlices<char16_t>(isolate, text, marker, paths, slices);
+
+    if (!found)
+    {
+        args.GetReturnValue().SetNull();
+        return;
+    }
+
+    v8::Local<v8::Object> result = v8::Object::New(isolate);
+
+    for (size_t i = 0; i < paths.size(); i++)
+    {
+        if (slices[i].IsEmpty())
+            continue;
+
+        // Only the requested values are parsed, everything else in the object is never materialized
+        v8::Local<v8::Value> value;
+
+        if (!v8::JSON::Parse(context, slices[i]).ToLocal(&value))
+            return;
+
+        const std::string path = *v8::String::Utf8Value(isolate, paths[i]);
+
+        v8::Local<v8::Object> parent = result;
+        std::string_view remaining(path);
+
+        for (size_t separator = remaining.find('.'); separator != std::string_view::npos; separator = remaining.find('.'))
+        {
+            v8::Local<v8::String> key = v8::String::NewFromUtf8(isolate, remaining.data(), v8::NewStringType::kNormal, static_cast<int>(separator)).ToLocalChecked();
+            v8::Local<v8::Value> child;
+
+            if (!parent->Get(context, key).ToLocal(&child))
+                return;
+
+            if (!child->IsObject())
+            {
+                child = v8::Object::New(isolate);
+
+                if (parent->Set(context, key, child).IsNothing())
+                    return;
+            }
+
+            parent = child.As<v8::Object>();
+            remaining.remove_prefix(separator + 1);
+        }
+
+        v8::Local<v8::String> key = v8::String::NewFromUtf8(isolate, remaining.data(), v8::NewStringType::kNormal, static_cast<int>(remaining.size())).ToLocalChecked();
+
+        if (parent->Set(context, key, value).IsNothing())
+            return;
+    }
+
+    args.GetReturnValue().Set(scope.Escape(result));
+}
@@ -0,0 +1,21 @@
+#ifndef YMD3_SCRIPTJSON_H
+#define YMD3_SCRIPTJSON_H
+
+#include <v8.h>
+
+namespace YMD
+{
+    /**
+     * The `YMD.json` scripting API, backed by JsonExtractor.
+     * */
+    class ScriptJson
+    {
+        public:
+            [[nodiscard]] static v8::Local<v8::ObjectTemplate> createTemplate(v8::Isolate* isolate);
+
+        private:
+            static void extract(const v8::FunctionCallbackInfo<v8::Value>& args);
+    };
+}
+
+#endif //YMD3_SCRIPTJSON_H
@@ -0,0 +1,80 @@
+#include "streammarker.h"
+
+#include <algorithm>
+
+YMD::StreamMarker::StreamMarker(std::string begin, std::optional<std::string> end) :
+    begin(std::move(begin)),
+    end(std::move(end))
+{
+
+}
+
+bool YMD::StreamMarker::advance(const std::string& data)
+{
+    if (this->captured)
+        return true;
+
+    if (!this->beginFound)
+    {
+        if (!this->find(data, this->begin))
+            return false;
+
+        this->beginFound = true;
+
+        if (!this->end)
+            return this->captured = true;
+    }
+
+    return this->captured = this->find(data, *this->end);
+}
+
+bool YMD::StreamMarker::isCaptured() const
+{
+    return this->captured;
+}
+
+// Only rescans the tail a needle could still straddle, so every chunk is searched once
+bool YMD::StreamMarker::find(const std::string& data, const std::string& needle)
+{
+    const size_t pos = data.find(needle, this->searchFrom);
+
+    if (pos == std::string::npos)
+    {
+        if (data.size() >= needle.size())
+            this->searchFrom = std::max(this->searchFrom, data.size() - needle.size() + 1);
+
+        return false;
+    }
+
+    this->searchFrom = pos + needle.size();
+
+    return true;
+}
+
+size_t YMD::Utf8::completeLength(const std::string& data)
+{
+    const size_t size = data.size();
+
+    // A sequence is at most 4 bytes long, so its lead byte is within the last 4 bytes
+    for (size_t back = 1; back <= std::min<size_t>(4, size); back++)
+    {
+        const auto c = static_cast<unsigned char>(data[size - back]);
+
+        // Continuation byte, keep looking for the lead byte
+        if ((c & 0xC0) == 0x80)
+            continue;
+
+        size_t sequenceLength = 1;
+
+        if ((c & 0xE0) == 0xC0)
+            sequenceLength = 2;
+        else if ((c & 0xF0) == 0xE0)
+            sequenceLength = 3;
+        else if ((c & 0xF8) == 0xF0)
+            sequenceLength = 4;
+
+        return back < sequenceLength ? size - back : size;
+    }
+
+    return size;
+}
@@ -0,0 +1,48 @@
+#ifndef YMD3_STREAMMARKER_H
+#define YMD3_STREAMMARKER_H
+
+#include <optional>
+#include <string>
+
+namespace YMD
+{
+    /**
+     * Incrementally matches text arriving in chunks.
+     *
+     * A marker is captured once `begin` was received, followed by `end` if one is given.
+     * */
+    class StreamMarker
+    {
+        public:
+            explicit StreamMarker(std::string begin, std::optional<std::string> end = std::optional<std::string>());
+
+            /**
+             * Looks for the marker in the data received so far, which must only ever grow between calls.
+             * Returns whether the marker is captured.
+             * */
+            bool advance(const std::string& data);
+
+            [[nodiscard]] bool isCaptured() const;
+
+        private:
+            bool find(const std::string& data, const std::string& needle);
+
+            std::string begin;
+            std::optional<std::string> end;
+
+            size_t searchFrom = 0;
+            bool beginFound = false;
+            bool captured = false;
+    };
+
+    class Utf8
+    {
+        public:
+            /**
+             * Returns the length of data without a trailing, incomplete UTF-8 sequence.
+             * */
+            [[nodiscard]] static size_t completeLength(const std::string& data);
+    };
+}
+
+#endif //YMD3_STREAMMARKER_H